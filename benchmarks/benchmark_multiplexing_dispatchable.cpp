@@ -18,21 +18,53 @@
 
 #include "mir/dispatch/multiplexing_dispatchable.h"
 
+#include <atomic>
 #include <iostream>
+#include <sstream>
+#include <string>
 #include <vector>
 #include <memory>
 #include <chrono>
 #include <thread>
+#include <dlfcn.h>
 #include <poll.h>
+#include <sys/epoll.h>
 #include <unistd.h>
 
 namespace md = mir::dispatch;
 
+namespace
+{
+std::atomic<uint64_t> syscall_count{0};
+
+template<typename Function>
+Function* next_definition_of(char const* name)
+{
+    return reinterpret_cast<Function*>(dlsym(RTLD_NEXT, name));
+}
+}
+
+// Count the epoll calls made by the dispatcher (these definitions take
+// precedence over libc's for calls made from mircommon)
+extern "C" int epoll_wait(int epfd, epoll_event* events, int maxevents, int timeout)
+{
+    static auto const real = next_definition_of<int(int, epoll_event*, int, int)>("epoll_wait");
+    ++syscall_count;
+    return real(epfd, events, maxevents, timeout);
+}
+
+extern "C" int epoll_ctl(int epfd, int op, int fd, epoll_event* event) __THROW
+{
+    static auto const real = next_definition_of<int(int, int, int, epoll_event*)>("epoll_ctl");
+    ++syscall_count;
+    return real(epfd, op, fd, event);
+}
+
 class TestDispatchable : public md::Dispatchable
 {
 public:
-    TestDispatchable(uint64_t limit)
-        : dispatch_limit{limit}
+    TestDispatchable(std::atomic<int64_t>& remaining)
+        : remaining{remaining}
     {
         int pipefds[2];
         if (pipe(pipefds) < 0)
@@ -43,6 +75,7 @@ public:
         read_fd = mir::Fd{pipefds[0]};
         write_fd = mir::Fd{pipefds[1]};
 
+        // Never read, so the dispatchable stays ready
         char dummy{0};
         if (::write(write_fd, &dummy, sizeof(dummy)) != sizeof(dummy))
         {
@@ -56,8 +89,8 @@ public:
     }
     bool dispatch(md::FdEvents) override
     {
-        ++dispatch_count;
-        return (dispatch_count < dispatch_limit);
+        --remaining;
+        return true;
     }
     md::FdEvents relevant_events() const override
     {
@@ -65,13 +98,10 @@ public:
     }
 
 private:
-    static thread_local uint64_t dispatch_count;
-    uint64_t const dispatch_limit;
+    std::atomic<int64_t>& remaining;
     mir::Fd read_fd, write_fd;
 };
 
-thread_local uint64_t TestDispatchable::dispatch_count = 0;
-
 bool fd_is_readable(int fd)
 {
     struct pollfd poller {
@@ -79,33 +109,34 @@ bool fd_is_readable(int fd)
         POLLIN,
         0
     };
+    ++syscall_count;
     return poll(&poller, 1, 0);
 }
 
-int main(int argc, char** argv)
+void run(md::DispatchReentrancy reentrancy, int dispatchable_count, int thread_count, int64_t dispatch_count)
 {
-    if (argc != 3)
-    {
-        std::cout<<"Usage: "<<argv[0]<<" <number of threads> <dispatch count>"<<std::endl;
-        exit(1);
-    }
-
-    int const thread_count = std::atoi(argv[1]);
-    uint64_t const dispatch_count = std::atoll(argv[2]);
+    std::atomic<int64_t> remaining{dispatch_count};
 
     auto dispatcher = std::make_shared<md::MultiplexingDispatchable>();
-    dispatcher->add_watch(std::make_shared<TestDispatchable>(dispatch_count / thread_count), md::DispatchReentrancy::reentrant);
+    for (int i = 0; i != dispatchable_count; ++i)
+    {
+        dispatcher->add_watch(std::make_shared<TestDispatchable>(remaining), reentrancy);
+    }
 
+    syscall_count = 0;
     auto start = std::chrono::steady_clock::now();
 
     std::vector<std::thread> thread_loops;
     for (int i = 0; i < thread_count; ++i)
     {
-        thread_loops.emplace_back([](md::Dispatchable& dispatch)
+        thread_loops.emplace_back([&remaining](md::Dispatchable& dispatch)
         {
-            while(fd_is_readable(dispatch.watch_fd()))
+            while (remaining > 0)
             {
-                dispatch.dispatch(md::FdEvent::readable);
+                if (fd_is_readable(dispatch.watch_fd()))
+                {
+                    dispatch.dispatch(md::FdEvent::readable);
+                }
             }
         }, std::ref(*dispatcher));
     }
@@ -115,7 +146,38 @@ int main(int argc, char** argv)
         thread.join();
     }
 
-    auto duration = std::chrono::steady_clock::now() - start;
-    std::cout<<"Dispatching "<<dispatch_count<<" times took "<<std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()<<"ns"<<std::endl;
+    auto const duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+    auto const events = dispatch_count - remaining;
+
+    std::cout << (reentrancy == md::DispatchReentrancy::sequential ? "sequential" : "reentrant")
+              << ", " << dispatchable_count << " dispatchable(s), " << thread_count << " thread(s): "
+              << events << " events in " << duration.count() << "s, "
+              << events / duration.count() << " events/s, "
+              << static_cast<double>(syscall_count) / events << " syscalls/event" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::cout<<"Usage: "<<argv[0]<<" <number of threads>[,<number of threads>...] <dispatch count>"<<std::endl;
+        exit(1);
+    }
+
+    std::vector<int> thread_counts;
+    std::istringstream thread_list{argv[1]};
+    for (std::string count; std::getline(thread_list, count, ',');)
+    {
+        thread_counts.push_back(std::stoi(count));
+    }
+    int64_t const dispatch_count = std::atoll(argv[2]);
+
+    int const dispatchable_count{8};
+
+    for (auto const thread_count : thread_counts)
+    {
+        run(md::DispatchReentrancy::reentrant, 1, thread_count, dispatch_count);
+        run(md::DispatchReentrancy::sequential, dispatchable_count, thread_count, dispatch_count);
+    }
     exit(0);
 }
@@ -0,0 +1,96 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/basic_observers.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Observer
+{
+    virtual ~Observer() = default;
+    virtual void notify() = 0;
+};
+
+struct CountingObserver : Observer
+{
+    void notify() override { count.fetch_add(1, std::memory_order_relaxed); }
+    std::atomic<uint64_t> count{0};
+};
+
+struct Observers : mir::BasicObservers<Observer>
+{
+    using mir::BasicObservers<Observer>::add;
+
+    void notify()
+    {
+        for_each([](std::shared_ptr<Observer> const& observer) { observer->notify(); });
+    }
+};
+
+auto notification_cost(int observer_count, int thread_count, uint64_t notification_count)
+-> std::chrono::nanoseconds
+{
+    Observers observers;
+    for (int i = 0; i != observer_count; ++i)
+        observers.add(std::make_shared<CountingObserver>());
+
+    auto const start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back([&]
+            {
+                for (auto n = notification_count / thread_count; n != 0; --n)
+                    observers.notify();
+            });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    auto const duration = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration) / notification_count;
+}
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::cout<<"Usage: "<<argv[0]<<" <number of threads> <notification count>"<<std::endl;
+        exit(1);
+    }
+
+    int const thread_count = std::atoi(argv[1]);
+    uint64_t const notification_count = std::atoll(argv[2]);
+
+    for (int observer_count : {1, 2, 4, 8, 16, 32, 64})
+    {
+        std::cout<<"Notifying "<<observer_count<<" observers took "
+                 <<notification_cost(observer_count, thread_count, notification_count).count()
+                 <<"ns per notification"<<std::endl;
+    }
+    exit(0);
+}
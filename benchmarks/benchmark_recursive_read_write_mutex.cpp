@@ -0,0 +1,76 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/recursive_read_write_mutex.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if (argc != 4)
+    {
+        std::cout<<"Usage: "<<argv[0]<<" <number of threads> <locks per thread> <reads per write>"<<std::endl;
+        exit(1);
+    }
+
+    int const thread_count = std::atoi(argv[1]);
+    uint64_t const lock_count = std::atoll(argv[2]);
+    uint64_t const reads_per_write = std::atoll(argv[3]);
+
+    mir::RecursiveReadWriteMutex mutex;
+    uint64_t shared_value{0};
+    std::atomic<uint64_t> total_seen{0};
+
+    auto const start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back([&]
+            {
+                uint64_t seen{0};
+                for (uint64_t n = 1; n <= lock_count; ++n)
+                {
+                    if (reads_per_write && n % reads_per_write == 0)
+                    {
+                        mir::RecursiveWriteLock lock{mutex};
+                        ++shared_value;
+                    }
+                    else
+                    {
+                        mir::RecursiveReadLock lock{mutex};
+                        // Recursion is common in Mir's use of the mutex
+                        mir::RecursiveReadLock recursive_lock{mutex};
+                        seen += shared_value;
+                    }
+                }
+                total_seen += seen;
+            });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    auto const duration = std::chrono::steady_clock::now() - start;
+    std::cout<<"Locking "<<lock_count*thread_count<<" times on "<<thread_count<<" threads took "
+             <<std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()<<"ns"<<std::endl;
+    exit(0);
+}
@@ -0,0 +1,172 @@
+#!/usr/bin/python3
+"""Per-surface submit-to-scanout latency from an LTTng trace of a Mir server
+
+Record a trace with the lttng compositor and display reports, for example:
+
+    lttng create buffer-latency
+    lttng enable-event -u 'mir_server_compositor:*,mir_server_display:*'
+    lttng add-context -u -t vpid
+    lttng start
+    mir_demo_server --compositor-report=lttng --display-report=lttng
+    lttng stop
+
+and run this script on the trace directory (~/lttng-traces/buffer-latency-*).
+
+Each buffer a client submits (mir_server_compositor:buffer_submitted) is
+followed into the first compositor frame that includes it (buffers_in_frame,
+which lists each buffer with the ID of its stream) and on to the vsync that
+put that frame on screen (mir_server_display:report_vsync).
+"""
+
+import argparse
+import collections
+import sys
+
+import babeltrace
+
+
+class Submission:
+    def __init__(self, surface, buffer_id, time):
+        self.surface = surface
+        self.buffer_id = buffer_id
+        self.time = time
+
+
+class Frame:
+    def __init__(self, compositor, time):
+        self.compositor = compositor
+        self.began = time
+        self.finished = None
+        self.submissions = []
+        self.vsync_after_finish = None
+
+
+def percentile(values, fraction):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(fraction * len(values)))]
+
+
+class Analysis:
+    def __init__(self):
+        self.pending = collections.defaultdict(list)    # surface -> [Submission]
+        self.frames = {}                                # compositor -> Frame being composed
+        self.unshown = []                               # finished Frames awaiting their vsync
+        self.outputs = collections.defaultdict(collections.Counter)   # compositor -> {output: votes}
+        self.vsyncs = collections.defaultdict(list)     # output -> [time]
+        self.latencies = collections.defaultdict(list)  # surface -> [ns]
+        self.missed = collections.defaultdict(collections.Counter)    # surface -> {cause: count}
+
+    def process(self, event):
+        handlers = {
+            "mir_server_compositor:buffer_submitted": self.buffer_submitted,
+            "mir_server_compositor:began_frame": self.began_frame,
+            "mir_server_compositor:buffers_in_frame": self.buffers_in_frame,
+            "mir_server_compositor:finished_frame": self.finished_frame,
+            "mir_server_display:report_vsync": self.report_vsync,
+        }
+
+        handler = handlers.get(event.name)
+        if handler:
+            handler(event.get("vpid", 0), event)
+
+    def buffer_submitted(self, pid, event):
+        surface = (pid, event["stream"])
+        self.pending[surface].append(
+            Submission(surface, event["buffer_id"], event.timestamp))
+
+    def began_frame(self, pid, event):
+        compositor = (pid, event["id"])
+        self.frames[compositor] = Frame(compositor, event.timestamp)
+
+    def buffers_in_frame(self, pid, event):
+        frame = self.frames.get((pid, event["id"]))
+        if frame is None:
+            return
+
+        for buffer_id, stream in zip(event["buffer_ids"], event["renderable_ids"]):
+            pending = self.pending[(pid, stream)]
+            for i, submission in enumerate(pending):
+                if submission.buffer_id == buffer_id:
+                    # Anything submitted earlier was replaced before it was composited
+                    for dropped in pending[:i]:
+                        self.missed[dropped.surface]["dropped before composition"] += 1
+                    frame.submissions.append(submission)
+                    del pending[:i + 1]
+                    break
+
+    def finished_frame(self, pid, event):
+        frame = self.frames.pop((pid, event["id"]), None)
+        if frame:
+            frame.finished = event.timestamp
+            self.unshown.append(frame)
+
+    def report_vsync(self, pid, event):
+        output = (pid, event["id"])
+        self.vsyncs[output].append(event.timestamp)
+
+        # Learn which output each compositor draws on from the vsyncs that follow its frames
+        for frame in self.unshown:
+            if frame.compositor[0] == pid and frame.vsync_after_finish is None:
+                frame.vsync_after_finish = output
+                self.outputs[frame.compositor][output] += 1
+
+        shown = [f for f in self.unshown
+                 if f.compositor[0] == pid and self.outputs[f.compositor].most_common(1)[0][0] == output]
+
+        for frame in shown:
+            self.unshown.remove(frame)
+            for submission in frame.submissions:
+                self.scanned_out(submission, frame, output, event.timestamp)
+
+    def scanned_out(self, submission, frame, output, time):
+        self.latencies[submission.surface].append(time - submission.time)
+
+        # The buffer missed a frame if it wasn't shown at the first vsync after it was submitted
+        first_vsync = next(t for t in self.vsyncs[output] if t > submission.time)
+        if time == first_vsync:
+            return
+
+        if frame.began > first_vsync:
+            cause = "composited late"
+        elif frame.finished > first_vsync:
+            cause = "slow render"
+        else:
+            cause = "missed page flip"
+        self.missed[submission.surface][cause] += 1
+
+    def report(self, out):
+        surfaces = sorted(set(self.latencies) | set(self.missed))
+        if not surfaces:
+            out.write("No buffer submissions found: was the trace recorded with the lttng compositor report?\n")
+            return
+
+        out.write("%-8s %-18s %8s %8s %8s %8s %8s  %s\n" %
+                  ("pid", "surface", "frames", "p50 ms", "p90 ms", "p99 ms", "max ms", "missed frames"))
+
+        for surface in surfaces:
+            latencies = self.latencies[surface]
+            stats = ["%8.2f" % (percentile(latencies, f) / 1e6) for f in (0.5, 0.9, 0.99)] if latencies else ["%8s" % "-"] * 3
+            maximum = "%8.2f" % (max(latencies) / 1e6) if latencies else "%8s" % "-"
+            missed = ", ".join("%s: %d" % item for item in sorted(self.missed[surface].items()))
+            out.write("%-8d %-18s %8d %s %s  %s\n" %
+                      (surface[0], hex(surface[1]), len(latencies), " ".join(stats), maximum, missed or "none"))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Analyse buffer latency in an LTTng trace of a Mir server")
+    parser.add_argument("trace", help="trace directory")
+    args = parser.parse_args()
+
+    trace = babeltrace.TraceCollection()
+    if not trace.add_traces_recursive(args.trace, "ctf"):
+        sys.exit("No CTF traces found in %s" % args.trace)
+
+    analysis = Analysis()
+    for event in trace.events:
+        analysis.process(event)
+
+    analysis.report(sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,280 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "client_driver.h"
+#include "process_statistics.h"
+#include "stress_clients.h"
+
+#include <boost/throw_exception.hpp>
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+struct ClientDriver::Command
+{
+    enum class Type
+    {
+        add_clients,
+        redraw,
+        report_memory,
+        quit
+    } type;
+
+    int mir_clients;
+    int wayland_clients;
+    int redraws;
+};
+
+struct ClientDriver::Reply
+{
+    Connections connections;
+    long resident_set_size;
+};
+
+namespace
+{
+template<typename Message>
+void send(int fd, Message const& message)
+{
+    if (write(fd, &message, sizeof message) != sizeof message)
+        BOOST_THROW_EXCEPTION((std::system_error{errno, std::system_category(), "Failed to write to client driver pipe"}));
+}
+
+template<typename Message>
+bool receive(int fd, Message& message)
+{
+    auto const buffer = reinterpret_cast<char*>(&message);
+    size_t received{0};
+
+    while (received != sizeof message)
+    {
+        auto const result = read(fd, buffer + received, sizeof message - received);
+
+        if (result == 0)
+            return false;
+
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            BOOST_THROW_EXCEPTION((std::system_error{errno, std::system_category(), "Failed to read from client driver pipe"}));
+        }
+
+        received += result;
+    }
+
+    return true;
+}
+
+auto make_pipe() -> std::pair<mir::Fd, mir::Fd>
+{
+    int fds[2];
+    if (pipe2(fds, O_CLOEXEC) != 0)
+        BOOST_THROW_EXCEPTION((std::system_error{errno, std::system_category(), "Failed to create pipe"}));
+
+    return {mir::Fd{fds[0]}, mir::Fd{fds[1]}};
+}
+
+class Population
+{
+public:
+    Population(std::string const& mir_connect_string, std::string const& wayland_display,
+        int surfaces_per_client, mir::geometry::Size surface_size) :
+        mir_connect_string{mir_connect_string},
+        wayland_display{wayland_display},
+        surfaces_per_client{surfaces_per_client},
+        surface_size{surface_size}
+    {
+    }
+
+    auto add_clients(int mir_clients, int wayland_clients) -> ClientDriver::Connections
+    {
+        std::vector<std::chrono::nanoseconds> mir_connect, wayland_connect, mir_surfaces, wayland_surfaces;
+        int failed{0};
+
+        auto const add = [&](bool mir)
+            {
+                try
+                {
+                    std::unique_ptr<StressClient> client;
+                    if (mir)
+                        client = std::make_unique<MirStressClient>(mir_connect_string, surfaces_per_client, surface_size);
+                    else
+                        client = std::make_unique<WaylandStressClient>(wayland_display, surfaces_per_client, surface_size);
+
+                    (mir ? mir_connect : wayland_connect).push_back(client->connect_time());
+                    auto& surface_times = mir ? mir_surfaces : wayland_surfaces;
+                    surface_times.insert(end(surface_times),
+                        begin(client->surface_creation_times()), end(client->surface_creation_times()));
+
+                    clients.push_back(std::move(client));
+                }
+                catch (std::exception const& error)
+                {
+                    if (!failed++)
+                        std::cerr << "Client failed: " << error.what() << std::endl;
+                }
+            };
+
+        for (int i = 0; i != std::max(mir_clients, wayland_clients); ++i)
+        {
+            if (i < mir_clients) add(true);
+            if (i < wayland_clients) add(false);
+        }
+
+        return {failed,
+            summarise(mir_connect), summarise(wayland_connect),
+            summarise(mir_surfaces), summarise(wayland_surfaces)};
+    }
+
+    void redraw(int times)
+    {
+        for (int i = 0; i != times; ++i)
+        {
+            for (auto const& client : clients)
+                client->redraw();
+
+            for (auto const& client : clients)
+                client->sync();
+        }
+    }
+
+private:
+    std::string const mir_connect_string;
+    std::string const wayland_display;
+    int const surfaces_per_client;
+    mir::geometry::Size const surface_size;
+
+    std::vector<std::unique_ptr<StressClient>> clients;
+};
+
+void serve(int commands, int replies, Population& population)
+{
+    ClientDriver::Command command;
+
+    while (receive(commands, command))
+    {
+        ClientDriver::Reply reply{};
+
+        switch (command.type)
+        {
+        case ClientDriver::Command::Type::add_clients:
+            reply.connections = population.add_clients(command.mir_clients, command.wayland_clients);
+            break;
+
+        case ClientDriver::Command::Type::redraw:
+            population.redraw(command.redraws);
+            break;
+
+        case ClientDriver::Command::Type::report_memory:
+            break;
+
+        case ClientDriver::Command::Type::quit:
+            return;
+        }
+
+        reply.resident_set_size = ::resident_set_size();
+        send(replies, reply);
+    }
+}
+}
+
+ClientDriver::ClientDriver(
+    std::string const& mir_connect_string,
+    std::string const& wayland_display,
+    int surfaces_per_client,
+    mir::geometry::Size surface_size)
+{
+    auto command_pipe = make_pipe();
+    auto reply_pipe = make_pipe();
+
+    pid = fork();
+
+    if (pid < 0)
+        BOOST_THROW_EXCEPTION((std::system_error{errno, std::system_category(), "Failed to fork client driver"}));
+
+    if (pid == 0)
+    {
+        // Leave the parent's state (and its exit handlers) alone, and see
+        // end-of-file if it exits
+        command_pipe.second = mir::Fd{};
+        reply_pipe.first = mir::Fd{};
+
+        int status{EXIT_SUCCESS};
+        try
+        {
+            Population population{mir_connect_string, wayland_display, surfaces_per_client, surface_size};
+            serve(command_pipe.first, reply_pipe.second, population);
+        }
+        catch (std::exception const& error)
+        {
+            std::cerr << "Client driver failed: " << error.what() << std::endl;
+            status = EXIT_FAILURE;
+        }
+        _exit(status);
+    }
+
+    commands = std::move(command_pipe.second);
+    replies = std::move(reply_pipe.first);
+}
+
+ClientDriver::~ClientDriver()
+{
+    try
+    {
+        send(commands, Command{Command::Type::quit, 0, 0, 0});
+    }
+    catch (std::exception const&)
+    {
+        // The driver has gone already
+    }
+
+    waitpid(pid, nullptr, 0);
+}
+
+auto ClientDriver::add_clients(int mir_clients, int wayland_clients) -> Connections
+{
+    return run(Command{Command::Type::add_clients, mir_clients, wayland_clients, 0}).connections;
+}
+
+void ClientDriver::redraw(int times)
+{
+    run(Command{Command::Type::redraw, 0, 0, times});
+}
+
+long ClientDriver::resident_set_size()
+{
+    return run(Command{Command::Type::report_memory, 0, 0, 0}).resident_set_size;
+}
+
+auto ClientDriver::run(Command const& command) -> Reply
+{
+    send(commands, command);
+
+    Reply reply;
+    if (!receive(replies, reply))
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Client driver exited unexpectedly"});
+
+    return reply;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef CLIENT_DRIVER_H_
+#define CLIENT_DRIVER_H_
+
+#include "summary.h"
+
+#include "mir/fd.h"
+#include "mir/geometry/size.h"
+
+#include <string>
+
+#include <sys/types.h>
+
+/// Runs the clients in a child process, so the server's memory and CPU use
+/// can be measured apart from theirs.
+///
+/// The process is forked by the constructor, which must be called before
+/// any threads are started.
+class ClientDriver
+{
+public:
+    struct Connections
+    {
+        int failed;
+        Summary mir_connect;
+        Summary wayland_connect;
+        Summary mir_surface_creation;
+        Summary wayland_surface_creation;
+    };
+
+    /// \param mir_connect_string   where the Mir clients connect
+    /// \param wayland_display      the Wayland display name the Wayland clients connect to
+    /// \param surfaces_per_client  surfaces each client creates
+    /// \param surface_size         size of the surfaces
+    ClientDriver(
+        std::string const& mir_connect_string,
+        std::string const& wayland_display,
+        int surfaces_per_client,
+        mir::geometry::Size surface_size);
+
+    ~ClientDriver();
+
+    /// Connect more clients (alternating between Mir and Wayland), one at a time
+    auto add_clients(int mir_clients, int wayland_clients) -> Connections;
+
+    /// Have every client submit a new buffer to each of its surfaces, times
+    /// times, and wait for the server to process them
+    void redraw(int times);
+
+    /// \return the resident set size of the driver process, in bytes
+    long resident_set_size();
+
+    /// The messages to and from the driver process
+    struct Command;
+    struct Reply;
+
+private:
+    ClientDriver(ClientDriver const&) = delete;
+    ClientDriver& operator=(ClientDriver const&) = delete;
+
+    auto run(Command const& command) -> Reply;
+
+    pid_t pid;
+    mir::Fd commands;
+    mir::Fd replies;
+};
+
+#endif // CLIENT_DRIVER_H_
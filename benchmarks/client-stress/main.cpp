@@ -0,0 +1,210 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "client_driver.h"
+#include "process_statistics.h"
+#include "summary.h"
+#include "timed_compositor.h"
+
+#include "mir_test_framework/async_server_runner.h"
+#include "mir_test_framework/executable_path.h"
+#include "mir_test_framework/headless_display_buffer_compositor_factory.h"
+#include "mir/report_exception.h"
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <unistd.h>
+
+namespace po = boost::program_options;
+namespace mtf = mir_test_framework;
+namespace geom = mir::geometry;
+
+using namespace std::chrono;
+
+namespace
+{
+// The threads that serve clients' requests
+std::vector<std::string> const ipc_threads{"Mir/IPC", "IPC Executor", "Mir/Wayland"};
+
+double in_ms(nanoseconds time)
+{
+    return duration<double, std::milli>{time}.count();
+}
+
+std::string percentiles(Summary const& summary)
+{
+    if (!summary.count)
+        return "-";
+
+    char text[32];
+    snprintf(text, sizeof text, "%.2f/%.2f", in_ms(summary.p50), in_ms(summary.p99));
+    return text;
+}
+
+double per_client_kib(long bytes, int clients)
+{
+    return clients ? bytes / 1024.0 / clients : 0;
+}
+
+// The Wayland display is named relative to XDG_RUNTIME_DIR
+std::string runtime_dir()
+{
+    if (auto const dir = getenv("XDG_RUNTIME_DIR"))
+        return dir;
+
+    char dir[] = "/tmp/mir-client-stress-XXXXXX";
+    if (!mkdtemp(dir))
+        throw std::runtime_error{"Failed to create a runtime directory"};
+
+    setenv("XDG_RUNTIME_DIR", dir, true);
+    return dir;
+}
+}
+
+int main(int argc, char* argv[])
+try
+{
+    po::options_description desc("Mir client stress benchmark");
+    desc.add_options()
+        ("help", "this help message")
+        ("clients", po::value<int>()->default_value(1000), "number of clients to grow to")
+        ("step", po::value<int>()->default_value(100), "clients added between measurements")
+        ("protocol", po::value<std::string>()->default_value("both"),
+            "client protocol: both (alternately), mir or wayland")
+        ("surfaces", po::value<int>()->default_value(1), "surfaces per client")
+        ("width", po::value<int>()->default_value(64), "surface width")
+        ("height", po::value<int>()->default_value(64), "surface height")
+        ("redraws", po::value<int>()->default_value(10), "times every surface is redrawn after each step");
+
+    po::variables_map options;
+    po::store(po::parse_command_line(argc, argv, desc), options);
+    po::notify(options);
+
+    if (options.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    auto const max_clients = options["clients"].as<int>();
+    auto const step = options["step"].as<int>();
+    auto const protocol = options["protocol"].as<std::string>();
+    auto const redraws = options["redraws"].as<int>();
+
+    if (max_clients < 1 || step < 1 || options["surfaces"].as<int>() < 1 || redraws < 0)
+        throw std::runtime_error{"--clients, --step and --surfaces must be positive, and --redraws not negative"};
+
+    if (protocol != "both" && protocol != "mir" && protocol != "wayland")
+        throw std::runtime_error{"Unknown protocol: " + protocol};
+
+    // Don't die if the client driver does
+    signal(SIGPIPE, SIG_IGN);
+
+    // Ensure the clients load the client platform matching the dummy graphics
+    setenv("MIR_CLIENT_PLATFORM_PATH", (mtf::library_path() + "/client-modules").c_str(), false);
+
+    auto const mir_socket = runtime_dir() + "/mir-client-stress-" + std::to_string(getpid());
+    auto const wayland_display = "mir-client-stress-" + std::to_string(getpid());
+
+    ClientDriver driver{
+        mir_socket,
+        wayland_display,
+        options["surfaces"].as<int>(),
+        geom::Size{options["width"].as<int>(), options["height"].as<int>()}};
+
+    mtf::AsyncServerRunner runner;
+    runner.add_to_environment("MIR_SERVER_PLATFORM_GRAPHICS_LIB", mtf::server_platform("graphics-dummy.so").c_str());
+    runner.add_to_environment("MIR_SERVER_PLATFORM_INPUT_LIB", mtf::server_platform("input-stub.so").c_str());
+    runner.add_to_environment("MIR_SERVER_CONSOLE_PROVIDER", "none");
+    runner.add_to_environment("MIR_SERVER_FILE", mir_socket.c_str());
+    runner.add_to_environment("MIR_SERVER_WAYLAND_SOCKET_NAME", wayland_display.c_str());
+
+    auto const frame_times = std::make_shared<FrameTimes>();
+    runner.server.override_the_display_buffer_compositor_factory([frame_times]
+        {
+            return std::make_shared<TimedDisplayBufferCompositorFactory>(
+                std::make_shared<mtf::HeadlessDisplayBufferCompositorFactory>(),
+                frame_times);
+        });
+
+    runner.start_server();
+
+    auto const server_baseline = resident_set_size();
+    auto const driver_baseline = driver.resident_set_size();
+
+    printf("%7s %6s %13s %13s %13s %13s %10s %10s %10s %10s %10s %13s\n",
+        "clients", "failed", "mir connect", "wl connect", "mir surface", "wl surface",
+        "server MiB", "KiB/client", "IPC/client", "IPC/redraw", "driver KiB", "frame");
+
+    int population{0};
+    int attempted{0};
+
+    while (attempted < max_clients)
+    {
+        auto const added = std::min(step, max_clients - attempted);
+        auto const mir_clients =
+            protocol == "mir" ? added :
+            protocol == "wayland" ? 0 :
+            (added + 1) / 2;
+
+        auto const cpu_before = thread_cpu_time(ipc_threads);
+        auto const connections = driver.add_clients(mir_clients, added - mir_clients);
+        auto const cpu_connected = thread_cpu_time(ipc_threads);
+
+        attempted += added;
+        population += added - connections.failed;
+
+        frame_times->take();
+        driver.redraw(redraws);
+        auto const frames = summarise(frame_times->take());
+        auto const cpu_redrawn = thread_cpu_time(ipc_threads);
+
+        auto const server_rss = resident_set_size();
+        auto const driver_rss = driver.resident_set_size();
+
+        printf("%7d %6d %13s %13s %13s %13s %10.1f %10.1f %10.3f %10.3f %10.1f %13s\n",
+            population,
+            connections.failed,
+            percentiles(connections.mir_connect).c_str(),
+            percentiles(connections.wayland_connect).c_str(),
+            percentiles(connections.mir_surface_creation).c_str(),
+            percentiles(connections.wayland_surface_creation).c_str(),
+            server_rss / 1024.0 / 1024.0,
+            per_client_kib(server_rss - server_baseline, population),
+            in_ms(cpu_connected - cpu_before) / added,
+            redraws ? in_ms(cpu_redrawn - cpu_connected) / redraws : 0.0,
+            per_client_kib(driver_rss - driver_baseline, population),
+            percentiles(frames).c_str());
+        fflush(stdout);
+    }
+
+    runner.stop_server();
+
+    return population ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+catch (...)
+{
+    mir::report_exception(std::cerr);
+    return EXIT_FAILURE;
+}
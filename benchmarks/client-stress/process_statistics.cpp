@@ -0,0 +1,90 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "process_statistics.h"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include <unistd.h>
+
+namespace
+{
+std::string first_line_of(boost::filesystem::path const& path)
+{
+    std::ifstream in{path.string()};
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+bool starts_with_one_of(std::string const& name, std::vector<std::string> const& prefixes)
+{
+    for (auto const& prefix : prefixes)
+    {
+        if (name.compare(0, prefix.size(), prefix) == 0)
+            return true;
+    }
+
+    return false;
+}
+}
+
+long resident_set_size()
+{
+    // "size resident shared text lib data dt", in pages
+    std::istringstream statm{first_line_of("/proc/self/statm")};
+    long size{0}, resident{0};
+    statm >> size >> resident;
+
+    return resident * sysconf(_SC_PAGESIZE);
+}
+
+std::chrono::nanoseconds thread_cpu_time(std::vector<std::string> const& name_prefixes)
+{
+    static long const ticks_per_second{sysconf(_SC_CLK_TCK)};
+
+    long ticks{0};
+
+    boost::system::error_code ignored;
+    for (boost::filesystem::directory_iterator task{"/proc/self/task", ignored}, end; task != end; task.increment(ignored))
+    {
+        if (!starts_with_one_of(first_line_of(task->path() / "comm"), name_prefixes))
+            continue;
+
+        // The thread name (in parentheses) may contain spaces: the fields
+        // after it start with the state, and utime and stime are the 12th
+        // and 13th of them.
+        auto const stat = first_line_of(task->path() / "stat");
+        auto const name_end = stat.rfind(')');
+        if (name_end == std::string::npos)
+            continue;
+
+        std::istringstream fields{stat.substr(name_end + 1)};
+        std::vector<std::string> const after_name{
+            std::istream_iterator<std::string>{fields}, std::istream_iterator<std::string>{}};
+
+        if (after_name.size() > 12)
+            ticks += std::stol(after_name[11]) + std::stol(after_name[12]);
+    }
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double>{double(ticks) / ticks_per_second});
+}
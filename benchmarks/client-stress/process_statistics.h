@@ -0,0 +1,32 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PROCESS_STATISTICS_H_
+#define PROCESS_STATISTICS_H_
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/// \return the resident set size of this process, in bytes
+long resident_set_size();
+
+/// \return the CPU time (user and system) used by the threads of this process
+///         whose names start with one of the prefixes
+std::chrono::nanoseconds thread_cpu_time(std::vector<std::string> const& name_prefixes);
+
+#endif // PROCESS_STATISTICS_H_
@@ -0,0 +1,273 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "stress_clients.h"
+
+#include <boost/throw_exception.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+using namespace std::chrono;
+
+namespace
+{
+void null_lifecycle_callback(MirConnection*, MirLifecycleState, void*)
+{
+}
+
+auto stride_of(mir::geometry::Size size) -> int
+{
+    return size.width.as_int() * 4;
+}
+
+auto bytes_for(mir::geometry::Size size) -> size_t
+{
+    return stride_of(size) * size.height.as_int();
+}
+}
+
+auto StressClient::connect_time() const -> nanoseconds
+{
+    return connect_duration;
+}
+
+auto StressClient::surface_creation_times() const -> std::vector<nanoseconds> const&
+{
+    return surface_durations;
+}
+
+MirStressClient::MirStressClient(std::string const& connect_string, int surface_count, mir::geometry::Size size)
+{
+    auto const connect_start = steady_clock::now();
+    connection = mir_connect_sync(connect_string.c_str(), "client-stress");
+    connect_duration = steady_clock::now() - connect_start;
+
+    if (!mir_connection_is_valid(connection))
+    {
+        std::string const error{mir_connection_get_error_message(connection)};
+        mir_connection_release(connection);
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Connection to Mir failed: " + error});
+    }
+
+    /*
+     * Set a null callback to avoid killing the process
+     * (default callback raises SIGHUP).
+     */
+    mir_connection_set_lifecycle_event_callback(connection, null_lifecycle_callback, nullptr);
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+    MirPixelFormat pixel_format;
+    unsigned int valid_formats;
+    mir_connection_get_available_surface_formats(connection, &pixel_format, 1, &valid_formats);
+
+    for (int i = 0; i != surface_count; ++i)
+    {
+        auto const surface_start = steady_clock::now();
+
+        auto const spec = mir_create_normal_window_spec(connection, size.width.as_int(), size.height.as_int());
+        mir_window_spec_set_pixel_format(spec, pixel_format);
+        mir_window_spec_set_name(spec, "client-stress");
+
+        auto const window = mir_create_window_sync(spec);
+        mir_window_spec_release(spec);
+
+        if (!mir_window_is_valid(window))
+        {
+            std::string const error{mir_window_get_error_message(window)};
+            mir_window_release_sync(window);
+            release();
+            BOOST_THROW_EXCEPTION(std::runtime_error{"Window creation failed: " + error});
+        }
+
+        windows.push_back(window);
+
+        // The window isn't shown until it has content
+        auto const stream = mir_window_get_buffer_stream(window);
+        mir_buffer_stream_swap_buffers_sync(stream);
+
+        surface_durations.push_back(steady_clock::now() - surface_start);
+
+        // Don't let redrawing wait for the (stub) display's vsync
+        mir_wait_for(mir_buffer_stream_set_swapinterval(stream, 0));
+    }
+#pragma GCC diagnostic pop
+}
+
+MirStressClient::~MirStressClient()
+{
+    release();
+}
+
+void MirStressClient::release()
+{
+    for (auto const window : windows)
+        mir_window_release_sync(window);
+
+    windows.clear();
+    mir_connection_release(connection);
+}
+
+void MirStressClient::redraw()
+{
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+    for (auto const window : windows)
+        mir_buffer_stream_swap_buffers_sync(mir_window_get_buffer_stream(window));
+#pragma GCC diagnostic pop
+}
+
+void MirStressClient::sync()
+{
+    // Requests are synchronous
+}
+
+wl_registry_listener const WaylandStressClient::registry_listener = []
+    {
+        wl_registry_listener listener{};
+
+        listener.global = [](void* data, wl_registry* registry, uint32_t name, char const* interface, uint32_t)
+            {
+                auto const client = static_cast<WaylandStressClient*>(data);
+
+                if (strcmp(interface, wl_compositor_interface.name) == 0)
+                {
+                    client->compositor = static_cast<wl_compositor*>(
+                        wl_registry_bind(registry, name, &wl_compositor_interface, 1));
+                }
+                else if (strcmp(interface, wl_shm_interface.name) == 0)
+                {
+                    client->shm = static_cast<wl_shm*>(wl_registry_bind(registry, name, &wl_shm_interface, 1));
+                }
+                else if (strcmp(interface, wl_shell_interface.name) == 0)
+                {
+                    client->shell = static_cast<wl_shell*>(wl_registry_bind(registry, name, &wl_shell_interface, 1));
+                }
+            };
+        listener.global_remove = [](void*, wl_registry*, uint32_t) {};
+
+        return listener;
+    }();
+
+wl_shell_surface_listener const WaylandStressClient::shell_surface_listener = []
+    {
+        wl_shell_surface_listener listener{};
+
+        listener.ping = [](void*, wl_shell_surface* shell_surface, uint32_t serial)
+            {
+                wl_shell_surface_pong(shell_surface, serial);
+            };
+        listener.configure = [](void*, wl_shell_surface*, uint32_t, int32_t, int32_t) {};
+        listener.popup_done = [](void*, wl_shell_surface*) {};
+
+        return listener;
+    }();
+
+WaylandStressClient::WaylandStressClient(std::string const& display_name, int surface_count, mir::geometry::Size size) :
+    size{size},
+    buffer_file{bytes_for(size)}
+{
+    auto const connect_start = steady_clock::now();
+
+    display = wl_display_connect(display_name.c_str());
+    if (!display)
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Failed to connect to Wayland server " + display_name});
+
+    registry = wl_display_get_registry(display);
+    wl_registry_add_listener(registry, &registry_listener, this);
+    wl_display_roundtrip(display);
+
+    connect_duration = steady_clock::now() - connect_start;
+
+    if (!compositor || !shm || !shell)
+    {
+        release();
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Wayland server lacks wl_compositor, wl_shm or wl_shell"});
+    }
+
+    auto const pool = wl_shm_create_pool(shm, buffer_file.fd(), bytes_for(size));
+    buffer = wl_shm_pool_create_buffer(
+        pool, 0, size.width.as_int(), size.height.as_int(), stride_of(size), WL_SHM_FORMAT_ARGB8888);
+    wl_shm_pool_destroy(pool);
+
+    memset(buffer_file.base_ptr(), 0x80, bytes_for(size));
+
+    for (int i = 0; i != surface_count; ++i)
+    {
+        auto const surface_start = steady_clock::now();
+
+        auto const surface = wl_compositor_create_surface(compositor);
+        auto const shell_surface = wl_shell_get_shell_surface(shell, surface);
+        surfaces.push_back(Surface{surface, shell_surface});
+
+        wl_shell_surface_add_listener(shell_surface, &shell_surface_listener, this);
+        wl_shell_surface_set_toplevel(shell_surface);
+
+        wl_surface_attach(surface, buffer, 0, 0);
+        wl_surface_commit(surface);
+        wl_display_roundtrip(display);
+
+        surface_durations.push_back(steady_clock::now() - surface_start);
+    }
+
+    if (wl_display_get_error(display))
+    {
+        release();
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Wayland protocol error creating surfaces"});
+    }
+}
+
+WaylandStressClient::~WaylandStressClient()
+{
+    release();
+}
+
+void WaylandStressClient::release()
+{
+    for (auto const& surface : surfaces)
+    {
+        wl_shell_surface_destroy(surface.shell_surface);
+        wl_surface_destroy(surface.surface);
+    }
+    surfaces.clear();
+
+    if (buffer) wl_buffer_destroy(buffer);
+    if (shell) wl_shell_destroy(shell);
+    if (shm) wl_shm_destroy(shm);
+    if (compositor) wl_compositor_destroy(compositor);
+    if (registry) wl_registry_destroy(registry);
+
+    wl_display_disconnect(display);
+}
+
+void WaylandStressClient::redraw()
+{
+    for (auto const& surface : surfaces)
+    {
+        wl_surface_attach(surface.surface, buffer, 0, 0);
+        wl_surface_damage(surface.surface, 0, 0, size.width.as_int(), size.height.as_int());
+        wl_surface_commit(surface.surface);
+    }
+
+    wl_display_flush(display);
+}
+
+void WaylandStressClient::sync()
+{
+    wl_display_roundtrip(display);
+}
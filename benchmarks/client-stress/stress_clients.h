@@ -0,0 +1,114 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef STRESS_CLIENTS_H_
+#define STRESS_CLIENTS_H_
+
+#include "mir_toolkit/mir_client_library.h"
+#include "mir/anonymous_shm_file.h"
+#include "mir/geometry/size.h"
+
+#include <wayland-client.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/// A client with some (unfocused, overlapping) surfaces, that records how
+/// long it took to connect and to create them.
+///
+/// Clients aren't thread safe: they're driven from one thread, and dispatch
+/// events only when asked to sync().
+class StressClient
+{
+public:
+    virtual ~StressClient() = default;
+
+    auto connect_time() const -> std::chrono::nanoseconds;
+
+    /// \return the time taken to create each surface (until it was shown)
+    auto surface_creation_times() const -> std::vector<std::chrono::nanoseconds> const&;
+
+    /// Submit a new buffer to each surface
+    virtual void redraw() = 0;
+
+    /// Wait for the server to process the requests sent so far
+    virtual void sync() = 0;
+
+protected:
+    StressClient() = default;
+
+    std::chrono::nanoseconds connect_duration{0};
+    std::vector<std::chrono::nanoseconds> surface_durations;
+
+private:
+    StressClient(StressClient const&) = delete;
+    StressClient& operator=(StressClient const&) = delete;
+};
+
+class MirStressClient : public StressClient
+{
+public:
+    MirStressClient(std::string const& connect_string, int surface_count, mir::geometry::Size size);
+    ~MirStressClient();
+
+    void redraw() override;
+    void sync() override;
+
+private:
+    void release();
+
+    MirConnection* connection{nullptr};
+    std::vector<MirWindow*> windows;
+};
+
+/// A Wayland client, using wl_shell
+class WaylandStressClient : public StressClient
+{
+public:
+    WaylandStressClient(std::string const& display_name, int surface_count, mir::geometry::Size size);
+    ~WaylandStressClient();
+
+    void redraw() override;
+    void sync() override;
+
+private:
+    static wl_registry_listener const registry_listener;
+    static wl_shell_surface_listener const shell_surface_listener;
+
+    struct Surface
+    {
+        wl_surface* surface;
+        wl_shell_surface* shell_surface;
+    };
+
+    void release();
+
+    mir::geometry::Size const size;
+    wl_display* display{nullptr};
+    wl_registry* registry{nullptr};
+    wl_compositor* compositor{nullptr};
+    wl_shm* shm{nullptr};
+    wl_shell* shell{nullptr};
+
+    // Every surface shows the same buffer
+    mir::AnonymousShmFile buffer_file;
+    wl_buffer* buffer{nullptr};
+    std::vector<Surface> surfaces;
+};
+
+#endif // STRESS_CLIENTS_H_
@@ -0,0 +1,43 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "summary.h"
+
+#include <algorithm>
+#include <numeric>
+
+using namespace std::chrono;
+
+auto summarise(std::vector<nanoseconds> times) -> Summary
+{
+    if (times.empty())
+        return {0, nanoseconds::zero(), nanoseconds::zero(), nanoseconds::zero(), nanoseconds::zero()};
+
+    std::sort(begin(times), end(times));
+
+    auto const percentile = [&times](double fraction)
+        {
+            return times[std::min(times.size() - 1, static_cast<size_t>(fraction * times.size()))];
+        };
+
+    return {
+        times.size(),
+        std::accumulate(begin(times), end(times), nanoseconds::zero()) / times.size(),
+        percentile(0.5),
+        percentile(0.99),
+        times.back()};
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SUMMARY_H_
+#define SUMMARY_H_
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+struct Summary
+{
+    std::size_t count;
+    std::chrono::nanoseconds mean;
+    std::chrono::nanoseconds p50;
+    std::chrono::nanoseconds p99;
+    std::chrono::nanoseconds max;
+};
+
+/// \return the statistics of times (all zero if there are none)
+auto summarise(std::vector<std::chrono::nanoseconds> times) -> Summary;
+
+#endif // SUMMARY_H_
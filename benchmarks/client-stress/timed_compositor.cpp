@@ -0,0 +1,78 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "timed_compositor.h"
+
+#include "mir/compositor/display_buffer_compositor.h"
+
+namespace mc = mir::compositor;
+namespace mg = mir::graphics;
+
+namespace
+{
+class TimedDisplayBufferCompositor : public mc::DisplayBufferCompositor
+{
+public:
+    TimedDisplayBufferCompositor(
+        std::unique_ptr<mc::DisplayBufferCompositor> wrapped,
+        std::shared_ptr<FrameTimes> const& frame_times) :
+        wrapped{std::move(wrapped)},
+        frame_times{frame_times}
+    {
+    }
+
+    void composite(mc::SceneElementSequence&& scene_sequence) override
+    {
+        auto const start = std::chrono::steady_clock::now();
+        wrapped->composite(std::move(scene_sequence));
+        frame_times->add(std::chrono::steady_clock::now() - start);
+    }
+
+private:
+    std::unique_ptr<mc::DisplayBufferCompositor> const wrapped;
+    std::shared_ptr<FrameTimes> const frame_times;
+};
+}
+
+void FrameTimes::add(std::chrono::nanoseconds frame_time)
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    frame_times.push_back(frame_time);
+}
+
+auto FrameTimes::take() -> std::vector<std::chrono::nanoseconds>
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    std::vector<std::chrono::nanoseconds> result;
+    result.swap(frame_times);
+    return result;
+}
+
+TimedDisplayBufferCompositorFactory::TimedDisplayBufferCompositorFactory(
+    std::shared_ptr<mc::DisplayBufferCompositorFactory> const& wrapped,
+    std::shared_ptr<FrameTimes> const& frame_times) :
+    wrapped{wrapped},
+    frame_times{frame_times}
+{
+}
+
+auto TimedDisplayBufferCompositorFactory::create_compositor_for(mg::DisplayBuffer& display_buffer)
+    -> std::unique_ptr<mc::DisplayBufferCompositor>
+{
+    return std::make_unique<TimedDisplayBufferCompositor>(
+        wrapped->create_compositor_for(display_buffer), frame_times);
+}
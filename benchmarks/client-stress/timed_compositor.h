@@ -0,0 +1,57 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TIMED_COMPOSITOR_H_
+#define TIMED_COMPOSITOR_H_
+
+#include "mir/compositor/display_buffer_compositor_factory.h"
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+/// Collects the time each frame takes to composite
+class FrameTimes
+{
+public:
+    void add(std::chrono::nanoseconds frame_time);
+
+    /// \return the frame times since the last call
+    auto take() -> std::vector<std::chrono::nanoseconds>;
+
+private:
+    std::mutex mutex;
+    std::vector<std::chrono::nanoseconds> frame_times;
+};
+
+/// Times the frames composited by the compositors another factory creates
+class TimedDisplayBufferCompositorFactory : public mir::compositor::DisplayBufferCompositorFactory
+{
+public:
+    TimedDisplayBufferCompositorFactory(
+        std::shared_ptr<mir::compositor::DisplayBufferCompositorFactory> const& wrapped,
+        std::shared_ptr<FrameTimes> const& frame_times);
+
+    auto create_compositor_for(mir::graphics::DisplayBuffer& display_buffer)
+        -> std::unique_ptr<mir::compositor::DisplayBufferCompositor> override;
+
+private:
+    std::shared_ptr<mir::compositor::DisplayBufferCompositorFactory> const wrapped;
+    std::shared_ptr<FrameTimes> const frame_times;
+};
+
+#endif // TIMED_COMPOSITOR_H_
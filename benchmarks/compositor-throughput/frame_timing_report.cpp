@@ -0,0 +1,112 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "frame_timing_report.h"
+
+#include <time.h>
+
+namespace mg = mir::graphics;
+
+namespace
+{
+auto cpu_time(clockid_t clock) -> std::chrono::nanoseconds
+{
+    timespec ts;
+    clock_gettime(clock, &ts);
+    return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+}
+
+// began_frame() and finished_frame() are called on the compositing thread
+struct FrameStart
+{
+    std::chrono::steady_clock::time_point time;
+    std::chrono::nanoseconds cpu_time;
+};
+
+thread_local FrameStart frame_start;
+}
+
+void FrameTimingReport::start_recording()
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    recording = true;
+    recording_start = std::chrono::steady_clock::now();
+    process_cpu_time_at_start = cpu_time(CLOCK_PROCESS_CPUTIME_ID);
+    frame_times.clear();
+    frame_cpu_times.clear();
+}
+
+auto FrameTimingReport::stop_recording() -> Results
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    recording = false;
+
+    return {
+        std::chrono::steady_clock::now() - recording_start,
+        cpu_time(CLOCK_PROCESS_CPUTIME_ID) - process_cpu_time_at_start,
+        std::move(frame_times),
+        std::move(frame_cpu_times)};
+}
+
+void FrameTimingReport::began_frame(SubCompositorId)
+{
+    frame_start = {std::chrono::steady_clock::now(), cpu_time(CLOCK_THREAD_CPUTIME_ID)};
+}
+
+void FrameTimingReport::finished_frame(SubCompositorId)
+{
+    auto const time = std::chrono::steady_clock::now() - frame_start.time;
+    auto const thread_cpu_time = cpu_time(CLOCK_THREAD_CPUTIME_ID) - frame_start.cpu_time;
+
+    std::lock_guard<std::mutex> lock{mutex};
+
+    if (recording)
+    {
+        frame_times.push_back(time);
+        frame_cpu_times.push_back(thread_cpu_time);
+    }
+}
+
+void FrameTimingReport::added_display(int, int, int, int, SubCompositorId)
+{
+}
+
+void FrameTimingReport::renderables_in_frame(SubCompositorId, mg::RenderableList const&)
+{
+}
+
+void FrameTimingReport::rendered_frame(SubCompositorId)
+{
+}
+
+void FrameTimingReport::started()
+{
+}
+
+void FrameTimingReport::stopped()
+{
+}
+
+void FrameTimingReport::scheduled()
+{
+}
+
+void FrameTimingReport::buffer_submitted(mg::Renderable::ID, mg::BufferID, uint64_t)
+{
+}
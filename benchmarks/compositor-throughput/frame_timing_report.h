@@ -0,0 +1,67 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef FRAME_TIMING_REPORT_H_
+#define FRAME_TIMING_REPORT_H_
+
+#include "mir/compositor/compositor_report.h"
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+/// Times the frames the compositor renders: the wall-clock time from
+/// began_frame() to finished_frame(), and the CPU time the compositing
+/// thread used in between.
+class FrameTimingReport : public mir::compositor::CompositorReport
+{
+public:
+    struct Results
+    {
+        std::chrono::nanoseconds elapsed;
+        std::chrono::nanoseconds process_cpu_time;
+        std::vector<std::chrono::nanoseconds> frame_times;
+        std::vector<std::chrono::nanoseconds> frame_cpu_times;
+    };
+
+    /// Discard the frames so far, and start recording
+    void start_recording();
+
+    /// \return the frames finished since start_recording()
+    Results stop_recording();
+
+    void added_display(int width, int height, int x, int y, SubCompositorId id) override;
+    void began_frame(SubCompositorId id) override;
+    void renderables_in_frame(SubCompositorId id, mir::graphics::RenderableList const& renderables) override;
+    void rendered_frame(SubCompositorId id) override;
+    void finished_frame(SubCompositorId id) override;
+    void started() override;
+    void stopped() override;
+    void scheduled() override;
+    void buffer_submitted(
+        mir::graphics::Renderable::ID stream, mir::graphics::BufferID buffer, uint64_t sequence) override;
+
+private:
+    std::mutex mutex;
+    bool recording{false};
+    std::chrono::steady_clock::time_point recording_start;
+    std::chrono::nanoseconds process_cpu_time_at_start;
+    std::vector<std::chrono::nanoseconds> frame_times;
+    std::vector<std::chrono::nanoseconds> frame_cpu_times;
+};
+
+#endif // FRAME_TIMING_REPORT_H_
@@ -0,0 +1,143 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "synthetic_surfaces.h"
+#include "throughput_server.h"
+
+#include "mir/report_exception.h"
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <thread>
+
+namespace po = boost::program_options;
+namespace geom = mir::geometry;
+
+using namespace std::chrono;
+
+namespace
+{
+double in_ms(nanoseconds time)
+{
+    return duration<double, std::milli>{time}.count();
+}
+
+nanoseconds percentile(std::vector<nanoseconds> times, double fraction)
+{
+    auto const n = std::min(times.size() - 1, static_cast<size_t>(fraction * times.size()));
+    std::nth_element(begin(times), begin(times) + n, end(times));
+    return times[n];
+}
+
+void print(FrameTimingReport::Results const& results, long updates)
+{
+    auto const frames = results.frame_times.size();
+    auto const seconds = duration<double>{results.elapsed}.count();
+
+    printf("Composited %zu frames in %.1f s (%ld buffers submitted)\n", frames, seconds, updates);
+
+    if (!frames)
+        return;
+
+    auto const thread_cpu_time = std::accumulate(
+        begin(results.frame_cpu_times), end(results.frame_cpu_times), nanoseconds::zero());
+
+    printf("Frames per second: %.1f\n", frames / seconds);
+    printf("Frame time: mean %.3f ms, p50 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+        in_ms(std::accumulate(begin(results.frame_times), end(results.frame_times), nanoseconds::zero())) / frames,
+        in_ms(percentile(results.frame_times, 0.5)),
+        in_ms(percentile(results.frame_times, 0.99)),
+        in_ms(*std::max_element(begin(results.frame_times), end(results.frame_times))));
+    printf("CPU per frame: %.3f ms compositor thread, %.3f ms whole process\n",
+        in_ms(thread_cpu_time) / frames,
+        in_ms(results.process_cpu_time) / frames);
+}
+}
+
+int main(int argc, char* argv[])
+try
+{
+    po::options_description desc("Mir compositor throughput benchmark");
+    desc.add_options()
+        ("help", "this help message")
+        ("surfaces", po::value<int>()->default_value(8), "number of surfaces")
+        ("width", po::value<int>()->default_value(512), "surface width")
+        ("height", po::value<int>()->default_value(512), "surface height")
+        ("alpha", po::value<float>()->default_value(1.0f), "surface alpha (below 1 the surfaces are blended)")
+        ("overlap", po::value<float>()->default_value(0.5f), "fraction of each surface covered by the next [0, 1]")
+        ("update-rate", po::value<double>()->default_value(0),
+            "updates per second of each surface (0: as fast as the compositor allows)")
+        ("warm-up", po::value<int>()->default_value(1), "seconds to run before measuring")
+        ("duration", po::value<int>()->default_value(10), "seconds to measure");
+
+    po::variables_map options;
+    po::store(po::parse_command_line(argc, argv, desc), options);
+    po::notify(options);
+
+    if (options.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    SyntheticSurfaceParameters const parameters{
+        options["surfaces"].as<int>(),
+        geom::Size{options["width"].as<int>(), options["height"].as<int>()},
+        std::min(std::max(options["alpha"].as<float>(), 0.0f), 1.0f),
+        std::min(std::max(options["overlap"].as<float>(), 0.0f), 1.0f),
+        options["update-rate"].as<double>()};
+
+    // Without a display server (such as on a CI machine) Mesa needs to be
+    // told to render without one
+    setenv("EGL_PLATFORM", "surfaceless", false);
+
+    ThroughputServer server;
+    server.start_server();
+
+    auto& config = server.server_config();
+    auto const report = config.the_frame_timing_report();
+
+    FrameTimingReport::Results results;
+    long updates;
+    {
+        SyntheticSurfaces surfaces{parameters, config.display_area(), config.the_surface_stack(), config.the_scene_report()};
+
+        std::this_thread::sleep_for(seconds{options["warm-up"].as<int>()});
+
+        auto const updates_at_start = surfaces.updates();
+        report->start_recording();
+        std::this_thread::sleep_for(seconds{options["duration"].as<int>()});
+        results = report->stop_recording();
+        updates = surfaces.updates() - updates_at_start;
+    }
+
+    server.stop_server();
+
+    print(results, updates);
+
+    return results.frame_times.empty() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+catch (...)
+{
+    mir::report_exception(std::cerr);
+    return EXIT_FAILURE;
+}
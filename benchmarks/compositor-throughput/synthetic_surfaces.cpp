@@ -0,0 +1,204 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "synthetic_surfaces.h"
+
+#include "src/platforms/common/server/shm_buffer.h"
+#include "src/server/compositor/stream.h"
+#include "src/server/scene/basic_surface.h"
+
+#include "mir/anonymous_shm_file.h"
+#include "mir/shell/surface_stack.h"
+
+#include <algorithm>
+
+namespace mc = mir::compositor;
+namespace mg = mir::graphics;
+namespace ms = mir::scene;
+namespace msh = mir::shell;
+namespace geom = mir::geometry;
+
+namespace
+{
+MirPixelFormat const buffer_format{mir_pixel_format_xbgr_8888};
+int const buffers_per_surface{3};
+
+// A shared memory buffer, as a wl_shm client would submit: the GL renderer
+// uploads it to a texture each time it changes.
+class SyntheticBuffer : public mg::common::ShmBuffer
+{
+public:
+    explicit SyntheticBuffer(geom::Size const& size) :
+        ShmBuffer{
+            std::make_unique<mir::AnonymousShmFile>(size.width.as_uint32_t() * size.height.as_uint32_t() * 4),
+            size,
+            buffer_format}
+    {
+    }
+
+    auto native_buffer_handle() const -> std::shared_ptr<mg::NativeBuffer> override
+    {
+        return nullptr;
+    }
+};
+
+// Left to right, then top to bottom, wrapping round to the top
+auto layout(SyntheticSurfaceParameters const& parameters, geom::Rectangle const& display_area)
+-> std::vector<geom::Rectangle>
+{
+    int const width{parameters.size.width.as_int()};
+    int const height{parameters.size.height.as_int()};
+    int const step_x{std::max(1, static_cast<int>(width * (1.0f - parameters.overlap)))};
+    int const step_y{std::max(1, static_cast<int>(height * (1.0f - parameters.overlap)))};
+
+    int const left{display_area.left().as_int()};
+    int const top{display_area.top().as_int()};
+    int const right{std::max(left + width, display_area.right().as_int())};
+    int const bottom{std::max(top + height, display_area.bottom().as_int())};
+
+    std::vector<geom::Rectangle> rects;
+    int x{left};
+    int y{top};
+
+    for (int i = 0; i != parameters.count; ++i)
+    {
+        rects.push_back({{x, y}, parameters.size});
+
+        x += step_x;
+        if (x + width > right)
+        {
+            x = left;
+            y += step_y;
+            if (y + height > bottom)
+                y = top;
+        }
+    }
+
+    return rects;
+}
+}
+
+SyntheticSurfaces::SyntheticSurfaces(
+    SyntheticSurfaceParameters const& parameters,
+    geom::Rectangle const& display_area,
+    std::shared_ptr<msh::SurfaceStack> const& surface_stack,
+    std::shared_ptr<ms::SceneReport> const& scene_report) :
+    surface_stack{surface_stack},
+    update_period{parameters.update_rate > 0 ?
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>{1.0 / parameters.update_rate}) :
+        std::chrono::steady_clock::duration::zero()}
+{
+    auto const rects = layout(parameters, display_area);
+    auto const now = std::chrono::steady_clock::now();
+
+    for (auto i = 0u; i != rects.size(); ++i)
+    {
+        Surface synthetic;
+
+        synthetic.stream = std::make_shared<mc::Stream>(parameters.size, buffer_format);
+        for (int b = 0; b != buffers_per_surface; ++b)
+            synthetic.buffers.push_back(std::make_shared<SyntheticBuffer>(parameters.size));
+
+        // A different colour for each surface
+        synthetic.pixels.resize(parameters.size.width.as_uint32_t() * parameters.size.height.as_uint32_t() * 4);
+        unsigned char const colour[4] = {
+            static_cast<unsigned char>(64 + 37 * i % 192),
+            static_cast<unsigned char>(64 + 71 * i % 192),
+            static_cast<unsigned char>(64 + 113 * i % 192),
+            0xff};
+        for (auto p = 0u; p != synthetic.pixels.size(); ++p)
+            synthetic.pixels[p] = colour[p % 4];
+
+        // The surface is only visible once it has a buffer
+        synthetic.buffers.front()->write(synthetic.pixels.data(), synthetic.pixels.size());
+        synthetic.stream->submit_buffer(synthetic.buffers.front());
+
+        synthetic.surface = std::make_shared<ms::BasicSurface>(
+            "synthetic surface " + std::to_string(i),
+            rects[i],
+            mir_pointer_unconfined,
+            std::list<ms::StreamInfo>{{synthetic.stream, {}, {}}},
+            std::shared_ptr<mg::CursorImage>{},
+            scene_report);
+
+        if (parameters.alpha < 1.0f)
+            synthetic.surface->set_alpha(parameters.alpha);
+
+        synthetic.next_update = now + update_period;
+
+        surface_stack->add_surface(synthetic.surface, mir::input::InputReceptionMode::normal);
+        surfaces.push_back(std::move(synthetic));
+    }
+
+    updater = std::thread{[this] { update_surfaces(); }};
+}
+
+SyntheticSurfaces::~SyntheticSurfaces()
+{
+    running = false;
+    updater.join();
+
+    for (auto const& synthetic : surfaces)
+        surface_stack->remove_surface(synthetic.surface);
+}
+
+long SyntheticSurfaces::updates() const
+{
+    return submitted;
+}
+
+void SyntheticSurfaces::update_surfaces()
+{
+    // How long to wait for the compositor to release a buffer
+    std::chrono::microseconds const retry_period{250};
+
+    while (running)
+    {
+        auto const now = std::chrono::steady_clock::now();
+        auto wake = now + retry_period;
+        bool updated{false};
+
+        for (auto& synthetic : surfaces)
+        {
+            if (synthetic.next_update > now)
+            {
+                wake = std::min(wake, synthetic.next_update);
+                continue;
+            }
+
+            // Only we hold a buffer that neither the stream nor the compositor is using
+            auto const buffer = std::find_if(begin(synthetic.buffers), end(synthetic.buffers),
+                [](auto const& buffer) { return buffer.use_count() == 1; });
+
+            if (buffer == end(synthetic.buffers))
+                continue;
+
+            // The content doesn't change, but the compositor can't know that
+            (*buffer)->write(synthetic.pixels.data(), synthetic.pixels.size());
+            synthetic.stream->submit_buffer(*buffer);
+            ++submitted;
+            updated = true;
+
+            // Don't try to catch up after falling behind by more than one update
+            synthetic.next_update = std::max(synthetic.next_update + update_period, now);
+        }
+
+        if (!updated)
+            std::this_thread::sleep_until(wake);
+    }
+}
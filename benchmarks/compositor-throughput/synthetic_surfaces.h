@@ -0,0 +1,92 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SYNTHETIC_SURFACES_H_
+#define SYNTHETIC_SURFACES_H_
+
+#include "mir/geometry/rectangle.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace mir
+{
+namespace compositor { class Stream; }
+namespace graphics { namespace common { class ShmBuffer; } }
+namespace scene { class BasicSurface; class SceneReport; }
+namespace shell { class SurfaceStack; }
+}
+
+struct SyntheticSurfaceParameters
+{
+    int count;
+    mir::geometry::Size size;
+
+    // Surfaces with alpha < 1 are blended, and don't occlude those beneath
+    float alpha;
+
+    // The fraction of each surface's width (or height, where the surfaces
+    // wrap onto a new row) covered by the next one
+    float overlap;
+
+    // Updates per second of each surface; 0 updates as fast as the
+    // compositor releases buffers
+    double update_rate;
+};
+
+/// Surfaces added straight to the scene, with a thread that submits new
+/// buffers to them, as in-process stand-ins for clients.
+class SyntheticSurfaces
+{
+public:
+    SyntheticSurfaces(
+        SyntheticSurfaceParameters const& parameters,
+        mir::geometry::Rectangle const& display_area,
+        std::shared_ptr<mir::shell::SurfaceStack> const& surface_stack,
+        std::shared_ptr<mir::scene::SceneReport> const& scene_report);
+
+    /// Stops the updates and removes the surfaces
+    ~SyntheticSurfaces();
+
+    /// \return the number of buffers submitted so far
+    long updates() const;
+
+private:
+    struct Surface
+    {
+        std::shared_ptr<mir::compositor::Stream> stream;
+        std::shared_ptr<mir::scene::BasicSurface> surface;
+        std::vector<std::shared_ptr<mir::graphics::common::ShmBuffer>> buffers;
+        std::vector<unsigned char> pixels;
+        std::chrono::steady_clock::time_point next_update;
+    };
+
+    void update_surfaces();
+
+    std::shared_ptr<mir::shell::SurfaceStack> const surface_stack;
+    std::chrono::steady_clock::duration const update_period;
+    std::vector<Surface> surfaces;
+
+    std::atomic<bool> running{true};
+    std::atomic<long> submitted{0};
+    std::thread updater;
+};
+
+#endif // SYNTHETIC_SURFACES_H_
@@ -0,0 +1,76 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "throughput_server.h"
+
+#include "src/server/graphics/offscreen/display.h"
+
+#include "mir/graphics/display_configuration.h"
+
+namespace mg = mir::graphics;
+namespace geom = mir::geometry;
+
+std::shared_ptr<mg::Display> ThroughputServerConfiguration::the_display()
+{
+    return display(
+        [this]() -> std::shared_ptr<mg::Display>
+        {
+            return std::make_shared<mg::offscreen::Display>(
+                EGL_DEFAULT_DISPLAY,
+                the_display_configuration_policy(),
+                the_display_report());
+        });
+}
+
+std::shared_ptr<mir::renderer::RendererFactory> ThroughputServerConfiguration::the_renderer_factory()
+{
+    // Don't stub the renderer: that's what we're measuring
+    return DefaultServerConfiguration::the_renderer_factory();
+}
+
+std::shared_ptr<mir::compositor::CompositorReport> ThroughputServerConfiguration::the_compositor_report()
+{
+    return frame_timing_report;
+}
+
+std::shared_ptr<FrameTimingReport> ThroughputServerConfiguration::the_frame_timing_report()
+{
+    return frame_timing_report;
+}
+
+geom::Rectangle ThroughputServerConfiguration::display_area()
+{
+    geom::Rectangle area;
+    bool found{false};
+
+    the_display()->configuration()->for_each_output(
+        [&](mg::DisplayConfigurationOutput const& output)
+        {
+            if (!found && output.used)
+            {
+                area = output.extents();
+                found = true;
+            }
+        });
+
+    return area;
+}
+
+ThroughputServerConfiguration& ThroughputServer::server_config()
+{
+    return config;
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef THROUGHPUT_SERVER_H_
+#define THROUGHPUT_SERVER_H_
+
+#include "frame_timing_report.h"
+
+#include "mir_test_framework/server_runner.h"
+#include "mir_test_framework/stubbed_server_configuration.h"
+
+/// A server that composites with the GL renderer into an offscreen
+/// framebuffer, so it needs no display hardware (Mesa's llvmpipe will do).
+/// The rest of the graphics platform is stubbed.
+class ThroughputServerConfiguration : public mir_test_framework::StubbedServerConfiguration
+{
+public:
+    std::shared_ptr<mir::graphics::Display> the_display() override;
+    std::shared_ptr<mir::renderer::RendererFactory> the_renderer_factory() override;
+    std::shared_ptr<mir::compositor::CompositorReport> the_compositor_report() override;
+
+    std::shared_ptr<FrameTimingReport> the_frame_timing_report();
+
+    /// \return the area of the (first) output
+    mir::geometry::Rectangle display_area();
+
+private:
+    std::shared_ptr<FrameTimingReport> const frame_timing_report{std::make_shared<FrameTimingReport>()};
+};
+
+class ThroughputServer : public mir_test_framework::ServerRunner
+{
+public:
+    ThroughputServerConfiguration& server_config() override;
+
+private:
+    ThroughputServerConfiguration config;
+};
+
+#endif // THROUGHPUT_SERVER_H_
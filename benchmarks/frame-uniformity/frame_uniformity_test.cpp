@@ -19,7 +19,8 @@
 #include "frame_uniformity_test.h"
 
 FrameUniformityTest::FrameUniformityTest(FrameUniformityTestParameters const& parameters)
-    : client_ready_fence{2},
+    : touch_resampling{"MIR_SERVER_TOUCH_RESAMPLING", parameters.resample_touches ? "touch screen" : nullptr},
+      client_ready_fence{2},
       server_configuration({{0, 0}, parameters.screen_size},
           parameters.touch_start,
           parameters.touch_end,
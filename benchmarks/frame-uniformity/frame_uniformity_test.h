@@ -29,6 +29,7 @@
 #include "mir/test/barrier.h"
 
 #include "mir_test_framework/server_runner.h"
+#include "mir_test_framework/temporary_environment_value.h"
 
 #include <chrono>
 
@@ -39,6 +40,9 @@ struct FrameUniformityTestParameters
     mir::geometry::Point touch_end;
 
     std::chrono::milliseconds touch_duration;
+
+    // Have the server resample the touch screen to the (simulated) vsync
+    bool resample_touches;
 };
 
 class FrameUniformityTest : public mir_test_framework::ServerRunner
@@ -56,6 +60,7 @@ public:
     TouchProducingServer::TouchTimings server_timings();
 
 private:
+    mir_test_framework::TemporaryEnvironmentValue touch_resampling;
     mir::test::Barrier client_ready_fence;
     TouchProducingServer server_configuration;
     TouchMeasuringClient client;
@@ -105,28 +105,13 @@ Results compute_frame_uniformity(std::vector<TouchSamples::Sample> const& result
     return {average_pixel_offset, uniformity};
 }
 
-}
-
-// Main is inside a test to work around mir_test_framework 'issues' (e.g. mir_test_framework contains
-// a main function).
-TEST(FrameUniformity, average_frame_offset)
+Results run_frame_uniformity_test(FrameUniformityTestParameters const& parameters, int run_count)
 {
-    geom::Size const screen_size{1024, 1024};
-    geom::Point const touch_start_point{0, 0};
-    geom::Point const touch_end_point{1024, 1024};
-    std::chrono::milliseconds touch_duration{1000};
-    
-    int const run_count = 1;
     double average_lag = 0, average_uniformity = 0;
 
-    // Ensure we load the correct platform libraries
-    setenv("MIR_CLIENT_PLATFORM_PATH",
-           (mtf::library_path() + "/client-modules").c_str(),
-           true);
-    
     for (int i = 0; i < run_count; i++)
     {
-        FrameUniformityTest t({screen_size, touch_start_point, touch_end_point, touch_duration});
+        FrameUniformityTest t(parameters);
 
         t.run_test();
   
@@ -135,17 +120,51 @@ TEST(FrameUniformity, average_frame_offset)
         auto touch_end_time = touch_timings.touch_end;
         auto samples = t.client_results()->get();
 
-        auto results = compute_frame_uniformity(samples, touch_start_point, touch_end_point,
+        auto results = compute_frame_uniformity(samples, parameters.touch_start, parameters.touch_end,
             touch_start_time, touch_end_time);
         
         average_lag += results.average_pixel_offset;
         average_uniformity += results.frame_uniformity;
     }
     
-    average_lag /= run_count;
-    average_uniformity /= run_count;
+    return {average_lag / run_count, average_uniformity / run_count};
+}
+
+void print(char const* title, Results const& results)
+{
+    std::cout << title << ":" << std::endl;
+    std::cout << "Average pixel lag: " << results.average_pixel_offset << "px" << std::endl;
+    std::cout << "Frame Uniformity (smaller scores are more uniform): " << results.frame_uniformity << "px per sample\n"
+        << std::endl;
+}
+
+}
+
+// Main is inside a test to work around mir_test_framework 'issues' (e.g. mir_test_framework contains
+// a main function).
+TEST(FrameUniformity, average_frame_offset)
+{
+    geom::Size const screen_size{1024, 1024};
+    geom::Point const touch_start_point{0, 0};
+    geom::Point const touch_end_point{1024, 1024};
+    std::chrono::milliseconds touch_duration{1000};
+    
+    int const run_count = 1;
+
+    // Ensure we load the correct platform libraries
+    setenv("MIR_CLIENT_PLATFORM_PATH",
+           (mtf::library_path() + "/client-modules").c_str(),
+           true);
     
-    std::cout << "Average pixel lag: " << average_lag << "px" << std::endl;
-    std::cout << "Frame Uniformity (smaller scores are more uniform): " << average_uniformity << "px per sample\n"
+    auto const raw = run_frame_uniformity_test(
+        {screen_size, touch_start_point, touch_end_point, touch_duration, false}, run_count);
+    auto const resampled = run_frame_uniformity_test(
+        {screen_size, touch_start_point, touch_end_point, touch_duration, true}, run_count);
+
+    print("Touches delivered as sampled", raw);
+    print("Touches resampled to vsync", resampled);
+
+    std::cout << "Frame Uniformity improvement from resampling: "
+        << raw.frame_uniformity - resampled.frame_uniformity << "px per sample\n"
         << std::endl;
 }
@@ -65,9 +65,9 @@ std::shared_ptr<mg::Platform> TouchProducingServer::the_graphics_platform()
     return graphics_platform;
 }
 
-void TouchProducingServer::synthesize_event_at(geom::Point const& point)
+void TouchProducingServer::synthesize_event_at(geom::Point const& point, mis::TouchParameters::Action action)
 {
-    touch_screen->emit_event(mis::a_touch_event().at_position(point));
+    touch_screen->emit_event(mis::a_touch_event().at_position(point).with_action(action));
 }
 
 void TouchProducingServer::thread_function()
@@ -82,6 +82,8 @@ void TouchProducingServer::thread_function()
     auto now = start;
 
     touch_start_time = std::chrono::high_resolution_clock::time_point::min();
+    auto action = mis::TouchParameters::Action::Tap;
+    auto point = touch_start;
     while (now < end)
     {
         std::this_thread::sleep_for(pause_between_events);
@@ -92,9 +94,12 @@ void TouchProducingServer::thread_function()
         touch_end_time = now;
         
         double alpha = (now.time_since_epoch().count()-start.time_since_epoch().count()) / static_cast<double>(end.time_since_epoch().count()-start.time_since_epoch().count());
-        auto point = touch_start + alpha*(touch_end-touch_start);
-        synthesize_event_at(point);
+        point = touch_start + alpha*(touch_end-touch_start);
+        synthesize_event_at(point, action);
+        action = mis::TouchParameters::Action::Move;
     }
+
+    synthesize_event_at(point, mis::TouchParameters::Action::Release);
 }
 
 TouchProducingServer::TouchTimings
@@ -27,6 +27,7 @@
 
 #include <chrono>
 #include <functional>
+#include <mutex>
 
 namespace mg = mir::graphics;
 namespace geom = mir::geometry;
@@ -59,6 +60,16 @@ struct StubDisplaySyncGroup : mg::DisplaySyncGroup
             std::this_thread::sleep_for(next_sync - now);
         
         last_sync = now;
+
+        std::lock_guard<std::mutex> lock{frame_mutex};
+        ++frame.msc;
+        frame.ust = mir::time::PosixTimestamp::now(CLOCK_MONOTONIC);
+    }
+
+    mg::Frame last_frame() const
+    {
+        std::lock_guard<std::mutex> lock{frame_mutex};
+        return frame;
     }
 
     std::chrono::milliseconds recommended_sleep() const override
@@ -71,6 +82,9 @@ struct StubDisplaySyncGroup : mg::DisplaySyncGroup
     std::chrono::high_resolution_clock::time_point last_sync;
 
     mtd::StubDisplayBuffer buffer;
+
+    std::mutex mutable frame_mutex;
+    mg::Frame frame;
 };
 
 struct StubDisplay : public mtd::StubDisplay
@@ -86,6 +100,12 @@ struct StubDisplay : public mtd::StubDisplay
         exec(group);
     }
 
+    // Lets the server align input resampling to the simulated vsync
+    mg::Frame last_frame_on(unsigned) const override
+    {
+        return group.last_frame();
+    }
+
     StubDisplaySyncGroup group;
 };
 
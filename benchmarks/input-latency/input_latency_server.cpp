@@ -0,0 +1,155 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "input_latency_server.h"
+#include "latency_recorder.h"
+
+#include "mir_test_framework/stub_server_platform_factory.h"
+#include "mir/frontend/connector.h"
+#include "mir/input/device_capability.h"
+#include "mir/input/input_device_hub.h"
+#include "mir/input/input_device_info.h"
+#include "mir/input/input_device_observer.h"
+#include "mir/raii.h"
+#include "mir/test/event_factory.h"
+#include "mir/test/signal.h"
+
+#include <linux/input.h>
+
+#include <thread>
+
+namespace mi = mir::input;
+namespace mis = mir::input::synthesis;
+namespace mtf = mir_test_framework;
+namespace geom = mir::geometry;
+
+namespace
+{
+int const device_count{3};
+
+// Where the touches are: the fake pointer starts in the middle too
+geom::Point const display_centre{800, 800};
+}
+
+InputLatencyServerConfiguration::InputLatencyServerConfiguration() :
+    keyboard{mtf::add_fake_input_device(mi::InputDeviceInfo{
+        "keyboard", "keyboard-uid", mi::DeviceCapability::keyboard | mi::DeviceCapability::alpha_numeric})},
+    pointer{mtf::add_fake_input_device(mi::InputDeviceInfo{
+        "mouse", "mouse-uid", mi::DeviceCapability::pointer})},
+    touch_screen{mtf::add_fake_input_device(mi::InputDeviceInfo{
+        "touch screen", "touch-screen-uid", mi::DeviceCapability::touchscreen | mi::DeviceCapability::multitouch})}
+{
+}
+
+bool InputLatencyServerConfiguration::wait_for_input_devices(std::chrono::nanoseconds timeout)
+{
+    struct DeviceCounter : mi::InputDeviceObserver
+    {
+        void device_added(std::shared_ptr<mi::Device> const&)   override { ++count_devices; }
+        void device_changed(std::shared_ptr<mi::Device> const&) override {}
+        void device_removed(std::shared_ptr<mi::Device> const&) override { --count_devices; }
+        void changes_complete() override
+        {
+            if (count_devices == device_count)
+                devices_available.raise();
+        }
+
+        int count_devices{0};
+        mir::test::Signal devices_available;
+    };
+
+    // The fake input devices are registered from within the input thread, as
+    // soon as the input manager starts.
+    auto const counter = std::make_shared<DeviceCounter>();
+    auto const hub = the_input_device_hub();
+
+    auto const register_counter = mir::raii::paired_calls(
+        [&]{ hub->add_observer(counter); },
+        [&]{ hub->remove_observer(counter); });
+
+    return counter->devices_available.wait_for(timeout);
+}
+
+void InputLatencyServerConfiguration::inject(InputKind kind, int count, double rate, LatencyRecorder& recorder)
+{
+    std::chrono::duration<double> const period{1.0 / rate};
+    auto const start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i != count; ++i)
+    {
+        std::this_thread::sleep_until(start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(i * period));
+
+        auto const event_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch());
+
+        recorder.injected(event_time);
+        emit(kind, i, count, event_time);
+    }
+}
+
+void InputLatencyServerConfiguration::emit(InputKind kind, int index, int count, std::chrono::nanoseconds event_time)
+{
+    bool const last{index == count - 1};
+    bool const odd{index % 2 != 0};
+
+    switch (kind)
+    {
+    case InputKind::key:
+        // Alternate presses and releases, finishing with a release (which is
+        // measured too, if it's one of the count)
+        keyboard->emit_event(mis::a_key_down_event()
+            .of_scancode(KEY_A)
+            .with_action(odd ? mis::EventAction::Up : mis::EventAction::Down)
+            .with_event_time(event_time));
+
+        if (last && !odd)
+            keyboard->emit_event(mis::a_key_up_event().of_scancode(KEY_A));
+        break;
+
+    case InputKind::pointer:
+        // Back and forth, to stay over the window
+        pointer->emit_event(mis::a_pointer_event()
+            .with_movement(odd ? -1 : 1, 0)
+            .with_event_time(event_time));
+        break;
+
+    case InputKind::touch:
+        touch_screen->emit_event(mis::a_touch_event()
+            .at_position(display_centre + geom::DeltaX{odd ? 1 : 0})
+            .with_action(
+                index == 0 ? mis::TouchParameters::Action::Tap :
+                last       ? mis::TouchParameters::Action::Release :
+                             mis::TouchParameters::Action::Move)
+            .with_event_time(event_time));
+
+        if (last && index == 0)
+            touch_screen->emit_event(mis::a_touch_event()
+                .at_position(display_centre)
+                .with_action(mis::TouchParameters::Action::Release));
+        break;
+    }
+}
+
+int InputLatencyServerConfiguration::wayland_client_fd()
+{
+    return the_wayland_connector()->client_socket_fd();
+}
+
+InputLatencyServerConfiguration& InputLatencyServer::server_config()
+{
+    return config;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef INPUT_LATENCY_SERVER_H_
+#define INPUT_LATENCY_SERVER_H_
+
+#include "latency_client.h"
+
+#include "mir_test_framework/fake_input_device.h"
+#include "mir_test_framework/fake_input_server_configuration.h"
+#include "mir_test_framework/server_runner.h"
+#include "mir/module_deleter.h"
+
+class LatencyRecorder;
+
+/// A server with a fake keyboard, pointer and touch screen, and a stubbed
+/// graphics platform.
+class InputLatencyServerConfiguration : public mir_test_framework::FakeInputServerConfiguration
+{
+public:
+    InputLatencyServerConfiguration();
+
+    /// Wait for the fake devices to be added to the server
+    /// \return false on timeout
+    bool wait_for_input_devices(std::chrono::nanoseconds timeout);
+
+    /// Inject count events of this kind, spaced evenly at rate per second,
+    /// reporting each to recorder (with its event time) just before it's
+    /// injected.
+    void inject(InputKind kind, int count, double rate, LatencyRecorder& recorder);
+
+    /// \return a socket for a new Wayland client
+    int wayland_client_fd();
+
+private:
+    void emit(InputKind kind, int index, int count, std::chrono::nanoseconds event_time);
+
+    mir::UniqueModulePtr<mir_test_framework::FakeInputDevice> const keyboard;
+    mir::UniqueModulePtr<mir_test_framework::FakeInputDevice> const pointer;
+    mir::UniqueModulePtr<mir_test_framework::FakeInputDevice> const touch_screen;
+};
+
+class InputLatencyServer : public mir_test_framework::ServerRunner
+{
+public:
+    InputLatencyServerConfiguration& server_config() override;
+
+private:
+    InputLatencyServerConfiguration config;
+};
+
+#endif // INPUT_LATENCY_SERVER_H_
@@ -0,0 +1,50 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "latency_client.h"
+#include "latency_recorder.h"
+
+bool LatencyClient::wait_until_ready(std::chrono::nanoseconds timeout)
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    return ready_cv.wait_for(lock, timeout, [this] { return is_ready; });
+}
+
+void LatencyClient::measure(InputKind kind, LatencyRecorder* recorder)
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    measured_kind = kind;
+    this->recorder = recorder;
+}
+
+void LatencyClient::ready()
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    is_ready = true;
+    ready_cv.notify_all();
+}
+
+void LatencyClient::received(InputKind kind, std::function<bool(std::chrono::nanoseconds)> const& has_event_time)
+{
+    // Before anything else, so we don't count our own overhead
+    auto const receipt_time = std::chrono::steady_clock::now().time_since_epoch();
+
+    std::lock_guard<std::mutex> lock{mutex};
+
+    if (recorder && kind == measured_kind)
+        recorder->received(receipt_time, has_event_time);
+}
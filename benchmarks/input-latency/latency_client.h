@@ -0,0 +1,71 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LATENCY_CLIENT_H_
+#define LATENCY_CLIENT_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+class LatencyRecorder;
+
+enum class InputKind
+{
+    key,
+    pointer,
+    touch
+};
+
+/// A client with a fullscreen window, that reports the events it receives
+/// to a LatencyRecorder.
+class LatencyClient
+{
+public:
+    virtual ~LatencyClient() = default;
+
+    /// Wait for the window to be focused
+    /// \return false on timeout
+    bool wait_until_ready(std::chrono::nanoseconds timeout);
+
+    /// Report events of this kind (and only these) to recorder, until the
+    /// next call (recorder may be null)
+    void measure(InputKind kind, LatencyRecorder* recorder);
+
+protected:
+    LatencyClient() = default;
+
+    /// The window has focus
+    void ready();
+
+    /// Called on receipt of an event: has_event_time(t) says whether it could
+    /// be the event injected with event time t
+    void received(InputKind kind, std::function<bool(std::chrono::nanoseconds)> const& has_event_time);
+
+private:
+    LatencyClient(LatencyClient const&) = delete;
+    LatencyClient& operator=(LatencyClient const&) = delete;
+
+    std::mutex mutex;
+    std::condition_variable ready_cv;
+    bool is_ready{false};
+    InputKind measured_kind{InputKind::key};
+    LatencyRecorder* recorder{nullptr};
+};
+
+#endif // LATENCY_CLIENT_H_
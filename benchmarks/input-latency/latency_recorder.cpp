@@ -0,0 +1,60 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "latency_recorder.h"
+
+void LatencyRecorder::injected(std::chrono::nanoseconds event_time)
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    outstanding.push_back(event_time);
+    ++injected_count;
+}
+
+void LatencyRecorder::received(
+    std::chrono::nanoseconds receipt_time,
+    std::function<bool(std::chrono::nanoseconds)> const& has_event_time)
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    for (auto event = begin(outstanding); event != end(outstanding); ++event)
+    {
+        if (has_event_time(*event))
+        {
+            latencies.push_back(receipt_time - *event);
+            lost += event - begin(outstanding);
+            outstanding.erase(begin(outstanding), event + 1);
+
+            if (outstanding.empty())
+                cv.notify_all();
+            return;
+        }
+    }
+
+    // Not an event we injected (or one we've given up on): ignore it
+}
+
+bool LatencyRecorder::wait_for_outstanding(std::chrono::nanoseconds timeout)
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    return cv.wait_for(lock, timeout, [this] { return outstanding.empty(); });
+}
+
+auto LatencyRecorder::results() -> Results
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    return {injected_count, lost + static_cast<int>(outstanding.size()), latencies};
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LATENCY_RECORDER_H_
+#define LATENCY_RECORDER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/// Matches the events a client receives to the events injected, and records
+/// the latency between them.
+///
+/// Events are delivered in the order they were injected, so each received
+/// event is matched to the oldest injected event with the same time. (The
+/// client may only see a truncated time: Wayland's are in milliseconds.)
+/// Injected events skipped over by the match are counted as lost.
+class LatencyRecorder
+{
+public:
+    struct Results
+    {
+        int injected;
+        int lost;
+        std::vector<std::chrono::nanoseconds> latencies;
+    };
+
+    /// An event with this event time is about to be injected
+    void injected(std::chrono::nanoseconds event_time);
+
+    /// A client received an event; has_event_time(t) says whether it could
+    /// be the event injected with event time t
+    void received(
+        std::chrono::nanoseconds receipt_time,
+        std::function<bool(std::chrono::nanoseconds)> const& has_event_time);
+
+    /// Wait for the events injected so far to be received
+    /// \return false if some are still outstanding at the timeout
+    bool wait_for_outstanding(std::chrono::nanoseconds timeout);
+
+    auto results() -> Results;
+
+private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::chrono::nanoseconds> outstanding;
+    int injected_count{0};
+    int lost{0};
+    std::vector<std::chrono::nanoseconds> latencies;
+};
+
+#endif // LATENCY_RECORDER_H_
@@ -0,0 +1,172 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "input_latency_server.h"
+#include "latency_recorder.h"
+#include "mir_latency_client.h"
+#include "wayland_latency_client.h"
+
+#include "mir/report_exception.h"
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+using namespace std::chrono;
+
+namespace
+{
+double in_ms(nanoseconds time)
+{
+    return duration<double, std::milli>{time}.count();
+}
+
+nanoseconds percentile(std::vector<nanoseconds> times, double fraction)
+{
+    auto const n = std::min(times.size() - 1, static_cast<size_t>(fraction * times.size()));
+    std::nth_element(begin(times), begin(times) + n, end(times));
+    return times[n];
+}
+
+char const* name_of(InputKind kind)
+{
+    switch (kind)
+    {
+    case InputKind::key:     return "key";
+    case InputKind::pointer: return "pointer";
+    case InputKind::touch:   return "touch";
+    }
+
+    return "?";
+}
+
+void print(std::string const& client, InputKind kind, LatencyRecorder::Results const& results)
+{
+    printf("%-8s %-8s %8d %8d", client.c_str(), name_of(kind), results.injected, results.lost);
+
+    auto const& latencies = results.latencies;
+    if (latencies.empty())
+    {
+        printf(" %8s %8s %8s %8s\n", "-", "-", "-", "-");
+        return;
+    }
+
+    printf(" %8.3f %8.3f %8.3f %8.3f\n",
+        in_ms(percentile(latencies, 0.5)),
+        in_ms(percentile(latencies, 0.9)),
+        in_ms(percentile(latencies, 0.99)),
+        in_ms(*std::max_element(begin(latencies), end(latencies))));
+}
+}
+
+int main(int argc, char* argv[])
+try
+{
+    po::options_description desc("Mir input latency benchmark");
+    desc.add_options()
+        ("help", "this help message")
+        ("count", po::value<int>()->default_value(1000), "events of each kind to inject")
+        ("rate", po::value<double>()->default_value(500), "events injected per second")
+        ("client", po::value<std::string>()->default_value("all"), "client to measure: all, wayland or mir");
+
+    po::variables_map options;
+    po::store(po::parse_command_line(argc, argv, desc), options);
+    po::notify(options);
+
+    if (options.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    auto const count = options["count"].as<int>();
+    auto const rate = options["rate"].as<double>();
+    auto const client_option = options["client"].as<std::string>();
+
+    if (count < 1 || rate <= 0)
+        throw std::runtime_error{"--count and --rate must be positive"};
+
+    if (client_option != "all" && client_option != "wayland" && client_option != "mir")
+        throw std::runtime_error{"Unknown client: " + client_option};
+
+    // Repeated keys would be taken for (late) injected ones
+    setenv("MIR_SERVER_ENABLE_KEY_REPEAT", "false", true);
+
+    InputLatencyServer server;
+    server.start_server();
+
+    auto& config = server.server_config();
+    if (!config.wait_for_input_devices(seconds{5}))
+        throw std::runtime_error{"Timed out waiting for the fake input devices"};
+
+    bool failed{false};
+
+    printf("%-8s %-8s %8s %8s %8s %8s %8s %8s\n",
+        "client", "input", "injected", "lost", "p50 ms", "p90 ms", "p99 ms", "max ms");
+
+    for (std::string const client_name : {"wayland", "mir"})
+    {
+        if (client_option != "all" && client_option != client_name)
+            continue;
+
+        std::unique_ptr<LatencyClient> client;
+        if (client_name == "wayland")
+            client = std::make_unique<WaylandLatencyClient>(config.wayland_client_fd());
+        else
+            client = std::make_unique<MirLatencyClient>(server.new_connection());
+
+        if (!client->wait_until_ready(seconds{5}))
+        {
+            std::cerr << "Timed out waiting for the " << client_name << " client's window to be focused" << std::endl;
+            failed = true;
+            continue;
+        }
+
+        for (auto const kind : {InputKind::key, InputKind::pointer, InputKind::touch})
+        {
+            LatencyRecorder recorder;
+
+            client->measure(kind, &recorder);
+            config.inject(kind, count, rate, recorder);
+            recorder.wait_for_outstanding(seconds{2});
+            client->measure(kind, nullptr);
+
+            auto const results = recorder.results();
+            print(client_name, kind, results);
+
+            if (results.latencies.empty())
+                failed = true;
+        }
+    }
+
+    server.stop_server();
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+catch (...)
+{
+    mir::report_exception(std::cerr);
+    return EXIT_FAILURE;
+}
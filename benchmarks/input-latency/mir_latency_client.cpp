@@ -0,0 +1,131 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "mir_latency_client.h"
+
+#include <boost/throw_exception.hpp>
+
+#include <stdexcept>
+
+namespace
+{
+void null_lifecycle_callback(MirConnection*, MirLifecycleState, void*)
+{
+}
+}
+
+MirLatencyClient::MirLatencyClient(std::string const& connect_string) :
+    connection{mir_connect_sync(connect_string.c_str(), "input-latency")}
+{
+    if (!mir_connection_is_valid(connection))
+    {
+        std::string const error{mir_connection_get_error_message(connection)};
+        mir_connection_release(connection);
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Connection to Mir failed: " + error});
+    }
+
+    /*
+     * Set a null callback to avoid killing the process
+     * (default callback raises SIGHUP).
+     */
+    mir_connection_set_lifecycle_event_callback(connection, null_lifecycle_callback, nullptr);
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+    MirPixelFormat pixel_format;
+    unsigned int valid_formats;
+    mir_connection_get_available_surface_formats(connection, &pixel_format, 1, &valid_formats);
+
+    auto const spec = mir_create_normal_window_spec(connection, 640, 480);
+    mir_window_spec_set_pixel_format(spec, pixel_format);
+    mir_window_spec_set_name(spec, "input-latency");
+    mir_window_spec_set_state(spec, mir_window_state_fullscreen);
+    mir_window_spec_set_event_handler(spec, &handle_event, this);
+
+    window = mir_create_window_sync(spec);
+    mir_window_spec_release(spec);
+
+    if (!mir_window_is_valid(window))
+    {
+        std::string const error{mir_window_get_error_message(window)};
+        mir_window_release_sync(window);
+        mir_connection_release(connection);
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Window creation failed: " + error});
+    }
+
+    // The window isn't shown (or focused) until it has content
+    mir_buffer_stream_swap_buffers_sync(mir_window_get_buffer_stream(window));
+#pragma GCC diagnostic pop
+}
+
+MirLatencyClient::~MirLatencyClient()
+{
+    mir_window_release_sync(window);
+    mir_connection_release(connection);
+}
+
+void MirLatencyClient::handle_event(MirWindow*, MirEvent const* event, void* context)
+{
+    auto const self = static_cast<MirLatencyClient*>(context);
+
+    switch (mir_event_get_type(event))
+    {
+    case mir_event_type_input:
+        self->handle_input(mir_event_get_input_event(event));
+        break;
+
+    case mir_event_type_window:
+    {
+        auto const window_event = mir_event_get_window_event(event);
+        if (mir_window_event_get_attribute(window_event) == mir_window_attrib_focus &&
+            mir_window_event_get_attribute_value(window_event) == mir_window_focus_state_focused)
+        {
+            self->ready();
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+void MirLatencyClient::handle_input(MirInputEvent const* event)
+{
+    std::chrono::nanoseconds const event_time{mir_input_event_get_event_time(event)};
+    auto const has_event_time = [event_time](std::chrono::nanoseconds time) { return time == event_time; };
+
+    switch (mir_input_event_get_type(event))
+    {
+    case mir_input_event_type_key:
+        if (mir_keyboard_event_action(mir_input_event_get_keyboard_event(event)) != mir_keyboard_action_repeat)
+            received(InputKind::key, has_event_time);
+        break;
+
+    case mir_input_event_type_pointer:
+        if (mir_pointer_event_action(mir_input_event_get_pointer_event(event)) == mir_pointer_action_motion)
+            received(InputKind::pointer, has_event_time);
+        break;
+
+    case mir_input_event_type_touch:
+        received(InputKind::touch, has_event_time);
+        break;
+
+    default:
+        break;
+    }
+}
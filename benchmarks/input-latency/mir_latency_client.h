@@ -0,0 +1,42 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef MIR_LATENCY_CLIENT_H_
+#define MIR_LATENCY_CLIENT_H_
+
+#include "latency_client.h"
+
+#include "mir_toolkit/mir_client_library.h"
+
+#include <string>
+
+/// A mirclient client
+class MirLatencyClient : public LatencyClient
+{
+public:
+    explicit MirLatencyClient(std::string const& connect_string);
+    ~MirLatencyClient();
+
+private:
+    static void handle_event(MirWindow* window, MirEvent const* event, void* context);
+    void handle_input(MirInputEvent const* event);
+
+    MirConnection* const connection;
+    MirWindow* window;
+};
+
+#endif // MIR_LATENCY_CLIENT_H_
@@ -0,0 +1,263 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "wayland_latency_client.h"
+
+#include <boost/throw_exception.hpp>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+// The shell makes the window fullscreen: the buffer needn't match
+int const width{64};
+int const height{64};
+
+auto self(void* data) -> WaylandLatencyClient*
+{
+    return static_cast<WaylandLatencyClient*>(data);
+}
+}
+
+wl_registry_listener const WaylandLatencyClient::registry_listener = []
+    {
+        wl_registry_listener listener{};
+
+        listener.global = [](void* data, wl_registry* registry, uint32_t name, char const* interface, uint32_t version)
+            {
+                auto const client = self(data);
+
+                if (strcmp(interface, wl_compositor_interface.name) == 0)
+                {
+                    client->compositor = static_cast<wl_compositor*>(
+                        wl_registry_bind(registry, name, &wl_compositor_interface, 1));
+                }
+                else if (strcmp(interface, wl_shm_interface.name) == 0)
+                {
+                    client->shm = static_cast<wl_shm*>(wl_registry_bind(registry, name, &wl_shm_interface, 1));
+                }
+                else if (strcmp(interface, wl_shell_interface.name) == 0)
+                {
+                    client->shell = static_cast<wl_shell*>(wl_registry_bind(registry, name, &wl_shell_interface, 1));
+                }
+                else if (strcmp(interface, wl_seat_interface.name) == 0 && !client->seat)
+                {
+                    client->seat = static_cast<wl_seat*>(
+                        wl_registry_bind(registry, name, &wl_seat_interface, std::min(version, 4u)));
+                    wl_seat_add_listener(client->seat, &seat_listener, client);
+                }
+            };
+        listener.global_remove = [](void*, wl_registry*, uint32_t) {};
+
+        return listener;
+    }();
+
+wl_seat_listener const WaylandLatencyClient::seat_listener = []
+    {
+        wl_seat_listener listener{};
+
+        listener.capabilities = [](void* data, wl_seat* seat, uint32_t capabilities)
+            {
+                auto const client = self(data);
+
+                if ((capabilities & WL_SEAT_CAPABILITY_KEYBOARD) && !client->keyboard)
+                {
+                    client->keyboard = wl_seat_get_keyboard(seat);
+                    wl_keyboard_add_listener(client->keyboard, &keyboard_listener, client);
+                }
+
+                if ((capabilities & WL_SEAT_CAPABILITY_POINTER) && !client->pointer)
+                {
+                    client->pointer = wl_seat_get_pointer(seat);
+                    wl_pointer_add_listener(client->pointer, &pointer_listener, client);
+                }
+
+                if ((capabilities & WL_SEAT_CAPABILITY_TOUCH) && !client->touch)
+                {
+                    client->touch = wl_seat_get_touch(seat);
+                    wl_touch_add_listener(client->touch, &touch_listener, client);
+                }
+            };
+        listener.name = [](void*, wl_seat*, char const*) {};
+
+        return listener;
+    }();
+
+wl_shell_surface_listener const WaylandLatencyClient::shell_surface_listener = []
+    {
+        wl_shell_surface_listener listener{};
+
+        listener.ping = [](void*, wl_shell_surface* shell_surface, uint32_t serial)
+            {
+                wl_shell_surface_pong(shell_surface, serial);
+            };
+        listener.configure = [](void*, wl_shell_surface*, uint32_t, int32_t, int32_t) {};
+        listener.popup_done = [](void*, wl_shell_surface*) {};
+
+        return listener;
+    }();
+
+wl_keyboard_listener const WaylandLatencyClient::keyboard_listener = []
+    {
+        wl_keyboard_listener listener{};
+
+        listener.keymap = [](void*, wl_keyboard*, uint32_t, int32_t fd, uint32_t) { close(fd); };
+        listener.enter = [](void* data, wl_keyboard*, uint32_t, wl_surface*, wl_array*) { self(data)->ready(); };
+        listener.leave = [](void*, wl_keyboard*, uint32_t, wl_surface*) {};
+        listener.key = [](void* data, wl_keyboard*, uint32_t, uint32_t time, uint32_t, uint32_t)
+            {
+                self(data)->received_at(InputKind::key, time);
+            };
+        listener.modifiers = [](void*, wl_keyboard*, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t) {};
+        listener.repeat_info = [](void*, wl_keyboard*, int32_t, int32_t) {};
+
+        return listener;
+    }();
+
+wl_pointer_listener const WaylandLatencyClient::pointer_listener = []
+    {
+        wl_pointer_listener listener{};
+
+        listener.enter = [](void*, wl_pointer*, uint32_t, wl_surface*, wl_fixed_t, wl_fixed_t) {};
+        listener.leave = [](void*, wl_pointer*, uint32_t, wl_surface*) {};
+        listener.motion = [](void* data, wl_pointer*, uint32_t time, wl_fixed_t, wl_fixed_t)
+            {
+                self(data)->received_at(InputKind::pointer, time);
+            };
+        listener.button = [](void*, wl_pointer*, uint32_t, uint32_t, uint32_t, uint32_t) {};
+        listener.axis = [](void*, wl_pointer*, uint32_t, uint32_t, wl_fixed_t) {};
+
+        return listener;
+    }();
+
+wl_touch_listener const WaylandLatencyClient::touch_listener = []
+    {
+        wl_touch_listener listener{};
+
+        listener.down = [](void* data, wl_touch*, uint32_t, uint32_t time, wl_surface*, int32_t, wl_fixed_t, wl_fixed_t)
+            {
+                self(data)->received_at(InputKind::touch, time);
+            };
+        listener.up = [](void* data, wl_touch*, uint32_t, uint32_t time, int32_t)
+            {
+                self(data)->received_at(InputKind::touch, time);
+            };
+        listener.motion = [](void* data, wl_touch*, uint32_t time, int32_t, wl_fixed_t, wl_fixed_t)
+            {
+                self(data)->received_at(InputKind::touch, time);
+            };
+        listener.frame = [](void*, wl_touch*) {};
+        listener.cancel = [](void*, wl_touch*) {};
+
+        return listener;
+    }();
+
+WaylandLatencyClient::WaylandLatencyClient(int fd) :
+    display{wl_display_connect_to_fd(fd)},
+    buffer_file{width * height * 4},
+    stop_signal{eventfd(0, EFD_CLOEXEC)}
+{
+    if (!display)
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Failed to connect to Wayland server"});
+
+    registry = wl_display_get_registry(display);
+    wl_registry_add_listener(registry, &registry_listener, this);
+    wl_display_roundtrip(display);  // For the globals
+    wl_display_roundtrip(display);  // For the seat's capabilities
+
+    if (!compositor || !shm || !shell || !seat)
+    {
+        wl_display_disconnect(display);
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Wayland server lacks wl_compositor, wl_shm, wl_shell or wl_seat"});
+    }
+
+    surface = wl_compositor_create_surface(compositor);
+    shell_surface = wl_shell_get_shell_surface(shell, surface);
+    wl_shell_surface_add_listener(shell_surface, &shell_surface_listener, this);
+    wl_shell_surface_set_fullscreen(shell_surface, WL_SHELL_SURFACE_FULLSCREEN_METHOD_DEFAULT, 0, nullptr);
+
+    auto const pool = wl_shm_create_pool(shm, buffer_file.fd(), width * height * 4);
+    buffer = wl_shm_pool_create_buffer(pool, 0, width, height, width * 4, WL_SHM_FORMAT_ARGB8888);
+    wl_shm_pool_destroy(pool);
+
+    // The window isn't shown (or focused) until it has content
+    wl_surface_attach(surface, buffer, 0, 0);
+    wl_surface_commit(surface);
+    wl_display_flush(display);
+
+    dispatcher = std::thread{[this] { dispatch_until_stopped(); }};
+}
+
+WaylandLatencyClient::~WaylandLatencyClient()
+{
+    eventfd_write(stop_signal, 1);
+    dispatcher.join();
+
+    if (touch) wl_touch_destroy(touch);
+    if (pointer) wl_pointer_destroy(pointer);
+    if (keyboard) wl_keyboard_destroy(keyboard);
+    wl_buffer_destroy(buffer);
+    wl_shell_surface_destroy(shell_surface);
+    wl_surface_destroy(surface);
+    wl_seat_destroy(seat);
+    wl_shell_destroy(shell);
+    wl_shm_destroy(shm);
+    wl_compositor_destroy(compositor);
+    wl_registry_destroy(registry);
+    wl_display_disconnect(display);
+}
+
+void WaylandLatencyClient::dispatch_until_stopped()
+{
+    for (;;)
+    {
+        while (wl_display_prepare_read(display) != 0)
+            wl_display_dispatch_pending(display);
+        wl_display_flush(display);
+
+        pollfd fds[2] = {{wl_display_get_fd(display), POLLIN, 0}, {stop_signal, POLLIN, 0}};
+        if (poll(fds, 2, -1) < 0 || (fds[0].revents & (POLLERR | POLLHUP)))
+        {
+            wl_display_cancel_read(display);
+            break;
+        }
+
+        if (fds[0].revents & POLLIN)
+            wl_display_read_events(display);
+        else
+            wl_display_cancel_read(display);
+
+        wl_display_dispatch_pending(display);
+
+        if (fds[1].revents & POLLIN)
+            break;
+    }
+}
+
+void WaylandLatencyClient::received_at(InputKind kind, uint32_t time)
+{
+    received(kind, [time](std::chrono::nanoseconds event_time)
+        {
+            return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(event_time).count()) == time;
+        });
+}
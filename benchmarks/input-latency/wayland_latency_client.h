@@ -0,0 +1,70 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WAYLAND_LATENCY_CLIENT_H_
+#define WAYLAND_LATENCY_CLIENT_H_
+
+#include "latency_client.h"
+
+#include "mir/anonymous_shm_file.h"
+#include "mir/fd.h"
+
+#include <wayland-client.h>
+
+#include <thread>
+
+/// A Wayland client, using wl_shell
+class WaylandLatencyClient : public LatencyClient
+{
+public:
+    /// \param fd   a client socket of the server's Wayland connector
+    explicit WaylandLatencyClient(int fd);
+    ~WaylandLatencyClient();
+
+private:
+    static wl_registry_listener const registry_listener;
+    static wl_seat_listener const seat_listener;
+    static wl_shell_surface_listener const shell_surface_listener;
+    static wl_keyboard_listener const keyboard_listener;
+    static wl_pointer_listener const pointer_listener;
+    static wl_touch_listener const touch_listener;
+
+    void dispatch_until_stopped();
+
+    // Wayland times are in milliseconds, and wrap
+    void received_at(InputKind kind, uint32_t time);
+
+    wl_display* const display;
+    wl_registry* registry{nullptr};
+    wl_compositor* compositor{nullptr};
+    wl_shm* shm{nullptr};
+    wl_shell* shell{nullptr};
+    wl_seat* seat{nullptr};
+    wl_keyboard* keyboard{nullptr};
+    wl_pointer* pointer{nullptr};
+    wl_touch* touch{nullptr};
+
+    wl_surface* surface{nullptr};
+    wl_shell_surface* shell_surface{nullptr};
+    mir::AnonymousShmFile buffer_file;
+    wl_buffer* buffer{nullptr};
+
+    mir::Fd const stop_signal;
+    std::thread dispatcher;
+};
+
+#endif // WAYLAND_LATENCY_CLIENT_H_
@@ -0,0 +1,92 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/events/event_builders.h"
+#include "mir/events/event_private.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace mev = mir::events;
+
+namespace
+{
+std::vector<uint8_t> const cookie(32, 0xc0);
+
+auto make_key_event() -> mir::EventUPtr
+{
+    return mev::make_event(
+        MirInputDeviceId{7}, std::chrono::nanoseconds{1000}, cookie,
+        mir_keyboard_action_down, 0x61, 30, mir_input_event_modifier_none);
+}
+
+auto make_pointer_event() -> mir::EventUPtr
+{
+    return mev::make_event(
+        MirInputDeviceId{8}, std::chrono::nanoseconds{1000}, cookie, mir_input_event_modifier_none,
+        mir_pointer_action_motion, 0, 100.0f, 200.0f, 0.0f, 0.0f, 1.0f, -1.0f);
+}
+
+auto make_touch_event() -> mir::EventUPtr
+{
+    auto event = mev::make_event(
+        MirInputDeviceId{9}, std::chrono::nanoseconds{1000}, cookie, mir_input_event_modifier_none);
+    mev::add_touch(*event, 0, mir_touch_action_change, mir_touch_tooltype_finger,
+        100.0f, 200.0f, 1.0f, 5.0f, 5.0f, 5.0f);
+    mev::add_touch(*event, 1, mir_touch_action_change, mir_touch_tooltype_finger,
+        300.0f, 400.0f, 1.0f, 5.0f, 5.0f, 5.0f);
+    return event;
+}
+
+template<typename Make>
+void build(benchmark::State& state, Make make)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(make());
+}
+
+template<typename Make>
+void serialize(benchmark::State& state, Make make)
+{
+    auto const event = make();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(MirEvent::serialize(event.get()));
+}
+
+template<typename Make>
+void deserialize(benchmark::State& state, Make make)
+{
+    auto const bytes = MirEvent::serialize(make().get());
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(MirEvent::deserialize(bytes));
+
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+}
+
+BENCHMARK_CAPTURE(build, key_event, make_key_event);
+BENCHMARK_CAPTURE(build, pointer_event, make_pointer_event);
+BENCHMARK_CAPTURE(build, touch_event, make_touch_event);
+BENCHMARK_CAPTURE(serialize, key_event, make_key_event);
+BENCHMARK_CAPTURE(serialize, pointer_event, make_pointer_event);
+BENCHMARK_CAPTURE(serialize, touch_event, make_touch_event);
+BENCHMARK_CAPTURE(deserialize, key_event, make_key_event);
+BENCHMARK_CAPTURE(deserialize, pointer_event, make_pointer_event);
+BENCHMARK_CAPTURE(deserialize, touch_event, make_touch_event);
@@ -0,0 +1,90 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/geometry/rectangles.h"
+
+#include <benchmark/benchmark.h>
+
+namespace geom = mir::geometry;
+
+namespace
+{
+// A row of outputs, as a multi-monitor setup lays them out
+auto outputs(int count) -> geom::Rectangles
+{
+    geom::Rectangles rectangles;
+    for (int i = 0; i != count; ++i)
+        rectangles.add({{i * 1920, 0}, {1920, 1080}});
+    return rectangles;
+}
+}
+
+static void rectangles_add_remove(benchmark::State& state)
+{
+    auto const count = state.range(0);
+
+    for (auto _ : state)
+    {
+        geom::Rectangles rectangles;
+        for (int i = 0; i != count; ++i)
+            rectangles.add({{i * 1920, 0}, {1920, 1080}});
+        for (int i = 0; i != count; ++i)
+            rectangles.remove({{i * 1920, 0}, {1920, 1080}});
+        benchmark::DoNotOptimize(rectangles);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(rectangles_add_remove)->Arg(1)->Arg(4)->Arg(16);
+
+static void rectangles_bounding_rectangle(benchmark::State& state)
+{
+    auto const rectangles = outputs(state.range(0));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rectangles.bounding_rectangle());
+}
+BENCHMARK(rectangles_bounding_rectangle)->Arg(1)->Arg(4)->Arg(16);
+
+static void rectangles_confine(benchmark::State& state)
+{
+    auto const rectangles = outputs(state.range(0));
+    int x{0};
+
+    for (auto _ : state)
+    {
+        // Alternate between points inside and outside the outputs
+        geom::Point point{x, (x & 1) ? 2000 : 500};
+        rectangles.confine(point);
+        benchmark::DoNotOptimize(point);
+        x = (x + 997) % (1920 * state.range(0) + 1000);
+    }
+}
+BENCHMARK(rectangles_confine)->Arg(1)->Arg(4)->Arg(16);
+
+static void rectangle_intersection(benchmark::State& state)
+{
+    geom::Rectangle const output{{0, 0}, {1920, 1080}};
+    geom::Rectangle window{{-100, -100}, {640, 480}};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(output.intersection_with(window));
+        benchmark::DoNotOptimize(output.contains(window));
+        window.top_left = {(window.top_left.x.as_int() + 37) % 2000, (window.top_left.y.as_int() + 23) % 1200};
+    }
+}
+BENCHMARK(rectangle_intersection);
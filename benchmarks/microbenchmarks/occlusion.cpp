@@ -0,0 +1,59 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/geometry/rectangle.h"
+#include "src/server/compositor/occlusion.h"
+#include "mir/test/doubles/fake_renderable.h"
+#include "mir/test/doubles/stub_scene_element.h"
+
+#include <benchmark/benchmark.h>
+
+namespace mc = mir::compositor;
+namespace geom = mir::geometry;
+namespace mtd = mir::test::doubles;
+
+namespace
+{
+geom::Rectangle const output{{0, 0}, {1920, 1080}};
+
+// Cascaded windows, every fourth one translucent, some partly off screen
+auto cascade(int count) -> mc::SceneElementSequence
+{
+    mc::SceneElementSequence elements;
+    for (int i = 0; i != count; ++i)
+    {
+        geom::Rectangle const area{{(i * 53) % 1800 - 100, (i * 31) % 1000 - 50}, {640, 480}};
+        elements.push_back(std::make_shared<mtd::StubSceneElement>(
+            std::make_shared<mtd::FakeRenderable>(area, i % 4 ? 1.0f : 0.5f)));
+    }
+    return elements;
+}
+}
+
+// Includes copying the sequence, which filter_occlusions_from() modifies
+static void filter_occlusions_from(benchmark::State& state)
+{
+    auto const elements = cascade(state.range(0));
+
+    for (auto _ : state)
+    {
+        auto list = elements;
+        benchmark::DoNotOptimize(mc::filter_occlusions_from(list, output));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(filter_occlusions_from)->RangeMultiplier(4)->Range(1, 256);
@@ -0,0 +1,51 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/recursive_read_write_mutex.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace
+{
+mir::RecursiveReadWriteMutex mutex;
+uint64_t shared_value{0};
+}
+
+// Range: reads per write (0 for reads only)
+static void recursive_read_write_mutex(benchmark::State& state)
+{
+    auto const reads_per_write = state.range(0);
+    int64_t n{0};
+
+    for (auto _ : state)
+    {
+        if (reads_per_write && ++n % reads_per_write == 0)
+        {
+            mir::RecursiveWriteLock lock{mutex};
+            ++shared_value;
+        }
+        else
+        {
+            mir::RecursiveReadLock lock{mutex};
+            // Recursion is common in Mir's use of the mutex
+            mir::RecursiveReadLock recursive_lock{mutex};
+            benchmark::DoNotOptimize(shared_value);
+        }
+    }
+}
+BENCHMARK(recursive_read_write_mutex)->Arg(0)->Arg(100)->Arg(10)->ThreadRange(1, 8)->UseRealTime();
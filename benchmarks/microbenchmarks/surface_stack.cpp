@@ -0,0 +1,52 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/server/scene/surface_stack.h"
+#include "src/server/scene/basic_surface.h"
+#include "src/server/report/null_report_factory.h"
+#include "mir/test/doubles/stub_buffer_stream.h"
+
+#include <benchmark/benchmark.h>
+
+namespace ms = mir::scene;
+namespace mr = mir::report;
+namespace geom = mir::geometry;
+namespace mtd = mir::test::doubles;
+
+static void surface_stack_scene_elements_for(benchmark::State& state)
+{
+    auto const report = mr::null_scene_report();
+    ms::SurfaceStack stack{report};
+
+    for (int i = 0; i != state.range(0); ++i)
+    {
+        auto const surface = std::make_shared<ms::BasicSurface>(
+            "surface",
+            geom::Rectangle{{(i * 53) % 1800, (i * 31) % 1000}, {640, 480}},
+            mir_pointer_unconfined,
+            std::list<ms::StreamInfo>{{std::make_shared<mtd::StubBufferStream>(), {}, {}}},
+            std::shared_ptr<mir::graphics::CursorImage>{},
+            report);
+        stack.add_surface(surface, mir::input::InputReceptionMode::normal);
+    }
+
+    int const compositor{0};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(stack.scene_elements_for(&compositor));
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(surface_stack_scene_elements_for)->RangeMultiplier(4)->Range(1, 1024);
@@ -0,0 +1,51 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/thread_safe_list.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace
+{
+struct Observer
+{
+    int calls{0};
+};
+
+// Shared by all threads of a multithreaded run
+std::unique_ptr<mir::ThreadSafeList<std::shared_ptr<Observer>>> list;
+}
+
+static void thread_safe_list_for_each(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        list = std::make_unique<mir::ThreadSafeList<std::shared_ptr<Observer>>>();
+        for (int i = 0; i != state.range(0); ++i)
+            list->add(std::make_shared<Observer>());
+    }
+
+    for (auto _ : state)
+        list->for_each([](std::shared_ptr<Observer> const& observer) { benchmark::DoNotOptimize(observer->calls); });
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+    if (state.thread_index() == 0)
+        list.reset();
+}
+BENCHMARK(thread_safe_list_for_each)->Arg(1)->Arg(8)->Arg(64)->ThreadRange(1, 8)->UseRealTime();
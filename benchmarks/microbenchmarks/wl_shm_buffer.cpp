@@ -0,0 +1,145 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/server/frontend_wayland/wlshmbuffer.h"
+#include "mir/anonymous_shm_file.h"
+
+#include <wayland-client.h>
+#include <benchmark/benchmark.h>
+
+#include <sys/socket.h>
+
+#include <atomic>
+#include <cstring>
+#include <system_error>
+#include <thread>
+
+namespace mf = mir::frontend;
+namespace mrs = mir::renderer::software;
+
+namespace
+{
+/// A wl_shm buffer, created by an in-process client of an in-process
+/// Wayland server. The client keeps reading the events sent to it (such as
+/// the buffer releases) until the server disconnects it.
+class ShmBuffer
+{
+public:
+    ShmBuffer(int width, int height) :
+        server{wl_display_create()},
+        file{static_cast<size_t>(width * height * 4)}
+    {
+        wl_display_init_shm(server);
+
+        int fds[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0)
+            throw std::system_error{errno, std::system_category(), "Failed to create socket pair"};
+
+        client = wl_client_create(server, fds[0]);
+        client_display = wl_display_connect_to_fd(fds[1]);
+
+        std::atomic<bool> created{false};
+        client_thread = std::thread{[&]
+            {
+                create_buffer(width, height);
+                created = true;
+
+                while (wl_display_dispatch(client_display) != -1)
+                    ;
+            }};
+
+        // Serve the client's requests until its buffer exists
+        auto const loop = wl_display_get_event_loop(server);
+        while (!created)
+        {
+            wl_display_flush_clients(server);
+            wl_event_loop_dispatch(loop, 10);
+        }
+
+        resource = wl_client_get_object(client, wl_proxy_get_id(reinterpret_cast<wl_proxy*>(buffer)));
+    }
+
+    ~ShmBuffer()
+    {
+        wl_client_destroy(client);
+        client_thread.join();
+
+        wl_buffer_destroy(buffer);
+        wl_shm_pool_destroy(pool);
+        wl_proxy_destroy(reinterpret_cast<wl_proxy*>(shm));
+        wl_registry_destroy(registry);
+        wl_display_disconnect(client_display);
+
+        wl_display_destroy(server);
+    }
+
+    wl_resource* resource;
+
+private:
+    void create_buffer(int width, int height)
+    {
+        static wl_registry_listener const registry_listener{
+            [](void* self, wl_registry* registry, uint32_t name, char const* interface, uint32_t)
+            {
+                if (strcmp(interface, wl_shm_interface.name) == 0)
+                {
+                    static_cast<ShmBuffer*>(self)->shm =
+                        static_cast<wl_shm*>(wl_registry_bind(registry, name, &wl_shm_interface, 1));
+                }
+            },
+            [](void*, wl_registry*, uint32_t) {}
+        };
+
+        registry = wl_display_get_registry(client_display);
+        wl_registry_add_listener(registry, &registry_listener, this);
+        wl_display_roundtrip(client_display);
+
+        pool = wl_shm_create_pool(shm, file.fd(), width * height * 4);
+        buffer = wl_shm_pool_create_buffer(pool, 0, width, height, width * 4, WL_SHM_FORMAT_ARGB8888);
+        wl_display_roundtrip(client_display);
+    }
+
+    wl_display* const server;
+    wl_client* client;
+
+    mir::AnonymousShmFile const file;
+    wl_display* client_display;
+    wl_registry* registry{nullptr};
+    wl_shm* shm{nullptr};
+    wl_shm_pool* pool{nullptr};
+    wl_buffer* buffer{nullptr};
+    std::thread client_thread;
+};
+}
+
+// What the frontend and renderer do with each submitted wl_shm buffer, up to
+// (but not including) the glTexImage2D() that needs a GL context
+static void wl_shm_buffer_upload(benchmark::State& state)
+{
+    auto const width = state.range(0);
+    auto const height = state.range(1);
+    ShmBuffer shm_buffer{static_cast<int>(width), static_cast<int>(height)};
+
+    for (auto _ : state)
+    {
+        auto const buffer = mf::WlShmBuffer::mir_buffer_from_wl_buffer(shm_buffer.resource, []{});
+        dynamic_cast<mrs::PixelSource&>(*buffer->native_buffer_base()).read(
+            [](unsigned char const* pixels) { benchmark::DoNotOptimize(pixels[0]); });
+    }
+
+    state.SetBytesProcessed(state.iterations() * width * height * 4);
+}
+BENCHMARK(wl_shm_buffer_upload)->Args({256, 256})->Args({1920, 1080})->Args({3840, 2160});
@@ -500,6 +500,20 @@ void mir_window_spec_set_shell_chrome(MirWindowSpec* spec, MirShellChrome style)
  */
 void mir_window_spec_set_pointer_confinement(MirWindowSpec* spec, MirPointerConfinementState state);
 
+/**
+ * Request that input events for the window are delivered through shared memory
+ *
+ * This avoids the socket for input, reducing latency for clients that draw in
+ * response to input. Input events are then delivered on a dedicated thread, so
+ * the event handler must cope with being called concurrently for the same
+ * window. Servers that do not support this deliver input over the socket as
+ * usual.
+ *
+ * \param [in] spec    The spec to accumulate the request in.
+ * \param [in] enabled Whether input should be delivered through shared memory
+ */
+void mir_window_spec_set_shared_memory_input(MirWindowSpec* spec, bool enabled);
+
 /**
  * Set the window placement on the spec.
  *
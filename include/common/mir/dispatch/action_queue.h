@@ -22,15 +22,25 @@
 #include "mir/fd.h"
 #include "mir/dispatch/dispatchable.h"
 
-#include <list>
-#include <mutex>
 #include <functional>
+#include <memory>
+#include <mutex>
 
 namespace mir
 {
+class WorkQueue;
+
 namespace dispatch
 {
 
+/**
+ * \brief A Dispatchable that runs queued actions
+ *
+ * Actions may be enqueued from any thread; each dispatch() runs all the
+ * actions queued when it starts. dispatch() may be called concurrently, but
+ * the calls run their actions one at a time, so a concurrent call waits for
+ * the actions already running.
+ */
 class ActionQueue : public Dispatchable
 {
 public:
@@ -45,8 +55,8 @@ private:
     bool consume();
     void wake();
     mir::Fd event_fd;
-    std::mutex list_lock;
-    std::list<std::function<void()>> actions;
+    std::mutex dispatch_mutex;
+    std::shared_ptr<WorkQueue> const actions;
 };
 }
 }
@@ -22,6 +22,8 @@
 #include "mir/dispatch/dispatchable.h"
 #include "mir/posix_rw_mutex.h"
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
 #include <list>
@@ -48,11 +50,18 @@ enum class DispatchReentrancy
 
 /**
  * \brief An adaptor that combines multiple Dispatchables into a single Dispatchable
+ *
+ * While only one thread at a time calls dispatch(), each call handles up to
+ * max_events_per_dispatch ready Dispatchables (so a busy adaptor cannot starve
+ * whatever else its caller dispatches). Once dispatch() has been called
+ * concurrently each call handles a single Dispatchable.
  * \note Instances are fully thread-safe.
  */
 class MultiplexingDispatchable final : public Dispatchable
 {
 public:
+    static int const max_events_per_dispatch = 16;
+
     MultiplexingDispatchable();
     MultiplexingDispatchable(std::initializer_list<std::shared_ptr<Dispatchable>> dispatchees);
     virtual ~MultiplexingDispatchable() noexcept;
@@ -95,8 +104,13 @@ public:
      */
     void remove_watch(Fd const& fd);
 private:
+    bool is_watched(std::shared_ptr<Dispatchable> const& dispatchee);
+
     PosixRWMutex lifetime_mutex;
     std::list<std::pair<std::shared_ptr<Dispatchable>, bool>> dispatchee_holder;
+    std::atomic<uint64_t> removals{0};
+    std::atomic<int> dispatching{0};
+    std::atomic<bool> multithreaded{false};
 
     Fd epoll_fd;
 };
@@ -31,6 +31,10 @@ namespace mir
 namespace scene { class Surface; }
 }
 
+namespace miral { class Window; }
+
+namespace std { template<> struct hash<miral::Window>; }
+
 namespace miral
 {
 /// Handle class to manage a Mir surface. It may be null (e.g. default initialized)
@@ -64,6 +68,7 @@ private:
     friend bool operator==(std::shared_ptr<mir::scene::Surface> const& lhs, Window const& rhs);
     friend bool operator==(Window const& lhs, std::shared_ptr<mir::scene::Surface> const& rhs);
     friend bool operator<(Window const& lhs, Window const& rhs);
+    friend struct std::hash<Window>;
 };
 
 bool operator==(Window const& lhs, Window const& rhs);
@@ -79,4 +84,17 @@ inline bool operator<=(Window const& lhs, Window const& rhs) { return !(lhs > rh
 inline bool operator>=(Window const& lhs, Window const& rhs) { return !(lhs < rhs); }
 }
 
+namespace std
+{
+/// Hashes the identity of the Window (consistent with operator==), which doesn't change when the surface goes away
+template<>
+struct hash<miral::Window>
+{
+    auto operator()(miral::Window const& window) const noexcept -> size_t
+    {
+        return hash<shared_ptr<miral::Window::Self>>{}(window.self);
+    }
+};
+}
+
 #endif //MIRAL_WINDOW_H
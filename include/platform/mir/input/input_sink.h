@@ -26,6 +26,7 @@
 
 #include <vector>
 #include <array>
+#include <memory>
 
 namespace mir
 {
@@ -94,6 +95,19 @@ public:
     /**
      * \}
      */
+
+    /**
+     * Handle the events a device produced for a single hardware frame.
+     *
+     * Devices that report related changes together (i.e. all touch contacts of
+     * a touch frame) may use this to let the sink process them as one unit.
+     * The default implementation hands each event to handle_input() in order.
+     */
+    virtual void handle_input_frame(std::vector<std::shared_ptr<MirEvent>> const& events)
+    {
+        for (auto const& event : events)
+            handle_input(event);
+    }
 private:
     InputSink(InputSink const&) = delete;
     InputSink& operator=(InputSink const&) = delete;
@@ -20,6 +20,9 @@
 #define MIR_COMPOSITOR_COMPOSITOR_REPORT_H_
 
 #include "mir/graphics/renderable.h"
+#include "mir/graphics/buffer_id.h"
+
+#include <cstdint>
 
 namespace mir
 {
@@ -38,6 +41,12 @@ public:
     virtual void started() = 0;
     virtual void stopped() = 0;
     virtual void scheduled() = 0;
+
+    /// A client submitted the sequence'th buffer of a stream. The stream is
+    /// identified by the Renderable::ID of the renderables it produces.
+    /// The default does nothing.
+    virtual void buffer_submitted(
+        graphics::Renderable::ID /*stream*/, graphics::BufferID /*buffer*/, uint64_t /*sequence*/) {}
 protected:
     CompositorReport() = default;
     virtual ~CompositorReport() = default;
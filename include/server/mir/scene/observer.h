@@ -47,6 +47,12 @@ public:
     // unregister SurfaceObservers which may have been added in surface_added/exists
     virtual void end_observation() = 0;
 
+    // Bracket a batch of changes applied as a single scene transaction.
+    // Transactions may nest; work prompted by changes notified in between
+    // may be deferred until the outermost transaction ends.
+    virtual void transaction_begun() {}
+    virtual void transaction_ended() {}
+
 protected:
     Observer() = default;
     virtual ~Observer() = default;
@@ -131,6 +131,8 @@ public:
     auto surface_at(geometry::Point cursor) const -> std::shared_ptr<scene::Surface> override;
 
     void raise(SurfaceSet const& surfaces) override;
+
+    void apply_transaction(std::function<void()> const& changes) override;
 /** @} */
 
     void add_display(geometry::Rectangle const& area) override;
@@ -20,6 +20,7 @@
 #define MIR_SHELL_FOCUS_CONTROLLER_H_
 
 #include <stddef.h>
+#include <functional>
 #include <memory>
 #include <set>
 #include <vector>
@@ -56,6 +57,10 @@ public:
 
     virtual void raise(SurfaceSet const& surfaces) = 0;
 
+    /// Applies the scene changes made by \p changes as a single scene update.
+    /// The default applies them directly.
+    virtual void apply_transaction(std::function<void()> const& changes) { changes(); }
+
     virtual void set_drag_and_drop_handle(std::vector<uint8_t> const& handle) = 0;
     virtual void clear_drag_and_drop_handle() = 0;
 
@@ -44,6 +44,8 @@ public:
 
     void raise(SurfaceSet const& surfaces) override;
 
+    void apply_transaction(std::function<void()> const& changes) override;
+
     std::shared_ptr<scene::Session> open_session(
         pid_t client_pid,
         std::string const& name,
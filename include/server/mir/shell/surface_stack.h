@@ -20,6 +20,7 @@
 #ifndef MIR_SHELL_SURFACE_COORDINATOR_H_
 #define MIR_SHELL_SURFACE_COORDINATOR_H_
 
+#include <functional>
 #include <memory>
 #include <set>
 
@@ -54,6 +55,12 @@ public:
 
     virtual auto surface_at(geometry::Point) const -> std::shared_ptr<scene::Surface> = 0;
 
+    /// Applies the moves, resizes, raises and visibility changes made by
+    /// \p changes as a single scene update: scene observers are notified
+    /// once, when the changes are complete, rather than after each change.
+    /// The default applies them directly.
+    virtual void apply_transaction(std::function<void()> const& changes) { changes(); }
+
 protected:
     SurfaceStack() = default;
     virtual ~SurfaceStack() = default;
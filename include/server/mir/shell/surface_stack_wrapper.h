@@ -42,6 +42,8 @@ public:
 
     auto surface_at(geometry::Point) const -> std::shared_ptr<scene::Surface> override;
 
+    void apply_transaction(std::function<void()> const& changes) override;
+
 protected:
     std::shared_ptr<SurfaceStack> const wrapped;
 };
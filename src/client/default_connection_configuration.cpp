@@ -35,6 +35,7 @@
 #include "lifecycle_control.h"
 #include "mir/client/client_platform_factory.h"
 #include "probing_client_platform_factory.h"
+#include "mir/probe_cache.h"
 #include "mir_event_distributor.h"
 #include "buffer_factory.h"
 
@@ -105,11 +106,16 @@ mcl::DefaultConnectionConfiguration::the_client_platform_factory()
             else
                 paths.push_back(MIR_CLIENT_PLATFORM_PATH);
 
+            auto const probe_cache_raw = getenv("MIR_CLIENT_PLATFORM_PROBE_CACHE");
+            auto const probe_cache = probe_cache_raw && probe_cache_raw == off_opt_val ?
+                std::string{} : mir::probe_cache_file("client-platform");
+
             return std::make_shared<mcl::ProbingClientPlatformFactory>(
                                          the_shared_library_prober_report(),
                                          libs,
                                          paths,
-                                         the_logger()
+                                         the_logger(),
+                                         probe_cache
                                          );
         });
 }
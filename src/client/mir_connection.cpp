@@ -145,6 +145,7 @@ mir::protobuf::SurfaceParameters serialize_spec(MirWindowSpec const& spec)
     SERIALIZE_OPTION_IF_SET(height_inc);
     SERIALIZE_OPTION_IF_SET(shell_chrome);
     SERIALIZE_OPTION_IF_SET(confine_pointer);
+    SERIALIZE_OPTION_IF_SET(shared_memory_input);
     // min_aspect is a special case (below)
     // max_aspect is a special case (below)
 
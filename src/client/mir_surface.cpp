@@ -29,11 +29,14 @@
 #include "mir/client/client_buffer.h"
 #include "mir/mir_buffer_stream.h"
 #include "mir/dispatch/threaded_dispatcher.h"
+#include "mir/dispatch/readable_fd.h"
+#include "mir/input/event_ring.h"
 #include "mir/input/xkb_mapper.h"
 #include "mir/cookie/cookie.h"
 #include "mir_cookie.h"
 #include "mir/time/posix_timestamp.h"
 #include "mir/events/surface_event.h"
+#include "mir/uncaught.h"
 
 #include <cassert>
 #include <unistd.h>
@@ -194,10 +197,17 @@ MirSurface::MirSurface(
             spec.event_handler.value().context);
     }
 
-    std::lock_guard<decltype(handle_mutex)> lock(handle_mutex);
-    valid_surfaces.insert(this);
+    {
+        std::lock_guard<decltype(handle_mutex)> lock(handle_mutex);
+        valid_surfaces.insert(this);
+    }
 
     configure_frame_clock();
+
+    // The server hands over the ring's shared memory and wakeup fds if it agreed.
+    // Events are delivered as soon as the thread starts, so this comes last.
+    if (spec.shared_memory_input.is_set() && spec.shared_memory_input.value() && surface->fd_size() == 2)
+        start_shared_memory_input();
 }
 
 MirSurface::~MirSurface()
@@ -218,14 +228,46 @@ MirSurface::~MirSurface()
         valid_surfaces.erase(this);
     }
 
-    std::lock_guard<decltype(mutex)> lock(mutex);
-
+    // The input thread calls handle_event(), which takes the mutex
     input_thread.reset();
 
+    std::lock_guard<decltype(mutex)> lock(mutex);
+
     for (auto i = 0, end = surface->fd_size(); i != end; ++i)
         close(surface->fd(i));
 }
 
+void MirSurface::start_shared_memory_input()
+{
+    input_ring = std::make_shared<mi::EventRing>(
+        mir::Fd{dup(surface->fd(0))},
+        mir::Fd{dup(surface->fd(1))});
+
+    input_thread = std::make_shared<md::ThreadedDispatcher>(
+        "Mir/Input",
+        std::make_shared<md::ReadableFd>(
+            input_ring->wakeup_fd(),
+            [this]
+            {
+                try
+                {
+                    std::lock_guard<std::mutex> lock{input_ring_mutex};
+                    input_ring->clear_wakeup();
+                    drain_shared_memory_input(lock);
+                }
+                catch (std::exception const& ex)
+                {
+                    MIR_LOG_UNCAUGHT_EXCEPTION(ex);
+                }
+            }));
+}
+
+void MirSurface::drain_shared_memory_input(std::lock_guard<std::mutex> const&)
+{
+    while (auto const event = input_ring->pop())
+        deliver_event(*event);
+}
+
 void MirSurface::configure_frame_clock()
 {
     /*
@@ -466,7 +508,6 @@ void MirSurface::set_event_handler(MirWindowEventCallback callback,
 {
     std::lock_guard<decltype(mutex)> lock(mutex);
 
-    input_thread.reset();
     handle_event_callback = [](auto){};
 
     if (callback)
@@ -478,6 +519,25 @@ void MirSurface::set_event_handler(MirWindowEventCallback callback,
 }
 
 void MirSurface::handle_event(MirEvent& e)
+{
+    if (!input_ring)
+    {
+        deliver_event(e);
+        return;
+    }
+
+    // The server sent anything in the ring before this event
+    std::lock_guard<std::mutex> lock{input_ring_mutex};
+    drain_shared_memory_input(lock);
+    deliver_event(e);
+
+    // Input that bypassed the ring holds the server off the ring until we've handled it
+    auto const type = mir_event_get_type(&e);
+    if (type == mir_event_type_input || type == mir_event_type_input_device_state)
+        input_ring->bypass_consumed();
+}
+
+void MirSurface::deliver_event(MirEvent& e)
 {
     std::unique_lock<decltype(mutex)> lock(mutex);
 
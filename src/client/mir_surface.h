@@ -48,6 +48,7 @@ class ThreadedDispatcher;
 }
 namespace input
 {
+class EventRing;
 namespace receiver
 {
 class XKBMapper;
@@ -142,6 +143,7 @@ struct MirSurfaceSpec
     mir::optional_value<std::vector<ContentInfo>> streams;
     mir::optional_value<std::vector<MirRectangle>> input_shape;
     mir::optional_value<bool> confine_pointer;
+    mir::optional_value<bool> shared_memory_input;
 
     struct EventHandler
     {
@@ -270,6 +272,14 @@ private:
     std::function<void(MirEvent const*)> handle_event_callback;
     std::function<void(MirWindowEvent const*)> handle_drag_and_drop_start_callback = [](auto){};
 
+    void start_shared_memory_input();
+    void drain_shared_memory_input(std::lock_guard<std::mutex> const&);
+    void deliver_event(MirEvent& e);
+
+    // Events from the ring are delivered under input_ring_mutex, and so are
+    // events from the socket, after draining the ring: either way the server's order is kept
+    std::shared_ptr<mir::input::EventRing> input_ring;
+    std::mutex input_ring_mutex;
     std::shared_ptr<mir::dispatch::ThreadedDispatcher> input_thread;
 
     //a bit batty, but the creation handle has to exist for as long as the MirSurface does,
@@ -1,11 +1,13 @@
 #include "probing_client_platform_factory.h"
 #include "mir/client/client_platform.h"
+#include "mir/client/client_context.h"
 #include "mir/shared_library.h"
 #include "mir/shared_library_prober.h"
 #include "mir/shared_library_prober_report.h"
 
 #include <boost/exception/all.hpp>
 #include <stdexcept>
+#include <string>
 
 namespace mcl = mir::client;
 
@@ -13,11 +15,13 @@ mcl::ProbingClientPlatformFactory::ProbingClientPlatformFactory(
     std::shared_ptr<mir::SharedLibraryProberReport> const& rep,
     StringList const& force_libs,
     StringList const& lib_paths,
-    std::shared_ptr<mir::logging::Logger> const& logger)
+    std::shared_ptr<mir::logging::Logger> const& logger,
+    std::string const& probe_cache_file)
     : shared_library_prober_report{rep},
       platform_overrides{force_libs},
       platform_paths{lib_paths},
-      logger{logger}
+      logger{logger},
+      probe_cache{probe_cache_file}
 {
     if (platform_overrides.empty() && platform_paths.empty())
     {
@@ -64,8 +68,69 @@ mcl::ProbingClientPlatformFactory::create_client_platform(mcl::ClientContext* co
     }
     else
     {
-        for (auto const& path : platform_paths)
-            select_libraries_for_path(path, module_selector, *shared_library_prober_report);
+        // The right module depends only on the server's graphics module (and
+        // what's installed), so try the one chosen last time before probing
+        MirModuleProperties server_graphics_module{"", 0, 0, 0, ""};
+        context->populate_graphics_module(server_graphics_module);
+        auto const server_module =
+            std::string{server_graphics_module.name ? server_graphics_module.name : ""} + " " +
+            std::to_string(server_graphics_module.major_version) + "." +
+            std::to_string(server_graphics_module.minor_version) + "." +
+            std::to_string(server_graphics_module.micro_version);
+
+        std::string cached;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            auto const i = probed.find(server_module);
+            if (i != probed.end())
+                cached = i->second;
+        }
+
+        for (auto path = begin(platform_paths); cached.empty() && path != end(platform_paths); ++path)
+            cached = probe_cache.lookup(cache_key(server_module), *path);
+
+        if (!cached.empty())
+        {
+            try
+            {
+                shared_library_prober_report->loading_library(cached);
+                module_selector(std::make_shared<mir::SharedLibrary>(cached));
+            }
+            catch (std::runtime_error const& error)
+            {
+                shared_library_prober_report->loading_failed(cached, error);
+            }
+        }
+
+        if (platform_modules.empty())
+        {
+            std::string chosen;
+
+            for (auto const& path : platform_paths)
+            {
+                select_named_libraries_for_path(
+                    path,
+                    [&](std::string const& filename, std::shared_ptr<mir::SharedLibrary> const& module)
+                    {
+                        auto const selection = module_selector(module);
+                        if (selection == Selection::quit && chosen.empty())
+                            chosen = filename;
+                        return selection;
+                    },
+                    *shared_library_prober_report);
+            }
+
+            if (!chosen.empty())
+                probe_cache.store(cache_key(server_module), chosen);
+
+            cached = chosen;
+        }
+
+        if (!cached.empty())
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            probed[server_module] = cached;
+        }
     }
 
     for (auto& module : platform_modules)
@@ -76,3 +141,13 @@ mcl::ProbingClientPlatformFactory::create_client_platform(mcl::ClientContext* co
 
     BOOST_THROW_EXCEPTION(std::runtime_error{"No appropriate client platform module found"});
 }
+
+auto mcl::ProbingClientPlatformFactory::cache_key(std::string const& server_module) const -> std::string
+{
+    auto key = "client\n" + server_module + "\n";
+
+    for (auto const& path : platform_paths)
+        key += mir::library_fingerprint(path);
+
+    return key;
+}
@@ -1,10 +1,13 @@
 #ifndef MIR_CLIENT_PROBING_CLIENT_PLATFORM_FACTORY_H_
 #define MIR_CLIENT_PROBING_CLIENT_PLATFORM_FACTORY_H_
 
+#include <map>
+#include <mutex>
 #include <vector>
 
 #include "mir/client/client_platform_factory.h"
 #include "mir/shared_library.h"
+#include "mir/probe_cache.h"
 
 namespace mir
 {
@@ -20,7 +23,8 @@ public:
         std::shared_ptr<mir::SharedLibraryProberReport> const& rep,
         StringList const& force_libs,
         StringList const& lib_paths,
-        std::shared_ptr<mir::logging::Logger> const& logger);
+        std::shared_ptr<mir::logging::Logger> const& logger,
+        std::string const& probe_cache_file = "");
 
     std::shared_ptr<ClientPlatform> create_client_platform(ClientContext *context) override;
 
@@ -29,6 +33,12 @@ private:
     StringList const platform_overrides;
     StringList const platform_paths;
     std::shared_ptr<mir::logging::Logger> const logger;
+
+    // Modules chosen from platform_paths, keyed by the server's graphics module
+    auto cache_key(std::string const& server_module) const -> std::string;
+    ProbeCache const probe_cache;
+    std::mutex mutex;
+    std::map<std::string, std::string> probed;
 };
 
 }
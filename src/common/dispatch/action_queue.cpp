@@ -17,12 +17,18 @@
  */
 
 #include "mir/dispatch/action_queue.h"
+#include "mir/work_queue.h"
 
 #include <boost/throw_exception.hpp>
 #include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <system_error>
 
 mir::dispatch::ActionQueue::ActionQueue()
-    : event_fd{eventfd(0, EFD_CLOEXEC|EFD_NONBLOCK|EFD_SEMAPHORE)}
+    : event_fd{eventfd(0, EFD_CLOEXEC|EFD_NONBLOCK)},
+      actions{std::make_shared<WorkQueue>()}
 {
     if (event_fd < 0)
         BOOST_THROW_EXCEPTION((std::system_error{errno,
@@ -37,9 +43,9 @@ mir::Fd mir::dispatch::ActionQueue::watch_fd() const
 
 void mir::dispatch::ActionQueue::enqueue(std::function<void()> const& action)
 {
-    std::unique_lock<std::mutex> lock(list_lock);
-    actions.push_back(action);
-    wake();
+    // Only the first action queued since the last dispatch needs to wake us
+    if (actions->push(std::function<void()>{action}))
+        wake();
 }
 
 bool mir::dispatch::ActionQueue::dispatch(FdEvents events)
@@ -54,15 +60,19 @@ bool mir::dispatch::ActionQueue::dispatch(FdEvents events)
         return true;
     }
 
-    std::function<void()> action_to_process;
+    // The queue has a single consumer, so concurrent dispatches take turns
+    std::lock_guard<std::mutex> lock{dispatch_mutex};
 
+    try
     {
-        std::unique_lock<std::mutex> lock(list_lock);
-        action_to_process = actions.front();
-        actions.pop_front();
+        actions->run_all([](std::function<void()>& action) { action(); });
+    }
+    catch (...)
+    {
+        // The remaining actions still need running
+        wake();
+        throw;
     }
-
-    action_to_process();
 
     return true;
 }
@@ -31,6 +31,7 @@
 #include <string.h>
 #include <system_error>
 #include <algorithm>
+#include <array>
 
 namespace md = mir::dispatch;
 
@@ -108,48 +109,129 @@ bool md::MultiplexingDispatchable::dispatch(md::FdEvents events)
         return false;
     }
 
-    std::shared_ptr<md::Dispatchable> source;
-    bool rearm_source{false};
-    epoll_event event;
+    // Events are only batched while a single thread dispatches us: with more
+    // threads, one of them holding a batch would serialise handlers the others
+    // could be running.
+    auto const in_dispatch = mir::raii::paired_calls(
+        [this] { if (++dispatching > 1) multithreaded = true; },
+        [this] { --dispatching; });
+
+    struct ReadySource
+    {
+        std::shared_ptr<md::Dispatchable> source;
+        bool rearm;
+    };
+
+    std::array<epoll_event, max_events_per_dispatch> ready_events;
+    std::array<ReadySource, max_events_per_dispatch> ready_sources;
+    int ready_count;
+    uint64_t removals_before_dispatch;
 
     {
         std::shared_lock<decltype(lifetime_mutex)> lock{lifetime_mutex};
 
-        auto result = epoll_wait(epoll_fd, &event, 1, 0);
+        ready_count = epoll_wait(epoll_fd, ready_events.data(), multithreaded ? 1 : ready_events.size(), 0);
 
-        if (result < 0)
+        if (ready_count < 0)
         {
             BOOST_THROW_EXCEPTION((std::system_error{errno,
                                                      std::system_category(),
                                                      "Failed to wait on fds"}));
         }
 
-        if (result == 0)
+        // If nothing is ready some other thread must have stolen the event we
+        // were woken for; that's ok, just return.
+
+        for (int i = 0; i != ready_count; ++i)
         {
-            // Some other thread must have stolen the event we were woken for;
-            // that's ok, just return.
-            return true;
-        }
+            auto event_source = reinterpret_cast<decltype(dispatchee_holder)::pointer>(ready_events[i].data.ptr);
 
-        auto event_source = reinterpret_cast<decltype(dispatchee_holder)::pointer>(event.data.ptr);
+            ready_sources[i].source = event_source->first;
+            ready_sources[i].rearm = event_source->second;
+        }
 
-        source = event_source->first;
-        rearm_source = event_source->second;
+        removals_before_dispatch = removals;
     }
 
-    if (!source->dispatch(epoll_to_fd_event(event)))
-    {
-        remove_watch(source);
-    }
-    else if (rearm_source)
+    auto const still_watched = [&](std::shared_ptr<md::Dispatchable> const& source)
+        {
+            return removals == removals_before_dispatch || is_watched(source);
+        };
+
+    auto const rearm = [this, &ready_events, &ready_sources](int i)
+        {
+            auto& event = ready_events[i];
+            auto const& source = ready_sources[i].source;
+
+            event.events = fd_event_to_epoll(source->relevant_events()) | EPOLLONESHOT;
+            epoll_ctl(epoll_fd, EPOLL_CTL_MOD, source->watch_fd(), &event);
+        };
+
+    // Sequential sources are disarmed until we re-arm them; reentrant ones are
+    // still reported to other callers, so need no action to hand them back
+    auto const hand_back_from = [&](int first)
+        {
+            for (int i = first; i != ready_count; ++i)
+            {
+                if (ready_sources[i].rearm && still_watched(ready_sources[i].source))
+                {
+                    rearm(i);
+                }
+            }
+        };
+
+    for (int i = 0; i != ready_count; ++i)
     {
-        event.events = fd_event_to_epoll(source->relevant_events()) | EPOLLONESHOT;
-        epoll_ctl(epoll_fd, EPOLL_CTL_MOD, source->watch_fd(), &event);
+        auto const& source = ready_sources[i].source;
+
+        if (i > 0 && multithreaded)
+        {
+            hand_back_from(i);
+            break;
+        }
+
+        // Skip anything removed (possibly by an earlier dispatch) since the batch was read
+        if (!still_watched(source))
+        {
+            continue;
+        }
+
+        bool keep_watching;
+        try
+        {
+            keep_watching = source->dispatch(epoll_to_fd_event(ready_events[i]));
+        }
+        catch (...)
+        {
+            hand_back_from(i + 1);
+            throw;
+        }
+
+        if (!keep_watching)
+        {
+            remove_watch(source);
+        }
+        else if (ready_sources[i].rearm && still_watched(source))
+        {
+            rearm(i);
+        }
     }
 
     return true;
 }
 
+bool md::MultiplexingDispatchable::is_watched(std::shared_ptr<Dispatchable> const& dispatchee)
+{
+    std::shared_lock<decltype(lifetime_mutex)> lock{lifetime_mutex};
+    return std::any_of(
+        dispatchee_holder.begin(),
+        dispatchee_holder.end(),
+        [&dispatchee](std::pair<std::shared_ptr<Dispatchable>,bool> const& candidate)
+        {
+            return candidate.first == dispatchee;
+        });
+}
+
 md::FdEvents md::MultiplexingDispatchable::relevant_events() const
 {
     return md::FdEvent::readable;
@@ -227,4 +309,5 @@ void md::MultiplexingDispatchable::remove_watch(Fd const& fd)
     {
         return candidate.first->watch_fd() == fd;
     });
+    ++removals;
 }
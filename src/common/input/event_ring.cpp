@@ -0,0 +1,276 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/input/event_ring.h"
+#include "mir/events/event_private.h"
+#include "mir/anonymous_shm_file.h"
+
+#include <boost/throw_exception.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace mi = mir::input;
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "EventRing indices must be lock free to be shared between processes");
+
+/*
+ * The shared memory starts with this header, followed by slot_count slots of
+ * slot_size bytes. Each record starts a slot with a 32 bit length, followed by
+ * the serialized event, and takes up as many consecutive slots as it needs.
+ * Records never wrap around: a record that would run past the last slot is
+ * preceded by a padding record that fills the ring up to its end.
+ *
+ * head and tail are free running slot counters: the producer owns head, the
+ * consumer owns tail and bypasses_consumed, and the ring is full when head and
+ * tail are slot_count apart.
+ */
+struct mi::EventRing::Header
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t slot_count;
+    std::uint32_t slot_size;
+    alignas(64) std::atomic<std::uint32_t> head;
+    alignas(64) std::atomic<std::uint32_t> tail;
+    std::atomic<std::uint32_t> bypasses_consumed;
+};
+
+namespace
+{
+std::uint32_t const ring_magic = 0x4d524952; // "MRIR"
+std::uint32_t const ring_version = 2;
+std::uint32_t const default_slot_size = 1024;
+std::uint32_t const padding_marker = 0xffffffff;
+
+std::uint32_t const max_slot_count = 1u << 16;
+
+std::uint32_t round_up_to_power_of_two(std::size_t count)
+{
+    std::uint32_t result = 1;
+    while (result < count && result < max_slot_count)
+        result <<= 1;
+    return result;
+}
+
+template<typename Header>
+std::size_t size_for(std::uint32_t slot_count, std::uint32_t slot_size)
+{
+    return sizeof(Header) + std::size_t{slot_count} * slot_size;
+}
+
+mir::Fd create_shm(std::size_t size)
+{
+    mir::AnonymousShmFile const file{size};
+    auto const fd = dup(file.fd());
+    if (fd < 0)
+        BOOST_THROW_EXCEPTION(std::system_error(errno, std::system_category(), "Failed to dup event ring fd"));
+    return mir::Fd{fd};
+}
+
+mir::Fd create_eventfd()
+{
+    auto const fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (fd < 0)
+        BOOST_THROW_EXCEPTION(std::system_error(errno, std::system_category(), "Failed to create event ring wakeup"));
+    return mir::Fd{fd};
+}
+
+void* map(mir::Fd const& fd, std::size_t size)
+{
+    auto const mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED)
+        BOOST_THROW_EXCEPTION(std::system_error(errno, std::system_category(), "Failed to map event ring"));
+    return mapping;
+}
+}
+
+mi::EventRing::EventRing(std::size_t slot_count) :
+    shm{create_shm(size_for<Header>(round_up_to_power_of_two(slot_count), default_slot_size))},
+    wakeup{create_eventfd()},
+    mapping_size{size_for<Header>(round_up_to_power_of_two(slot_count), default_slot_size)},
+    mapping{map(shm, mapping_size)},
+    header{new (mapping) Header},
+    slot_mask{round_up_to_power_of_two(slot_count) - 1},
+    slot_size{default_slot_size}
+{
+    header->magic = ring_magic;
+    header->version = ring_version;
+    header->slot_count = slot_mask + 1;
+    header->slot_size = slot_size;
+    header->head = 0;
+    header->tail = 0;
+    header->bypasses_consumed = 0;
+}
+
+mi::EventRing::EventRing(Fd const& shm_fd, Fd const& wakeup_fd) :
+    shm{shm_fd},
+    wakeup{wakeup_fd},
+    mapping_size{0},
+    mapping{nullptr},
+    header{nullptr},
+    slot_mask{0},
+    slot_size{0}
+{
+    struct stat shm_stat;
+    if (fstat(shm, &shm_stat) < 0)
+        BOOST_THROW_EXCEPTION(std::system_error(errno, std::system_category(), "Failed to stat event ring"));
+
+    if (static_cast<std::size_t>(shm_stat.st_size) < sizeof(Header))
+        BOOST_THROW_EXCEPTION(std::runtime_error("Event ring is too small"));
+
+    mapping_size = shm_stat.st_size;
+    mapping = map(shm, mapping_size);
+    header = static_cast<Header*>(mapping);
+
+    auto const slot_count = header->slot_count;
+
+    if (header->magic != ring_magic ||
+        header->version != ring_version ||
+        slot_count == 0 || (slot_count & (slot_count - 1)) != 0 || slot_count > max_slot_count ||
+        header->slot_size <= sizeof(std::uint32_t) ||
+        size_for<Header>(slot_count, header->slot_size) > mapping_size)
+    {
+        munmap(mapping, mapping_size);
+        BOOST_THROW_EXCEPTION(std::runtime_error("Invalid event ring"));
+    }
+
+    slot_mask = slot_count - 1;
+    slot_size = header->slot_size;
+}
+
+mi::EventRing::~EventRing() noexcept
+{
+    munmap(mapping, mapping_size);
+}
+
+mir::Fd mi::EventRing::shm_fd() const
+{
+    return shm;
+}
+
+mir::Fd mi::EventRing::wakeup_fd() const
+{
+    return wakeup;
+}
+
+bool mi::EventRing::push(MirEvent const& event)
+{
+    auto const serialized = MirEvent::serialize(&event);
+    auto const slot_count = slot_mask + 1;
+    if (serialized.size() > std::size_t{slot_count} * slot_size - sizeof(std::uint32_t))
+        return false;
+
+    std::uint32_t const size = serialized.size();
+    auto const needed = slots_for(size);
+
+    auto const head = header->head.load(std::memory_order_relaxed);
+    auto const free_slots = slot_count - (head - header->tail.load());
+    auto const slots_to_end = slot_count - (head & slot_mask);
+    auto const padding = needed > slots_to_end ? slots_to_end : 0;
+
+    if (padding + needed > free_slots)
+        return false;
+
+    if (padding)
+        memcpy(slot(head), &padding_marker, sizeof padding_marker);
+
+    auto const destination = slot(head + padding);
+    memcpy(destination, &size, sizeof size);
+    memcpy(destination + sizeof size, serialized.data(), size);
+
+    header->head.store(head + padding + needed);
+
+    // Only wake a consumer that had drained everything before this event; one
+    // that is still working through the ring will find it anyway.
+    if (header->tail.load() == head)
+    {
+        std::uint64_t const one{1};
+        if (write(wakeup, &one, sizeof one) < 0 && errno != EAGAIN)
+            BOOST_THROW_EXCEPTION(std::system_error(errno, std::system_category(), "Failed to wake event ring consumer"));
+    }
+
+    return true;
+}
+
+mir::EventUPtr mi::EventRing::pop()
+{
+    auto tail = header->tail.load(std::memory_order_relaxed);
+    auto const head = header->head.load();
+    if (tail == head)
+        return EventUPtr{nullptr, [](MirEvent*){}};
+
+    std::uint32_t size;
+    memcpy(&size, slot(tail), sizeof size);
+
+    if (size == padding_marker)
+    {
+        tail += (slot_mask + 1) - (tail & slot_mask);
+        memcpy(&size, slot(tail), sizeof size);
+    }
+
+    // Don't trust the producer to have written a record that fits
+    auto const slots_to_end = (slot_mask + 1) - (tail & slot_mask);
+    auto const available = std::min(head - tail, slots_to_end);
+
+    std::string serialized;
+    if (tail != head && size <= std::size_t{available} * slot_size - sizeof size)
+        serialized.assign(slot(tail) + sizeof size, size);
+
+    header->tail.store(serialized.empty() ? head : tail + slots_for(size));
+
+    if (serialized.empty())
+        BOOST_THROW_EXCEPTION(std::runtime_error("Corrupt event in event ring"));
+
+    return MirEvent::deserialize(serialized);
+}
+
+void mi::EventRing::clear_wakeup()
+{
+    std::uint64_t count;
+    if (read(wakeup, &count, sizeof count) < 0 && errno != EAGAIN)
+        BOOST_THROW_EXCEPTION(std::system_error(errno, std::system_category(), "Failed to clear event ring wakeup"));
+}
+
+void mi::EventRing::bypass_consumed()
+{
+    header->bypasses_consumed.fetch_add(1);
+}
+
+std::uint32_t mi::EventRing::bypasses_consumed() const
+{
+    return header->bypasses_consumed.load();
+}
+
+char* mi::EventRing::slot(std::uint32_t index) const
+{
+    return static_cast<char*>(mapping) + sizeof(Header) + std::size_t{index & slot_mask} * slot_size;
+}
+
+std::uint32_t mi::EventRing::slots_for(std::uint32_t size) const
+{
+    return (std::size_t{size} + sizeof size + slot_size - 1) / slot_size;
+}
@@ -0,0 +1,361 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/logging/async_logger.h"
+#include "mir/thread_name.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+namespace ml = mir::logging;
+
+namespace
+{
+std::size_t const default_records_per_thread{1024};
+
+std::atomic<std::uint64_t> next_logger_id{0};
+
+bool earlier(timespec const& lhs, timespec const& rhs)
+{
+    return lhs.tv_sec < rhs.tv_sec || (lhs.tv_sec == rhs.tv_sec && lhs.tv_nsec < rhs.tv_nsec);
+}
+}
+
+struct ml::AsyncLogger::ThreadBuffer
+{
+    struct Record
+    {
+        Severity severity;
+        timespec time;
+        std::string component;
+        std::string message;
+    };
+
+    explicit ThreadBuffer(std::size_t capacity) : records(capacity) {}
+
+    auto full() const -> bool
+    {
+        return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire) == records.size();
+    }
+
+    // The strings are assigned to, rather than replaced, so they keep their capacity.
+    // Returns true if the buffer was empty, so the writer may need waking.
+    auto push(Severity severity, char const* component, char const* message, std::size_t length) -> bool
+    {
+        auto const position = head.load(std::memory_order_relaxed);
+        auto& record = records[position % records.size()];
+
+        record.severity = severity;
+        clock_gettime(CLOCK_REALTIME, &record.time);
+        record.component.assign(component);
+        record.message.assign(message, length);
+
+        // Sequentially consistent, paired with pop() and pending(): either we see
+        // the writer hasn't taken everything, or the writer sees this record
+        head.store(position + 1);
+        return tail.load() == position;
+    }
+
+    auto front() const -> Record const&
+    {
+        return records[tail.load(std::memory_order_relaxed) % records.size()];
+    }
+
+    void pop()
+    {
+        tail.store(tail.load(std::memory_order_relaxed) + 1);
+    }
+
+    auto pending() const -> bool
+    {
+        return tail.load() != head.load();
+    }
+
+    std::vector<Record> records;
+    std::atomic<std::uint64_t> head{0};     // written by the logging thread
+    std::atomic<std::uint64_t> tail{0};     // written by the writer
+    std::atomic<std::uint64_t> dropped{0};
+    std::atomic<bool> orphaned{false};      // the logger is gone
+    std::uint64_t write_end{0};             // writer only
+};
+
+ml::AsyncLogger::AsyncLogger() :
+    AsyncLogger{Severity::debug}
+{
+}
+
+ml::AsyncLogger::AsyncLogger(Severity max_severity) :
+    AsyncLogger{max_severity, default_records_per_thread, std::cout, std::cerr}
+{
+}
+
+ml::AsyncLogger::AsyncLogger(
+    Severity max_severity,
+    std::size_t records_per_thread,
+    std::ostream& out,
+    std::ostream& err) :
+    id{next_logger_id++},
+    max_severity{max_severity},
+    records_per_thread{std::max<std::size_t>(records_per_thread, 1)},
+    out(out),
+    err(err),
+    writer{[this] { run_writer(); }}
+{
+}
+
+ml::AsyncLogger::~AsyncLogger() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        stopping = true;
+    }
+    cv.notify_all();
+    writer.join();
+
+    flush();
+
+    std::lock_guard<std::mutex> lock{buffers_mutex};
+    for (auto const& buffer : buffers)
+        buffer->orphaned = true;
+}
+
+void ml::AsyncLogger::log(Severity severity, std::string const& message, std::string const& component)
+{
+    if (severity > max_severity)
+        return;
+
+    append(severity, component.c_str(), message.data(), message.size());
+}
+
+void ml::AsyncLogger::log(char const* component, Severity severity, char const* format, ...)
+{
+    if (severity > max_severity)
+        return;
+
+    char message[4096];
+    va_list va;
+    va_start(va, format);
+    auto const length = vsnprintf(message, sizeof message, format, va);
+    va_end(va);
+
+    if (length < 0)
+        return;
+
+    append(severity, component, message, std::min<std::size_t>(length, sizeof message - 1));
+}
+
+void ml::AsyncLogger::flush()
+{
+    std::lock_guard<std::mutex> lock{write_mutex};
+    write_pending();
+    write_batch();
+}
+
+auto ml::AsyncLogger::thread_buffer() -> ThreadBuffer&
+{
+    static thread_local std::vector<std::pair<std::uint64_t, std::shared_ptr<ThreadBuffer>>> thread_buffers;
+
+    for (auto const& entry : thread_buffers)
+    {
+        if (entry.first == id)
+            return *entry.second;
+    }
+
+    thread_buffers.erase(
+        std::remove_if(begin(thread_buffers), end(thread_buffers),
+            [](auto const& entry) { return entry.second->orphaned.load(); }),
+        end(thread_buffers));
+
+    auto const buffer = std::make_shared<ThreadBuffer>(records_per_thread);
+    {
+        std::lock_guard<std::mutex> lock{buffers_mutex};
+        buffers.push_back(buffer);
+    }
+    thread_buffers.emplace_back(id, buffer);
+
+    return *buffer;
+}
+
+void ml::AsyncLogger::append(Severity severity, char const* component, char const* message, std::size_t length)
+{
+    auto& buffer = thread_buffer();
+
+    if (buffer.full())
+    {
+        if (severity != Severity::critical)
+        {
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        flush();
+    }
+
+    auto const was_empty = buffer.push(severity, component, message, length);
+
+    if (severity == Severity::critical)
+    {
+        // We may be about to abort(), so don't leave this to the writer
+        flush();
+    }
+    else if (was_empty)
+    {
+        // Otherwise the writer hasn't finished with this buffer, and will get to it
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            wake_writer = true;
+        }
+        cv.notify_one();
+    }
+}
+
+void ml::AsyncLogger::run_writer()
+{
+    mir::set_thread_name("Mir/Logger");
+
+    std::unique_lock<std::mutex> lock{mutex};
+
+    while (!stopping)
+    {
+        cv.wait(lock, [this] { return wake_writer || stopping; });
+        wake_writer = false;
+
+        lock.unlock();
+        // Threads only wake us when their buffer was empty, so don't sleep until they all are
+        do
+        {
+            flush();
+        }
+        while (pending());
+        lock.lock();
+    }
+}
+
+auto ml::AsyncLogger::pending() -> bool
+{
+    std::lock_guard<std::mutex> lock{buffers_mutex};
+
+    return std::any_of(begin(buffers), end(buffers), [](auto const& buffer) { return buffer->pending(); });
+}
+
+void ml::AsyncLogger::write_pending()
+{
+    std::lock_guard<std::mutex> lock{buffers_mutex};
+
+    std::uint64_t dropped{0};
+    for (auto const& buffer : buffers)
+    {
+        buffer->write_end = buffer->head.load(std::memory_order_acquire);
+        dropped += buffer->dropped.exchange(0, std::memory_order_relaxed);
+    }
+
+    // Merge the threads' records in time order
+    for (;;)
+    {
+        ThreadBuffer* earliest{nullptr};
+
+        for (auto const& buffer : buffers)
+        {
+            if (buffer->tail.load(std::memory_order_relaxed) != buffer->write_end &&
+                (!earliest || earlier(buffer->front().time, earliest->front().time)))
+            {
+                earliest = buffer.get();
+            }
+        }
+
+        if (!earliest)
+            break;
+
+        auto const& record = earliest->front();
+        write(record.severity, record.time, record.component, record.message);
+        earliest->pop();
+    }
+
+    if (dropped)
+    {
+        timespec now;
+        clock_gettime(CLOCK_REALTIME, &now);
+        write(Severity::warning, now, "logger", std::to_string(dropped) + " messages dropped");
+    }
+
+    // Forget the buffers of threads that have exited
+    buffers.erase(
+        std::remove_if(begin(buffers), end(buffers), [](auto const& buffer)
+            {
+                return buffer.use_count() == 1 &&
+                    buffer->tail.load(std::memory_order_relaxed) == buffer->head.load(std::memory_order_acquire);
+            }),
+        end(buffers));
+}
+
+void ml::AsyncLogger::write(
+    Severity severity,
+    timespec const& time,
+    std::string const& component,
+    std::string const& message)
+{
+    static char const* const lut[5] =
+    {
+        "<CRITICAL> ",
+        "<ERROR> ",
+        "<WARNING> ",
+        "",
+        "<DEBUG> "
+    };
+
+    auto& stream = severity < Severity::informational ? err : out;
+
+    if (&stream != batch_stream)
+    {
+        write_batch();
+        batch_stream = &stream;
+    }
+
+    if (time.tv_sec != cached_second)
+    {
+        tm local;
+        localtime_r(&time.tv_sec, &local);
+        strftime(cached_prefix, sizeof cached_prefix, "[%F %T", &local);
+        cached_second = time.tv_sec;
+    }
+
+    char microseconds[32];
+    snprintf(microseconds, sizeof microseconds, ".%06ld] ", time.tv_nsec / 1000);
+
+    batch += cached_prefix;
+    batch += microseconds;
+    batch += lut[static_cast<int>(severity)];
+    batch += component;
+    batch += ": ";
+    batch += message;
+    batch += '\n';
+}
+
+void ml::AsyncLogger::write_batch()
+{
+    if (batch_stream && !batch.empty())
+    {
+        batch_stream->write(batch.data(), batch.size());
+        batch_stream->flush();
+    }
+
+    batch.clear();
+}
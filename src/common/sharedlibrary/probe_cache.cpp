@@ -0,0 +1,183 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "mir/probe_cache.h"
+#include "mir/shared_library_prober.h"
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+#include <unistd.h>
+
+namespace
+{
+// Most recent first: enough for a few seats or sessions to share a cache
+std::size_t const max_entries{8};
+
+// A stable (FNV-1a) hash, so the file needn't hold the keys themselves
+std::string hash_of(std::string const& key)
+{
+    std::uint64_t hash{0xcbf29ce484222325};
+    for (unsigned char const c : key)
+    {
+        hash ^= c;
+        hash *= 0x100000001b3;
+    }
+
+    char text[17];
+    snprintf(text, sizeof text, "%016" PRIx64, hash);
+    return text;
+}
+
+struct Entry
+{
+    std::string hash;
+    std::string filename;
+};
+
+std::vector<Entry> read_entries(std::string const& file)
+{
+    std::vector<Entry> entries;
+    std::ifstream in{file};
+
+    for (std::string line; std::getline(in, line);)
+    {
+        auto const separator = line.find(' ');
+        if (separator != std::string::npos)
+            entries.push_back({line.substr(0, separator), line.substr(separator + 1)});
+    }
+
+    return entries;
+}
+
+std::string first_line_of(boost::filesystem::path const& path)
+{
+    std::ifstream in{path.string()};
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+}
+
+mir::ProbeCache::ProbeCache(std::string const& file) :
+    file{file}
+{
+}
+
+auto mir::ProbeCache::lookup(std::string const& key, std::string const& path) const -> std::string
+{
+    if (file.empty())
+        return {};
+
+    auto const hash = hash_of(key);
+
+    for (auto const& entry : read_entries(file))
+    {
+        // Don't trust the file to name a library: only accept one we'd have probed anyway
+        if (entry.hash == hash)
+            return library_in_path(path, entry.filename);
+    }
+
+    return {};
+}
+
+void mir::ProbeCache::store(std::string const& key, std::string const& filename) const
+{
+    if (file.empty())
+        return;
+
+    auto const hash = hash_of(key);
+
+    auto entries = read_entries(file);
+    entries.erase(
+        std::remove_if(begin(entries), end(entries), [&](Entry const& entry) { return entry.hash == hash; }),
+        end(entries));
+    entries.insert(begin(entries), Entry{hash, boost::filesystem::path{filename}.filename().string()});
+    if (entries.size() > max_entries)
+        entries.resize(max_entries);
+
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(boost::filesystem::path{file}.parent_path(), ec);
+
+    // Write a new file and rename it over the old, so readers (maybe in other
+    // processes) never see a partial one
+    auto const temporary = file + "." + std::to_string(getpid());
+    {
+        std::ofstream out{temporary};
+        for (auto const& entry : entries)
+            out << entry.hash << ' ' << entry.filename << '\n';
+
+        if (!out.flush())
+        {
+            unlink(temporary.c_str());
+            return;
+        }
+    }
+
+    if (rename(temporary.c_str(), file.c_str()) != 0)
+        unlink(temporary.c_str());
+}
+
+auto mir::probe_cache_file(std::string const& name) -> std::string
+{
+    if (auto const cache_home = getenv("XDG_CACHE_HOME"))
+    {
+        if (*cache_home)
+            return std::string{cache_home} + "/mir/" + name;
+    }
+
+    if (auto const home = getenv("HOME"))
+    {
+        if (*home)
+            return std::string{home} + "/.cache/mir/" + name;
+    }
+
+    return {};
+}
+
+auto mir::device_fingerprint(std::string const& subsystem) -> std::string
+{
+    boost::filesystem::path const class_dir{"/sys/class/" + subsystem};
+
+    std::vector<std::string> devices;
+
+    boost::system::error_code ec;
+    for (boost::filesystem::directory_iterator device{class_dir, ec}, end; !ec && device != end; device.increment(ec))
+    {
+        auto const& path = device->path();
+
+        devices.push_back(
+            path.filename().string() + ' ' +
+            first_line_of(path / "dev") + ' ' +
+            first_line_of(path / "device" / "vendor") + ' ' +
+            first_line_of(path / "device" / "device"));
+    }
+
+    std::sort(begin(devices), end(devices));
+
+    std::string fingerprint;
+    for (auto const& device : devices)
+        fingerprint += device + '\n';
+
+    return fingerprint;
+}
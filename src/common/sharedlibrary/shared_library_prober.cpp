@@ -24,6 +24,8 @@
 #include <system_error>
 #include <cstring>
 
+#include <sys/stat.h>
+
 namespace
 {
 std::error_code boost_to_std_error(boost::system::error_code const& ec)
@@ -63,16 +65,38 @@ bool greater_soname_version(boost::filesystem::path const& lhs, boost::filesyste
 }
 }
 
-void mir::select_libraries_for_path(
+namespace
+{
+std::vector<boost::filesystem::path> libraries_in(std::string const& path, boost::system::error_code& ec)
+{
+    std::vector<boost::filesystem::path> libraries;
+
+    boost::filesystem::directory_iterator iterator{path, ec};
+    if (ec)
+        return libraries;
+
+    for (; iterator != boost::filesystem::directory_iterator() ; ++iterator)
+    {
+        if (path_has_library_extension(iterator->path()))
+            libraries.push_back(iterator->path().string());
+    }
+
+    std::sort(libraries.begin(), libraries.end(), &greater_soname_version);
+
+    return libraries;
+}
+}
+
+void mir::select_named_libraries_for_path(
     std::string const& path,
-    std::function<Selection(std::shared_ptr<mir::SharedLibrary> const&)> const& selector,
+    std::function<Selection(std::string const&, std::shared_ptr<mir::SharedLibrary> const&)> const& selector,
     mir::SharedLibraryProberReport& report)
 {
     report.probing_path(path);
     // We use the error_code overload because we want to throw a std::system_error
     boost::system::error_code ec;
 
-    boost::filesystem::directory_iterator iterator{path, ec};
+    auto const libraries = libraries_in(path, ec);
     if (ec)
     {
         std::system_error error(boost_to_std_error(ec), path);
@@ -80,15 +104,6 @@ void mir::select_libraries_for_path(
         throw error;
     }
 
-    std::vector<boost::filesystem::path> libraries;
-    for (; iterator != boost::filesystem::directory_iterator() ; ++iterator)
-    {
-        if (path_has_library_extension(iterator->path()))
-            libraries.push_back(iterator->path().string());
-    }
-
-    std::sort(libraries.begin(), libraries.end(), &greater_soname_version);
-
     for(auto& lib : libraries)
     {
         try
@@ -96,7 +111,7 @@ void mir::select_libraries_for_path(
             report.loading_library(lib);
             auto const shared_lib = std::make_shared<mir::SharedLibrary>(lib.string());
 
-            if (selector(shared_lib) == Selection::quit)
+            if (selector(lib.string(), shared_lib) == Selection::quit)
                 return;
         }
         catch (std::runtime_error const& err)
@@ -106,6 +121,31 @@ void mir::select_libraries_for_path(
     }
 }
 
+void mir::select_libraries_for_path(
+    std::string const& path,
+    std::function<Selection(std::shared_ptr<mir::SharedLibrary> const&)> const& selector,
+    mir::SharedLibraryProberReport& report)
+{
+    select_named_libraries_for_path(
+        path,
+        [&](std::string const&, std::shared_ptr<mir::SharedLibrary> const& shared_lib)
+            { return selector(shared_lib); },
+        report);
+}
+
+std::string mir::library_in_path(std::string const& path, std::string const& filename)
+{
+    boost::system::error_code ec;
+
+    for (auto const& library : libraries_in(path, ec))
+    {
+        if (library.filename() == filename)
+            return library.string();
+    }
+
+    return {};
+}
+
 std::vector<std::shared_ptr<mir::SharedLibrary>>
 mir::libraries_for_path(std::string const& path, mir::SharedLibraryProberReport& report)
 {
@@ -119,3 +159,22 @@ mir::libraries_for_path(std::string const& path, mir::SharedLibraryProberReport&
 
     return result;
 }
+
+std::string mir::library_fingerprint(std::string const& path)
+{
+    boost::system::error_code ec;
+    std::string fingerprint;
+
+    for (auto const& lib : libraries_in(path, ec))
+    {
+        struct stat info;
+        if (stat(lib.c_str(), &info) != 0)
+            continue;
+
+        fingerprint += lib.string() + ' ' +
+            std::to_string(info.st_size) + ' ' +
+            std::to_string(info.st_mtim.tv_sec) + '.' + std::to_string(info.st_mtim.tv_nsec) + '\n';
+    }
+
+    return fingerprint;
+}
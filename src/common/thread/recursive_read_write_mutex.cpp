@@ -19,69 +19,185 @@
 #include "mir/recursive_read_write_mutex.h"
 
 #include <algorithm>
+#include <vector>
 
-void mir::RecursiveReadWriteMutex::read_lock()
+struct mir::RecursiveReadWriteMutex::ThreadLockCount
 {
-    auto const my_id = std::this_thread::get_id();
+    uint64_t mutex_id;
+    unsigned int reads;
+    unsigned int writes;
+    bool counted_as_reader;
+};
 
-    std::unique_lock<decltype(mutex)> lock{mutex};
-    cv.wait(lock, [&]{
-        return !write_locking_thread.count ||
-            write_locking_thread.id == my_id; });
+namespace
+{
+std::atomic<uint64_t> next_mutex_id{1};
+
+// Each thread uses the same reader slot for every mutex
+unsigned int this_thread_reader_slot(unsigned int slots)
+{
+    static std::atomic<unsigned int> next_slot{0};
+    static thread_local unsigned int const slot = next_slot++;
+    return slot % slots;
+}
+}
+
+mir::RecursiveReadWriteMutex::RecursiveReadWriteMutex() :
+    id{next_mutex_id++}
+{
+}
+
+namespace
+{
+template<typename ThreadLockCount>
+auto this_thread_lock_counts() -> std::vector<ThreadLockCount>&
+{
+    // Keyed by the mutex id rather than its address as a mutex can be
+    // destroyed while locked and a new one created at the same address
+    static thread_local std::vector<ThreadLockCount> counts;
+    return counts;
+}
+}
+
+auto mir::RecursiveReadWriteMutex::this_thread_count() -> ThreadLockCount&
+{
+    auto& counts = this_thread_lock_counts<ThreadLockCount>();
 
     auto const my_count = std::find_if(
-        read_locking_threads.begin(),
-        read_locking_threads.end(),
-        [my_id](ThreadLockCount const& candidate) { return my_id == candidate.id; });
+        counts.begin(),
+        counts.end(),
+        [this](ThreadLockCount const& candidate) { return id == candidate.mutex_id; });
+
+    if (my_count != counts.end())
+        return *my_count;
+
+    counts.push_back(ThreadLockCount{id, 0, 0, false});
+    return counts.back();
+}
+
+void mir::RecursiveReadWriteMutex::release_this_thread_count()
+{
+    auto& counts = this_thread_lock_counts<ThreadLockCount>();
+
+    auto const my_count = std::find_if(
+        counts.begin(),
+        counts.end(),
+        [this](ThreadLockCount const& candidate) { return id == candidate.mutex_id; });
+
+    if (my_count != counts.end() && !my_count->reads && !my_count->writes)
+    {
+        *my_count = counts.back();
+        counts.pop_back();
+    }
+}
+
+unsigned int mir::RecursiveReadWriteMutex::total_readers() const
+{
+    unsigned int total = 0;
+    for (auto const& slot : reader_count)
+        total += slot.count;
+    return total;
+}
+
+void mir::RecursiveReadWriteMutex::read_lock()
+{
+    auto& my_count = this_thread_count();
 
-    if (my_count == read_locking_threads.end())
+    if (my_count.reads || my_count.writes)
     {
-        read_locking_threads.push_back(ThreadLockCount(my_id, 1U));
+        ++my_count.reads;
+        return;
     }
-    else
+
+    auto& slot = reader_count[this_thread_reader_slot(reader_slots)];
+
+    for (;;)
     {
-        ++(my_count->count);
+        // Announce ourselves before checking for writers, so that a writer
+        // either sees us or we see it
+        ++slot.count;
+
+        if (!writers_waiting)
+            break;
+
+        --slot.count;
+
+        std::unique_lock<decltype(mutex)> lock{mutex};
+        writers_cv.notify_all();
+        readers_cv.wait(lock, [this]{ return !writers_waiting; });
     }
+
+    ++my_count.reads;
+    my_count.counted_as_reader = true;
 }
 
 void mir::RecursiveReadWriteMutex::read_unlock()
 {
-    auto const my_id = std::this_thread::get_id();
+    auto& my_count = this_thread_count();
 
-    std::lock_guard<decltype(mutex)> lock{mutex};
-    auto const my_count = std::find_if(
-        read_locking_threads.begin(),
-        read_locking_threads.end(),
-        [my_id](ThreadLockCount const& candidate) { return my_id == candidate.id; });
+    if (--my_count.reads || !my_count.counted_as_reader)
+        return;
 
-    --(my_count->count);
+    my_count.counted_as_reader = false;
+    --reader_count[this_thread_reader_slot(reader_slots)].count;
 
-    cv.notify_all();
+    if (writers_waiting)
+    {
+        std::lock_guard<decltype(mutex)> lock{mutex};
+        writers_cv.notify_all();
+    }
+
+    if (!my_count.writes)
+        release_this_thread_count();
 }
 
 void mir::RecursiveReadWriteMutex::write_lock()
 {
-    auto const my_id = std::this_thread::get_id();
+    auto& my_count = this_thread_count();
+
+    if (my_count.writes)
+    {
+        ++my_count.writes;
+        return;
+    }
 
     std::unique_lock<decltype(mutex)> lock{mutex};
-    cv.wait(lock, [&]
-        {
-            if (write_locking_thread.count &&
-                write_locking_thread.id != my_id) return false;
-            for (auto const& candidate : read_locking_threads)
-            {
-                if (candidate.id != my_id && candidate.count != 0) return false;
-            }
-            return true;
-        });
-
-    ++write_locking_thread.count;
-    write_locking_thread.id = my_id;
+
+    ++writers_waiting;
+
+    auto const my_reads = my_count.counted_as_reader ? 1U : 0U;
+    writers_cv.wait(lock, [&]{ return !write_locked && total_readers() == my_reads; });
+
+    write_locked = true;
+    ++my_count.writes;
 }
 
 void mir::RecursiveReadWriteMutex::write_unlock()
 {
-    std::lock_guard<decltype(mutex)> lock{mutex};
-    --write_locking_thread.count;
-    cv.notify_all();
+    auto& my_count = this_thread_count();
+
+    if (--my_count.writes)
+        return;
+
+    {
+        std::lock_guard<decltype(mutex)> lock{mutex};
+
+        // Any read locks taken while holding the write lock now need to
+        // exclude other writers
+        if (my_count.reads && !my_count.counted_as_reader)
+        {
+            ++reader_count[this_thread_reader_slot(reader_slots)].count;
+            my_count.counted_as_reader = true;
+        }
+
+        write_locked = false;
+
+        if (--writers_waiting)
+            writers_cv.notify_all();
+        else
+            readers_cv.notify_all();
+    }
+
+    if (!my_count.reads)
+        release_this_thread_count();
 }
@@ -0,0 +1,98 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_INPUT_EVENT_RING_H_
+#define MIR_INPUT_EVENT_RING_H_
+
+#include "mir/fd.h"
+#include "mir_toolkit/event.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace mir
+{
+using EventUPtr = std::unique_ptr<MirEvent, void(*)(MirEvent*)>;
+
+namespace input
+{
+/**
+ * A single-producer, single-consumer ring of serialized events in shared memory
+ *
+ * The server pushes input events for a surface into the ring and the client
+ * pops them out again, without going through the socket. The wakeup fd is an
+ * eventfd that becomes readable whenever the producer publishes into a ring
+ * the consumer has drained; the consumer should clear_wakeup() and then pop()
+ * until the ring is empty.
+ *
+ * An event larger than a slot takes up several consecutive slots, so an empty
+ * ring takes any event up to half its size. Events that do not fit in the
+ * free space are refused so the producer can deliver them
+ * by other means. The consumer counts the events it handled from those other
+ * means with bypass_consumed(), so that the producer can tell when it is safe
+ * to use the ring again without newer events overtaking older ones.
+ */
+class EventRing
+{
+public:
+    /// Creates a new ring with the given number of slots (rounded up to a power of two)
+    explicit EventRing(std::size_t slot_count);
+
+    /// Maps a ring created by the other end of a connection
+    EventRing(Fd const& shm_fd, Fd const& wakeup_fd);
+
+    ~EventRing() noexcept;
+
+    Fd shm_fd() const;
+    Fd wakeup_fd() const;
+
+    /// Producer side: returns false if the event was not queued
+    bool push(MirEvent const& event);
+
+    /// Consumer side: the next event, or nullptr if the ring is empty
+    EventUPtr pop();
+
+    /// Consumer side: consumes the pending wakeup notification, if any
+    void clear_wakeup();
+
+    /// Consumer side: records that an event that bypassed the ring was handled
+    void bypass_consumed();
+
+    /// Producer side: the number of bypassing events the consumer has handled
+    std::uint32_t bypasses_consumed() const;
+
+private:
+    EventRing(EventRing const&) = delete;
+    EventRing& operator=(EventRing const&) = delete;
+
+    struct Header;
+
+    char* slot(std::uint32_t index) const;
+    std::uint32_t slots_for(std::uint32_t size) const;
+
+    Fd const shm;
+    Fd const wakeup;
+    std::size_t mapping_size;
+    void* mapping;
+    Header* header;
+    std::uint32_t slot_mask;
+    std::uint32_t slot_size;
+};
+}
+}
+
+#endif /* MIR_INPUT_EVENT_RING_H_ */
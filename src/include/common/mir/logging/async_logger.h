@@ -0,0 +1,107 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_LOGGING_ASYNC_LOGGER_H_
+#define MIR_LOGGING_ASYNC_LOGGER_H_
+
+#include "mir/logging/logger.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <iosfwd>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mir
+{
+namespace logging
+{
+/// Writes messages to the console (in the same format as DumbConsoleLogger)
+/// from a background thread.
+///
+/// Each logging thread has its own ring buffer of records, so logging only
+/// takes a lock to wake the writer when that buffer was empty and, once the
+/// records' strings have grown, doesn't allocate. A message is dropped (and
+/// counted) when its thread's buffer is full.
+///
+/// Critical messages are written before log() returns. Less severe messages
+/// logged just before the process crashes may never be written; use
+/// DumbConsoleLogger where those matter more than the cost of logging.
+class AsyncLogger : public Logger
+{
+public:
+    AsyncLogger();
+
+    /// \param max_severity         less severe messages are discarded (before formatting)
+    explicit AsyncLogger(Severity max_severity);
+
+    /// \param max_severity         less severe messages are discarded (before formatting)
+    /// \param records_per_thread   capacity of each thread's buffer
+    /// \param out, err             streams for informational and debug messages, and for the rest
+    AsyncLogger(Severity max_severity, std::size_t records_per_thread, std::ostream& out, std::ostream& err);
+
+    ~AsyncLogger() noexcept;
+
+    void log(Severity severity, std::string const& message, std::string const& component) override;
+
+    void log(char const* component, Severity severity, char const* format, ...) override
+        __attribute__ ((format (printf, 4, 5)));
+
+    /// Write everything logged so far
+    void flush();
+
+private:
+    struct ThreadBuffer;
+
+    AsyncLogger(AsyncLogger const&) = delete;
+    AsyncLogger& operator=(AsyncLogger const&) = delete;
+
+    auto thread_buffer() -> ThreadBuffer&;
+    void append(Severity severity, char const* component, char const* message, std::size_t length);
+    void run_writer();
+    auto pending() -> bool;
+    void write_pending();
+    void write(Severity severity, timespec const& time, std::string const& component, std::string const& message);
+    void write_batch();
+
+    std::uint64_t const id;
+    Severity const max_severity;
+    std::size_t const records_per_thread;
+    std::ostream& out;
+    std::ostream& err;
+
+    std::mutex buffers_mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+    // Held while writing: the output state below belongs to the writer
+    std::mutex write_mutex;
+    std::string batch;
+    std::ostream* batch_stream{nullptr};
+    time_t cached_second{-1};
+    char cached_prefix[32];
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool wake_writer{false};
+    bool stopping{false};
+    std::thread writer;
+};
+}
+}
+
+#endif // MIR_LOGGING_ASYNC_LOGGER_H_
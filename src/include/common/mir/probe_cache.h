@@ -0,0 +1,62 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef MIR_PROBE_CACHE_H_
+#define MIR_PROBE_CACHE_H_
+
+#include <string>
+
+namespace mir
+{
+/// Remembers the module a probe chose, so that while nothing the choice
+/// depends on has changed, later probes can load just that module instead of
+/// loading (and probing) every module on the path.
+///
+/// Results are kept in a file, keyed by a description of whatever the probe
+/// depends on (such as library_fingerprint() of the module path and
+/// device_fingerprint() of the hardware). Failing to read or write the file is
+/// not an error: the cache just misses.
+///
+/// The file is writable by the user, so only a module's name is kept and a
+/// result is only used if a library of that name is in the module path.
+class ProbeCache
+{
+public:
+    /// \param file where results are kept: empty to keep nothing
+    explicit ProbeCache(std::string const& file);
+
+    /// \return the filename of the module chosen for key, if it is one of the
+    ///         libraries in path, or an empty string
+    auto lookup(std::string const& key, std::string const& path) const -> std::string;
+
+    /// Remember that the module in filename was chosen for key
+    void store(std::string const& key, std::string const& filename) const;
+
+private:
+    std::string const file;
+};
+
+/// \return the file for the named cache in the user's cache directory
+///         ($XDG_CACHE_HOME/mir or ~/.cache/mir), or an empty string if there's none
+auto probe_cache_file(std::string const& name) -> std::string;
+
+/// Describes the devices of a subsystem (such as "drm" or "input") from sysfs:
+/// their names, device numbers and PCI IDs.
+auto device_fingerprint(std::string const& subsystem) -> std::string;
+}
+
+#endif // MIR_PROBE_CACHE_H_
@@ -19,18 +19,26 @@
 #ifndef MIR_RECURSIVE_READ_WRITE_MUTEX_H_
 #define MIR_RECURSIVE_READ_WRITE_MUTEX_H_
 
+#include <atomic>
 #include <condition_variable>
-#include <thread>
-#include <vector>
+#include <cstdint>
+#include <mutex>
 
 namespace mir
 {
 /** a recursive read-write mutex.
  * Note that a write lock can be acquired if no other threads have a read lock.
+ *
+ * Each thread keeps its own recursion counts, so recursive locking doesn't
+ * touch shared state. The first read lock on a thread only touches one of a
+ * set of per-thread reader counters, unless a writer is waiting. Waiting
+ * writers take precedence over threads that don't yet hold a read lock.
  */
 class RecursiveReadWriteMutex
 {
 public:
+    RecursiveReadWriteMutex();
+
     void read_lock();
 
     void read_unlock();
@@ -40,17 +48,29 @@ public:
     void write_unlock();
 
 private:
-    std::mutex mutex;
-    std::condition_variable cv;
-    struct ThreadLockCount
+    RecursiveReadWriteMutex(RecursiveReadWriteMutex const&) = delete;
+    RecursiveReadWriteMutex& operator=(RecursiveReadWriteMutex const&) = delete;
+
+    struct ThreadLockCount;
+    auto this_thread_count() -> ThreadLockCount&;
+    void release_this_thread_count();
+    unsigned int total_readers() const;
+
+    static unsigned int const reader_slots = 16;
+    struct ReaderSlot
     {
-        ThreadLockCount() : id(), count(0) {}
-        ThreadLockCount(std::thread::id id, unsigned int count) : id(id), count(count) {}
-        std::thread::id id;
-        unsigned int count;
+        std::atomic<unsigned int> count{0};
+        char padding[64 - sizeof(std::atomic<unsigned int>)];
     };
-    std::vector<ThreadLockCount> read_locking_threads;
-    ThreadLockCount write_locking_thread;
+
+    uint64_t const id;
+    ReaderSlot reader_count[reader_slots];
+    std::atomic<unsigned int> writers_waiting{0};
+
+    std::mutex mutex;
+    std::condition_variable readers_cv;
+    std::condition_variable writers_cv;
+    bool write_locked{false};
 };
 
 class RecursiveReadLock
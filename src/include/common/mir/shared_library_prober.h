@@ -38,6 +38,19 @@ void select_libraries_for_path(
     std::string const& path,
     std::function<Selection(std::shared_ptr<SharedLibrary> const&)> const& selector,
     SharedLibraryProberReport& report);
+
+// As select_libraries_for_path(), for a selector that needs each library's filename too
+void select_named_libraries_for_path(
+    std::string const& path,
+    std::function<Selection(std::string const& filename, std::shared_ptr<SharedLibrary> const&)> const& selector,
+    SharedLibraryProberReport& report);
+
+// The library in path with the given filename (without its directory), or an empty string if there's none
+std::string library_in_path(std::string const& path, std::string const& filename);
+
+// Describes the libraries in path (names, sizes and modification times) without loading them:
+// the description changes if one is added, removed or replaced. Empty if path can't be read.
+std::string library_fingerprint(std::string const& path);
 }
 
 
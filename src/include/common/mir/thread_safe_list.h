@@ -20,29 +20,46 @@
 #ifndef MIR_THREAD_SAFE_LIST_H_
 #define MIR_THREAD_SAFE_LIST_H_
 
-#include "mir/recursive_read_write_mutex.h"
-
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace mir
 {
+namespace detail
+{
+/// The list items whose callbacks are running on the calling thread
+inline std::vector<void const*>& thread_safe_list_items_in_use()
+{
+    static thread_local std::vector<void const*> items;
+    return items;
+}
+}
 
 /*
+ * for_each() works on an immutable, reference-counted snapshot of the items
+ * and doesn't take the list's lock, so iterations don't wait for each other's
+ * callbacks or for changes. Taking the snapshot isn't lock-free, though:
+ * std::atomic_load() of a shared_ptr takes a short lock inside the standard
+ * library while it copies the pointer.
+ * Changes copy the snapshot, modify the copy and publish it.
+ *
+ * As before, an element may be removed from within a callback (including its
+ * own) and, once remove() returns, no callback for the removed element is
+ * running on another thread or will start: remove() blocks until they finish.
+ *
  * Requirements for type 'Element'
  *  - for_each():
- *    - copy-assignable
- *  - add():
- *    - copy-assignable
  *    - conversion to bool: indicates whether this is a valid element
+ *  - add():
+ *    - copy-constructible
  *  - remove(), remove_all():
- *    - copy-assignable
- *    - Element{}: default construction should create an invalid element
  *    - bool operator==: equality of elements
- *    - bool operator!=: inequality of elements
- *  - clear():
- *    - copy-assignable
- *    - Element{}: value initialization should create an invalid element
  */
 
 template<class Element>
@@ -58,128 +75,154 @@ public:
 private:
     struct ListItem
     {
-        ListItem() {}
-        RecursiveReadWriteMutex mutex;
-        Element element{};
-        std::atomic<ListItem*> next{nullptr};
+        explicit ListItem(Element const& element) : element{element} {}
+        Element const element;
+        std::atomic<bool> removed{false};
+        std::atomic<unsigned int> in_use{0};
+        std::mutex unused_mutex;
+        std::condition_variable unused;
+    };
+
+    class ItemInUse
+    {
+    public:
+        explicit ItemInUse(ListItem& item) : item{item}
+        {
+            ++item.in_use;
+            detail::thread_safe_list_items_in_use().push_back(&item);
+        }
+
+        ~ItemInUse()
+        {
+            detail::thread_safe_list_items_in_use().pop_back();
+            --item.in_use;
+
+            // remove() sets "removed" before waiting, so only then can anyone
+            // be waiting for us
+            if (item.removed)
+            {
+                std::lock_guard<std::mutex> lock{item.unused_mutex};
+                item.unused.notify_all();
+            }
+        }
 
-        ~ListItem() { delete next.load(); }
-    } head;
+        ItemInUse(ItemInUse const&) = delete;
+        ItemInUse& operator=(ItemInUse const&) = delete;
+
+    private:
+        ListItem& item;
+    };
+
+    using Items = std::vector<std::shared_ptr<ListItem>>;
+
+    template<typename Predicate>
+    unsigned int remove_if(Predicate const& predicate, bool only_first);
+    static void wait_until_unused(ListItem& item);
+
+    std::mutex mutable change_mutex;
+    std::shared_ptr<Items const> items{std::make_shared<Items const>()};
 };
 
 template<class Element>
 void ThreadSafeList<Element>::for_each(
     std::function<void(Element const& element)> const& f)
 {
-    ListItem* current_item = &head;
+    auto const current = std::atomic_load(&items);
 
-    while (current_item)
+    for (auto const& item : *current)
     {
-        RecursiveReadLock lock{current_item->mutex};
+        // Mark the item in use before checking whether it was removed, so that
+        // a concurrent remove() either sees us or we see it.
+        ItemInUse const in_use{*item};
 
-        // We need to take a copy in case we recursively remove during call
-        if (auto const copy_of_element = current_item->element) f(copy_of_element);
-
-        current_item = current_item->next;
+        if (!item->removed && item->element) f(item->element);
     }
 }
 
 template<class Element>
 void ThreadSafeList<Element>::add(Element const& element)
 {
-    ListItem* current_item = &head;
-
-    do
-    {
-        // Note: we release the read lock to avoid two threads calling add at
-        // the same time mutually blocking the other's upgrade to write lock.
-        {
-            RecursiveReadLock lock{current_item->mutex};
-            if (current_item->element) continue;
-        }
+    std::lock_guard<decltype(change_mutex)> lock{change_mutex};
 
-        RecursiveWriteLock lock{current_item->mutex};
-
-        if (!current_item->element)
-        {
-            current_item->element = element;
-            return;
-        }
-    }
-    while (current_item->next && (current_item = current_item->next));
+    auto const next = std::make_shared<Items>(*items);
+    next->push_back(std::make_shared<ListItem>(element));
 
-    // No empty Items so append a new one
-    auto new_item = new ListItem;
-    new_item->element = element;
-
-    for (ListItem* expected{nullptr};
-        !current_item->next.compare_exchange_weak(expected, new_item);
-        expected = nullptr)
-    {
-        if (expected) current_item = expected;
-    }
+    std::atomic_store(&items, std::shared_ptr<Items const>{next});
 }
 
 template<class Element>
 void ThreadSafeList<Element>::remove(Element const& element)
 {
-    ListItem* current_item = &head;
-
-    do
-    {
-        {
-            RecursiveReadLock lock{current_item->mutex};
-            if (current_item->element != element) continue;
-        }
+    remove_if([&](Element const& candidate) { return candidate == element; }, true);
+}
 
-        RecursiveWriteLock lock{current_item->mutex};
+template<class Element>
+unsigned int ThreadSafeList<Element>::remove_all(Element const& element)
+{
+    return remove_if([&](Element const& candidate) { return candidate == element; }, false);
+}
 
-        if (current_item->element == element)
-        {
-            current_item->element = Element{};
-            return;
-        }
-    }
-    while ((current_item = current_item->next));
+template<class Element>
+void ThreadSafeList<Element>::clear()
+{
+    remove_if([](Element const&) { return true; }, false);
 }
 
 template<class Element>
-unsigned int ThreadSafeList<Element>::remove_all(Element const& element)
+template<typename Predicate>
+unsigned int ThreadSafeList<Element>::remove_if(Predicate const& predicate, bool only_first)
 {
-    ListItem* current_item = &head;
-    auto removed = 0u;
+    Items removed;
 
-    do
     {
-        {
-            RecursiveReadLock lock{current_item->mutex};
-            if (current_item->element != element) continue;
-        }
+        std::lock_guard<decltype(change_mutex)> lock{change_mutex};
 
-        RecursiveWriteLock lock{current_item->mutex};
+        auto const next = std::make_shared<Items>();
+        next->reserve(items->size());
 
-        if (current_item->element == element)
+        for (auto const& item : *items)
         {
-            current_item->element = Element{};
-            ++removed;
+            if ((!only_first || removed.empty()) && predicate(item->element))
+            {
+                item->removed = true;
+                removed.push_back(item);
+            }
+            else
+            {
+                next->push_back(item);
+            }
         }
+
+        if (removed.empty())
+            return 0;
+
+        std::atomic_store(&items, std::shared_ptr<Items const>{next});
     }
-    while ((current_item = current_item->next));
 
-    return removed;
+    for (auto const& item : removed)
+        wait_until_unused(*item);
+
+    return removed.size();
 }
 
 template<class Element>
-void ThreadSafeList<Element>::clear()
+void ThreadSafeList<Element>::wait_until_unused(ListItem& item)
 {
-    ListItem* current_item = &head;
+    // Callbacks for the item further up this thread's stack can't complete
+    // until we return, so we only wait for those on other threads.
+    auto const& in_use_here = detail::thread_safe_list_items_in_use();
+    unsigned int const uses_here = std::count(in_use_here.begin(), in_use_here.end(), &item);
 
-    do
+    // Most callbacks are short, so spin briefly before blocking
+    for (int spins = 0; spins != 100; ++spins)
     {
-        RecursiveWriteLock lock{current_item->mutex};
-        current_item->element = Element{};
+        if (item.in_use <= uses_here)
+            return;
+        std::this_thread::yield();
     }
-    while ((current_item = current_item->next));
+
+    std::unique_lock<std::mutex> lock{item.unused_mutex};
+    item.unused.wait(lock, [&] { return item.in_use <= uses_here; });
 }
 
 }
@@ -0,0 +1,224 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_WORK_QUEUE_H_
+#define MIR_WORK_QUEUE_H_
+
+#include <atomic>
+#include <functional>
+
+namespace mir
+{
+namespace detail
+{
+struct WorkQueueNode
+{
+    WorkQueueNode* next;
+    std::function<void()> work;
+};
+
+/*
+ * Nodes are recycled through a process-wide free list: a thread that pushes
+ * work takes the whole list for itself when it runs out, so nothing is popped
+ * singly (and there's no ABA problem). Together with std::function storing
+ * small closures inline, a steady flow of work doesn't touch the heap.
+ */
+class WorkQueueNodes
+{
+public:
+    static auto allocate(std::function<void()>&& work) -> WorkQueueNode*
+    {
+        auto& local = thread_nodes();
+
+        if (!local.nodes)
+        {
+            local.nodes = free_nodes().exchange(nullptr, std::memory_order_acquire);
+
+            int taken{0};
+            for (auto node = local.nodes; node; node = node->next)
+                ++taken;
+            free_node_count().fetch_sub(taken, std::memory_order_relaxed);
+        }
+
+        if (auto const node = local.nodes)
+        {
+            local.nodes = node->next;
+            node->next = nullptr;
+            node->work = std::move(work);
+            return node;
+        }
+
+        return new WorkQueueNode{nullptr, std::move(work)};
+    }
+
+    static void release(WorkQueueNode* node)
+    {
+        node->work = nullptr;
+
+        if (free_node_count().fetch_add(1, std::memory_order_relaxed) >= max_free_nodes)
+        {
+            free_node_count().fetch_sub(1, std::memory_order_relaxed);
+            delete node;
+            return;
+        }
+
+        node->next = free_nodes().load(std::memory_order_relaxed);
+        while (!free_nodes().compare_exchange_weak(
+            node->next, node, std::memory_order_release, std::memory_order_relaxed))
+            ;
+    }
+
+private:
+    static int const max_free_nodes = 1024;
+
+    struct ThreadNodes
+    {
+        WorkQueueNode* nodes{nullptr};
+
+        ~ThreadNodes()
+        {
+            while (auto const node = nodes)
+            {
+                nodes = node->next;
+                delete node;
+            }
+        }
+    };
+
+    static auto thread_nodes() -> ThreadNodes&
+    {
+        static thread_local ThreadNodes nodes;
+        return nodes;
+    }
+
+    static auto free_nodes() -> std::atomic<WorkQueueNode*>&
+    {
+        static std::atomic<WorkQueueNode*> nodes{nullptr};
+        return nodes;
+    }
+
+    static auto free_node_count() -> std::atomic<int>&
+    {
+        static std::atomic<int> count{0};
+        return count;
+    }
+};
+}
+
+/*
+ * A lock-free queue of work with many producers and one consumer.
+ *
+ * push() reports when it made the queue non-empty, so the consumer need only
+ * be woken then; run_all() runs everything queued so far, oldest first.
+ * Work queued while run_all() is running is left for the next call.
+ */
+class WorkQueue
+{
+public:
+    WorkQueue() = default;
+
+    ~WorkQueue()
+    {
+        release_all(pushed.exchange(nullptr, std::memory_order_acquire));
+        release_all(backlog);
+    }
+
+    /// Add work to the queue (from any thread)
+    /// \return true if the queue was empty: the consumer needs waking
+    bool push(std::function<void()>&& work)
+    {
+        auto const node = detail::WorkQueueNodes::allocate(std::move(work));
+
+        // Once published the node belongs to the consumer, so don't read it back
+        auto head = pushed.load(std::memory_order_relaxed);
+        do
+        {
+            node->next = head;
+        }
+        while (!pushed.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+
+        return !head;
+    }
+
+    /// Run the work queued so far, by calling run(work) for each item.
+    ///
+    /// Only the consumer may call this (on one thread at a time). If run
+    /// throws, the remaining work stays queued for the next call.
+    template<typename Run>
+    void run_all(Run&& run)
+    {
+        // Work is pushed newest first: reverse it onto the end of the backlog
+        WorkQueueNode* newest_first = pushed.exchange(nullptr, std::memory_order_acquire);
+        WorkQueueNode* oldest_first{nullptr};
+        WorkQueueNode* last{newest_first};
+
+        while (auto const node = newest_first)
+        {
+            newest_first = node->next;
+            node->next = oldest_first;
+            oldest_first = node;
+        }
+
+        if (!backlog)
+        {
+            backlog = oldest_first;
+        }
+        else if (oldest_first)
+        {
+            backlog_tail->next = oldest_first;
+        }
+
+        if (oldest_first)
+        {
+            backlog_tail = last;
+        }
+
+        while (auto const node = backlog)
+        {
+            backlog = node->next;
+
+            struct Release
+            {
+                WorkQueueNode* const node;
+                ~Release() { detail::WorkQueueNodes::release(node); }
+            } const release{node};
+
+            run(node->work);
+        }
+    }
+
+private:
+    WorkQueue(WorkQueue const&) = delete;
+    WorkQueue& operator=(WorkQueue const&) = delete;
+
+    using WorkQueueNode = detail::WorkQueueNode;
+
+    static void release_all(WorkQueueNode* nodes)
+    {
+        while (auto const node = nodes)
+        {
+            nodes = node->next;
+            detail::WorkQueueNodes::release(node);
+        }
+    }
+
+    std::atomic<WorkQueueNode*> pushed{nullptr};    // newest first
+    WorkQueueNode* backlog{nullptr};                // oldest first; consumer only
+    WorkQueueNode* backlog_tail{nullptr};
+};
+}
+
+#endif // MIR_WORK_QUEUE_H_
@@ -27,6 +27,8 @@
 namespace mir
 {
 class ConsoleServices;
+class ProbeCache;
+class SharedLibraryProberReport;
 
 namespace graphics
 {
@@ -37,6 +39,20 @@ std::shared_ptr<SharedLibrary> module_for_device(
     options::ProgramOption const& options,
     std::shared_ptr<ConsoleServices> const& console);
 
+/**
+ * Choose the module for the device from those in path.
+ *
+ * If the cache holds the choice made when the modules and DRM devices were
+ * the same, only that module is loaded (and probed, to confirm it is still
+ * usable). Otherwise every module is loaded and probed, and the choice cached.
+ */
+std::shared_ptr<SharedLibrary> module_for_device(
+    std::string const& path,
+    ProbeCache const& cache,
+    options::ProgramOption const& options,
+    std::shared_ptr<ConsoleServices> const& console,
+    SharedLibraryProberReport& report);
+
 }
 }
 
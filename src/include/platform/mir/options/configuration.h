@@ -51,8 +51,10 @@ extern char const* const touchspots_opt;
 extern char const* const cursor_opt;
 extern char const* const fatal_except_opt;
 extern char const* const debug_opt;
+extern char const* const log_severity_opt;
 extern char const* const composite_delay_opt;
 extern char const* const enable_key_repeat_opt;
+extern char const* const touch_resampling_opt;
 extern char const* const x11_display_opt;
 extern char const* const wayland_extensions_opt;
 extern char const* const wayland_extensions_value;
@@ -69,6 +71,7 @@ extern char const* const lttng_opt_value;
 extern char const* const platform_graphics_lib;
 extern char const* const platform_input_lib;
 extern char const* const platform_path;
+extern char const* const platform_probe_cache_opt;
 
 extern char const* const console_provider;
 extern char const* const logind_console;
@@ -91,6 +91,10 @@ namespace time
 {
 class Clock;
 }
+namespace thread
+{
+class WorkStealingThreadPool;
+}
 namespace scene
 {
 class SurfaceFactory;
@@ -138,6 +142,7 @@ class InputDeviceHub;
 class DefaultInputDeviceHub;
 class CompositeEventFilter;
 class EventFilterChainDispatcher;
+class TouchResamplingDispatcher;
 class CursorListener;
 class TouchVisualizer;
 class CursorImages;
@@ -320,6 +325,7 @@ public:
     virtual std::shared_ptr<input::CompositeEventFilter> the_composite_event_filter();
 
     virtual std::shared_ptr<input::EventFilterChainDispatcher> the_event_filter_chain_dispatcher();
+    virtual std::shared_ptr<input::TouchResamplingDispatcher> the_touch_resampling_dispatcher();
 
     virtual std::shared_ptr<shell::InputTargeter> the_input_targeter();
     virtual std::shared_ptr<input::Scene>  the_input_scene();
@@ -343,6 +349,8 @@ public:
 
     virtual std::shared_ptr<time::Clock> the_clock();
     virtual std::shared_ptr<ServerActionQueue> the_server_action_queue();
+    /// Shared pool for short-lived background tasks (such as snapshots)
+    virtual std::shared_ptr<thread::WorkStealingThreadPool> the_background_thread_pool();
     virtual std::shared_ptr<SharedLibraryProberReport>  the_shared_library_prober_report();
 
     virtual std::shared_ptr<ConsoleServices> the_console_services();
@@ -387,6 +395,7 @@ protected:
 
     CachedPtr<input::InputReport> input_report;
     CachedPtr<input::EventFilterChainDispatcher> event_filter_chain_dispatcher;
+    CachedPtr<input::TouchResamplingDispatcher> touch_resampling_dispatcher;
     CachedPtr<input::CompositeEventFilter> composite_event_filter;
     CachedPtr<input::InputManager>    input_manager;
     CachedPtr<input::SurfaceInputDispatcher>    surface_input_dispatcher;
@@ -432,6 +441,7 @@ protected:
     CachedPtr<graphics::DisplayReport> display_report;
     CachedPtr<time::Clock> clock;
     CachedPtr<MainLoop> main_loop;
+    CachedPtr<thread::WorkStealingThreadPool> background_thread_pool;
     CachedPtr<ServerStatusListener> server_status_listener;
     CachedPtr<graphics::DisplayConfigurationPolicy> display_configuration_policy;
     CachedPtr<graphics::nested::MirClientHostConnection> host_connection;
@@ -21,8 +21,11 @@
 
 #include "mir/time/clock.h"
 #include "mir/thread_safe_list.h"
+#include "mir/timer_wheel.h"
 #include "mir/fd.h"
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <vector>
 #include <mutex>
@@ -73,12 +76,70 @@ void add_server_action_gsource(
     std::function<void()> const& action,
     std::function<bool(void const*)> const& should_dispatch);
 
-GSourceHandle add_timer_gsource(
-    GMainContext* main_context,
-    std::shared_ptr<time::Clock> const& clock,
-    std::shared_ptr<LockableCallback> const& handler,
-    std::function<void()> const& exception_handler,
-    time::Timestamp target_time);
+/**
+ * Dispatches all of a main loop's alarms from a single GSource
+ *
+ * Pending timers live in a TimerWheel with millisecond ticks, so scheduling
+ * and cancelling are O(1), rescheduling doesn't allocate, and the main loop
+ * only ever waits for the earliest deadline.
+ */
+class AlarmTimers
+{
+public:
+    class Timer : public TimerWheel::Timer, public std::enable_shared_from_this<Timer>
+    {
+    public:
+        Timer(
+            std::shared_ptr<LockableCallback> const& handler,
+            std::function<void()> const& exception_handler);
+
+    private:
+        friend class AlarmTimers;
+
+        std::shared_ptr<LockableCallback> const handler;
+        std::function<void()> const exception_handler;
+        std::atomic<std::uint64_t> generation;
+        std::recursive_mutex dispatch_mutex;
+    };
+
+    AlarmTimers(GMainContext* main_context, std::shared_ptr<time::Clock> const& clock);
+    ~AlarmTimers();
+
+    /// Schedule (or reschedule) timer to dispatch at target_time
+    void schedule(Timer& timer, time::Timestamp target_time);
+
+    /// Cancel timer, waiting for any dispatch in progress on another thread to complete
+    void ensure_no_further_dispatch(Timer& timer);
+
+private:
+    struct TimerGSource;
+    struct Due
+    {
+        std::shared_ptr<Timer> timer;
+        std::uint64_t generation;
+    };
+
+    AlarmTimers(AlarmTimers const&) = delete;
+    AlarmTimers& operator=(AlarmTimers const&) = delete;
+
+    TimerWheel::Tick tick_for(time::Timestamp time_point) const;
+    TimerWheel::Tick current_tick() const;
+    bool advance();
+    int timeout_for_next_expiry() const;
+    void dispatch();
+
+    GMainContext* const main_context;
+    std::shared_ptr<time::Clock> const clock;
+    time::Timestamp const epoch;
+
+    std::mutex mutex;
+    TimerWheel wheel;
+    std::vector<TimerWheel::Timer*> expired;
+    std::vector<Due> due;
+    std::vector<Due> dispatching;
+
+    GSource* const gsource;
+};
 
 class FdSources
 {
@@ -20,21 +20,23 @@
 #define MIR_SCENE_SIMPLE_OBSERVER_H_
 
 #include "mir/scene/observer.h"
+#include "mir/geometry/rectangle.h"
 
 #include <functional>
 #include <map>
 #include <mutex>
+#include <thread>
 
 namespace mir
 {
-namespace geometry { struct Rectangle; }
 namespace scene
 {
 class SurfaceObserver;
 
 // A simple implementation of surface observer which forwards all changes to a provided callback.
 // Also installs surface observers on each added surface which in turn forward each change to 
-// said callback.
+// said callback. Scene changes made by a scene transaction are coalesced into a single callback
+// when the transaction ends; new frames from clients are always passed on immediately.
 class LegacySceneChangeNotification : public Observer
 {
 public:
@@ -57,6 +59,9 @@ public:
     void surface_exists(Surface* surface) override;
     void end_observation() override;
 
+    void transaction_begun() override;
+    void transaction_ended() override;
+
 private:
     std::function<void()> const scene_notify_change;
     std::function<void(int)> const buffer_notify_change;
@@ -66,6 +71,15 @@ private:
     std::map<Surface*, std::weak_ptr<SurfaceObserver>> surface_observers;
     
     void add_surface_observer(Surface* surface);
+
+    void notify_scene_change();
+    void notify_buffer_change(int frames);
+    void notify_damage_change(int frames, mir::geometry::Rectangle const& damage);
+
+    std::mutex transaction_guard;
+    int transaction_depth{0};
+    std::thread::id transaction_thread;
+    bool scene_change_deferred{false};
 };
 
 }
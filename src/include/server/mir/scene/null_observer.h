@@ -41,6 +41,9 @@ public:
     // unregister SurfaceObservers which may have been added in surface_added/exists
     void end_observation();
 
+    void transaction_begun();
+    void transaction_ended();
+
 protected:
     NullObserver(NullObserver const&) = delete;
     NullObserver& operator=(NullObserver const&) = delete;
@@ -22,17 +22,32 @@
 #include "mir/scene/null_surface_observer.h"
 #include "mir/frontend/surface_id.h"
 #include "mir/frontend/event_sink.h"
+#include "mir/geometry/size.h"
+#include "mir/optional_value.h"
 
+#include <chrono>
 #include <memory>
+#include <mutex>
 
 namespace mir
 {
+namespace time
+{
+class Alarm;
+class AlarmFactory;
+}
 namespace scene
 {
 class Surface;
 class OutputProperties;
 class OutputPropertiesCache;
 
+/// Forwards surface changes to the client as events.
+///
+/// Resize events are paced to the client: once one has been sent, further
+/// resizes are held back until the client posts a frame or resize_timeout
+/// passes, and only the latest of them is sent. This stops a slow client
+/// falling many sizes behind during an interactive resize.
 class SurfaceEventSource : public NullSurfaceObserver
 {
 public:
@@ -40,10 +55,13 @@ public:
         frontend::SurfaceId id,
         Surface const& surface,
         OutputPropertiesCache const& outputs,
-        std::shared_ptr<frontend::EventSink> const& event_sink);
+        std::shared_ptr<frontend::EventSink> const& event_sink,
+        time::AlarmFactory& alarm_factory);
+    ~SurfaceEventSource();
 
     void attrib_changed(Surface const* surf, MirWindowAttrib attrib, int value) override;
     void resized_to(Surface const* surf, geometry::Size const& size) override;
+    void frame_posted(Surface const* surf, int frames_available, geometry::Size const& size) override;
     void moved_to(Surface const* surf, geometry::Point const& top_left) override;
     void orientation_set_to(Surface const* surf, MirOrientation orientation) override;
     void client_surface_close_requested(Surface const* surf) override;
@@ -64,6 +82,19 @@ private:
     OutputPropertiesCache const& outputs;
     std::weak_ptr<OutputProperties const> last_output;
     std::shared_ptr<frontend::EventSink> const event_sink;
+
+    static std::chrono::milliseconds const resize_timeout;
+
+    // Held while a resize event is sent, so they reach the client in order
+    std::mutex resize_mutex;
+    bool resize_outstanding{false};
+    optional_value<geometry::Size> held_resize;
+
+    // Sends the held resize (if any) when the client doesn't post a frame in time
+    void release_held_resize();
+
+    // Declared last, so it is destroyed (waiting for a running callback) first
+    std::unique_ptr<time::Alarm> const resize_alarm;
 };
 }
 }
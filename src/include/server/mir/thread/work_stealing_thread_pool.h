@@ -0,0 +1,107 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_THREAD_WORK_STEALING_THREAD_POOL_H_
+#define MIR_THREAD_WORK_STEALING_THREAD_POOL_H_
+
+#include "mir/executor.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mir
+{
+namespace thread
+{
+
+/**
+ * A fixed size pool of threads for short-lived background tasks.
+ *
+ * Each worker owns a lock-free deque. Tasks spawned by a worker go onto its
+ * own deque; tasks spawned from other threads go onto a shared queue. A worker
+ * takes the newest task from its own deque, then the oldest from the shared
+ * queue, and otherwise steals the oldest task from another worker. An idle
+ * worker spins briefly before sleeping. Workers keep the storage of tasks
+ * they have run to reuse for tasks they spawn.
+ *
+ * Unlike BasicThreadPool there are no futures, and tasks are not tied to a
+ * thread: it is unsuitable for tasks that block for long periods. Tasks still
+ * queued when the pool is destroyed are run before the destructor returns.
+ */
+class WorkStealingThreadPool : public Executor
+{
+public:
+    /// \param [in] threads  number of workers (at least one is started)
+    /// \param [in] name     thread name given to the workers
+    WorkStealingThreadPool(int threads, std::string const& name);
+    ~WorkStealingThreadPool();
+
+    void spawn(std::function<void()>&& work) override;
+
+    struct Statistics
+    {
+        uint64_t spawned;       ///< tasks submitted
+        uint64_t executed;      ///< tasks run to completion (or exception)
+        uint64_t stolen;        ///< tasks taken from another worker's deque
+        uint64_t queued;        ///< tasks waiting to run
+    };
+
+    auto statistics() const -> Statistics;
+
+private:
+    WorkStealingThreadPool(WorkStealingThreadPool const&) = delete;
+    WorkStealingThreadPool& operator=(WorkStealingThreadPool const&) = delete;
+
+    class TaskDeque;
+    using Task = std::function<void()>;
+
+    void run_worker(size_t index) noexcept;
+    auto find_task(size_t index, Task& task) -> bool;
+    void execute(Task& task);
+
+    std::vector<std::unique_ptr<TaskDeque>> deques;
+
+    std::mutex shared_mutex;
+    std::deque<Task> shared_queue;
+    std::atomic<uint64_t> shared_queued{0};
+
+    // Workers sleep on this once they run out of work
+    std::mutex sleep_mutex;
+    std::condition_variable wakeup;
+    std::atomic<int> sleepers{0};
+    bool stopping{false};
+
+    std::atomic<uint64_t> pending{0};
+    std::atomic<uint64_t> spawned{0};
+    std::atomic<uint64_t> executed{0};
+    std::atomic<uint64_t> stolen{0};
+
+    // Declared last so the workers start once everything else is initialized
+    std::vector<std::thread> workers;
+};
+
+}
+}
+
+#endif // MIR_THREAD_WORK_STEALING_THREAD_POOL_H_
@@ -0,0 +1,120 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_TIMER_WHEEL_H_
+#define MIR_TIMER_WHEEL_H_
+
+#include "mir/optional_value.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace mir
+{
+namespace detail
+{
+/**
+ * A hierarchical timer wheel
+ *
+ * Timers are intrusive, so scheduling, rescheduling and cancelling are O(1)
+ * and never allocate. Time is measured in abstract ticks that only move
+ * forward through advance_to().
+ *
+ * \note TimerWheel is not threadsafe; callers must provide their own locking.
+ */
+class TimerWheel
+{
+public:
+    using Tick = std::uint64_t;
+    class Timer;
+
+private:
+    struct Slot
+    {
+        Timer* head{nullptr};
+        Timer* tail{nullptr};
+        int level{0};
+        int index{0};
+    };
+
+public:
+    class Timer
+    {
+    public:
+        Timer() = default;
+
+        bool scheduled() const { return slot != nullptr; }
+        Tick deadline() const { return deadline_; }
+
+    private:
+        friend class TimerWheel;
+
+        Timer(Timer const&) = delete;
+        Timer& operator=(Timer const&) = delete;
+
+        Timer* prev{nullptr};
+        Timer* next{nullptr};
+        Slot* slot{nullptr};
+        Tick deadline_{0};
+    };
+
+    TimerWheel();
+
+    /// The tick the wheel has been advanced to
+    Tick now() const;
+
+    /// Schedule (or reschedule) a timer; deadlines in the past expire on the next advance_to()
+    void schedule(Timer& timer, Tick deadline);
+
+    /// Cancel a timer; has no effect on an unscheduled timer
+    void cancel(Timer& timer);
+
+    /**
+     * The earliest tick at which advance_to() may have work to do
+     *
+     * This is exact for timers due within the next level-0 rotation; further
+     * out it may be a tick at which timers move to a finer-grained level.
+     */
+    optional_value<Tick> next_expiry() const;
+
+    /// Advance to tick, appending (now unscheduled) timers with deadline <= tick to expired
+    void advance_to(Tick tick, std::vector<Timer*>& expired);
+
+private:
+    TimerWheel(TimerWheel const&) = delete;
+    TimerWheel& operator=(TimerWheel const&) = delete;
+
+    static int const bits_per_level = 6;
+    static int const slots_per_level = 1 << bits_per_level;
+    static int const levels = 5;
+    static int const overflow_level = levels;
+
+    void link(Slot& slot, Timer& timer);
+    void unlink(Timer& timer);
+    void place(Timer& timer);
+    void cascade(Slot& slot);
+    optional_value<Tick> next_event() const;
+
+    Tick now_{0};
+    std::array<std::array<Slot, slots_per_level>, levels> slots;
+    std::array<std::uint64_t, levels> occupied;
+    Slot overflow;
+};
+}
+}
+
+#endif /* MIR_TIMER_WHEEL_H_ */
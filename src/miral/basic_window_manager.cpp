@@ -21,6 +21,7 @@
 
 #include "miral/window_manager_tools.h"
 
+#include <mir/log.h>
 #include <mir/scene/session.h>
 #include <mir/scene/surface.h>
 #include <mir/scene/surface_creation_parameters.h>
@@ -31,6 +32,8 @@
 #include <boost/throw_exception.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <stdexcept>
 
 using namespace mir;
 using namespace mir::geometry;
@@ -38,24 +41,41 @@ using namespace mir::geometry;
 namespace
 {
 int const title_bar_height = 12;
+
+// Holding the lock for longer than a frame delays input handling noticeably
+std::chrono::milliseconds const long_lock_hold{16};
 }
 
 struct miral::BasicWindowManager::Locker
 {
-    explicit Locker(miral::BasicWindowManager* self);
+    Locker(miral::BasicWindowManager* self, char const* operation);
 
     ~Locker()
     {
         policy->advise_end();
+
+        auto const held = std::chrono::steady_clock::now() - acquired;
+
+        if (held > long_lock_hold)
+        {
+            mir::log_debug(
+                "Window management lock held for %lldus by %s",
+                static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(held).count()),
+                operation);
+        }
     }
 
     std::lock_guard<std::mutex> const lock;
     WindowManagementPolicy* const policy;
+    char const* const operation;
+    std::chrono::steady_clock::time_point const acquired;
 };
 
-miral::BasicWindowManager::Locker::Locker(BasicWindowManager* self) :
+miral::BasicWindowManager::Locker::Locker(BasicWindowManager* self, char const* operation) :
     lock{self->mutex},
-    policy{self->policy.get()}
+    policy{self->policy.get()},
+    operation{operation},
+    acquired{std::chrono::steady_clock::now()}
 {
     policy->advise_begin();
     std::vector<std::weak_ptr<Workspace>> workspaces;
@@ -93,15 +113,15 @@ miral::BasicWindowManager::~BasicWindowManager()
 }
 void miral::BasicWindowManager::add_session(std::shared_ptr<scene::Session> const& session)
 {
-    Locker lock{this};
-    policy->advise_new_app(app_info[session] = ApplicationInfo(session));
+    Locker lock{this, __func__};
+    policy->advise_new_app(app_info[session.get()] = ApplicationInfo(session));
 }
 
 void miral::BasicWindowManager::remove_session(std::shared_ptr<scene::Session> const& session)
 {
-    Locker lock{this};
-    policy->advise_delete_app(app_info[session]);
-    app_info.erase(session);
+    Locker lock{this, __func__};
+    policy->advise_delete_app(app_info[session.get()]);
+    app_info.erase(session.get());
 }
 
 auto miral::BasicWindowManager::add_surface(
@@ -110,7 +130,7 @@ auto miral::BasicWindowManager::add_surface(
     std::function<frontend::SurfaceId(std::shared_ptr<scene::Session> const& session, scene::SurfaceCreationParameters const& params)> const& build)
 -> frontend::SurfaceId
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
 
     auto& session_info = info_for(session);
 
@@ -118,8 +138,10 @@ auto miral::BasicWindowManager::add_surface(
     scene::SurfaceCreationParameters parameters;
     spec.update(parameters);
     auto const surface_id = build(session, parameters);
-    Window const window{session, session->surface(surface_id)};
-    auto& window_info = this->window_info.emplace(window, WindowInfo{window, spec}).first->second;
+    auto const surface = session->surface(surface_id);
+    Window const window{session, surface};
+    auto& window_info = this->window_info.emplace(window, SurfaceInfo{window, spec, surface.get()}).first->second;
+    surface_windows[surface.get()] = window;
 
     if (spec.parent().is_set() && spec.parent().value().lock())
         window_info.parent(info_for(spec.parent().value()).window());
@@ -158,7 +180,7 @@ auto miral::BasicWindowManager::add_surface(
     std::shared_ptr<scene::Surface> const scene_surface = window_info.window();
     scene_surface->add_observer(std::make_shared<shell::SurfaceReadyObserver>(
         [this, &window_info](std::shared_ptr<scene::Session> const&, std::shared_ptr<scene::Surface> const&)
-            { Locker lock{this}; policy->handle_window_ready(window_info); },
+            { Locker lock{this, "handle_window_ready"}; policy->handle_window_ready(window_info); },
         session,
         scene_surface));
 
@@ -177,7 +199,7 @@ void miral::BasicWindowManager::modify_surface(
     std::shared_ptr<scene::Surface> const& surface,
     shell::SurfaceSpecification const& modifications)
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
     auto& info = info_for(surface);
     WindowSpecification mods{modifications};
     validate_modification_request(mods, info);
@@ -189,7 +211,7 @@ void miral::BasicWindowManager::remove_surface(
     std::shared_ptr<scene::Session> const& session,
     std::weak_ptr<scene::Surface> const& surface)
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
     try
     {
         remove_window(session, info_for(surface));
@@ -301,7 +323,15 @@ void miral::BasicWindowManager::erase(miral::WindowInfo const& info)
     for (auto& child : info.children())
         info_for(child).parent({});
 
-    window_info.erase(info.window());
+    // All the WindowInfo we hand out are elements of window_info
+    auto const surface_window = surface_windows.find(static_cast<SurfaceInfo const&>(info).surface);
+
+    // Another surface may have been added at the same address since this one went
+    if (surface_window != surface_windows.end() && surface_window->second == info.window())
+        surface_windows.erase(surface_window);
+
+    // Copy the window, as erasing the info destroys info.window()
+    window_info.erase(Window{info.window()});
 }
 
 #pragma GCC diagnostic push
@@ -319,21 +349,21 @@ void miral::BasicWindowManager::remove_display(geometry::Rectangle const& /*area
 
 bool miral::BasicWindowManager::handle_keyboard_event(MirKeyboardEvent const* event)
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
     update_event_timestamp(event);
     return policy->handle_keyboard_event(event);
 }
 
 bool miral::BasicWindowManager::handle_touch_event(MirTouchEvent const* event)
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
     update_event_timestamp(event);
     return policy->handle_touch_event(event);
 }
 
 bool miral::BasicWindowManager::handle_pointer_event(MirPointerEvent const* event)
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
     update_event_timestamp(event);
 
     cursor = {
@@ -348,7 +378,7 @@ void miral::BasicWindowManager::handle_raise_surface(
     std::shared_ptr<scene::Surface> const& surface,
     uint64_t timestamp)
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
     if (timestamp >= last_input_event_timestamp)
         policy->handle_raise_window(info_for(surface));
 }
@@ -358,7 +388,7 @@ void miral::BasicWindowManager::handle_request_drag_and_drop(
     std::shared_ptr<mir::scene::Surface> const& surface,
     uint64_t timestamp)
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
     if (timestamp >= last_input_event_timestamp)
         policy->handle_request_drag_and_drop(info_for(surface));
 }
@@ -424,7 +454,7 @@ int miral::BasicWindowManager::set_surface_attribute(
         return surface->configure(attrib, value);
     }
 
-    Locker lock{this};
+    Locker lock{this, __func__};
     auto& info = info_for(surface);
 
     validate_modification_request(modification, info);
@@ -470,7 +500,7 @@ auto miral::BasicWindowManager::find_application(std::function<bool(ApplicationI
     {
         if (predicate(info.second))
         {
-            return Application{info.first};
+            return info.second.application();
         }
     }
 
@@ -480,19 +510,26 @@ auto miral::BasicWindowManager::find_application(std::function<bool(ApplicationI
 auto miral::BasicWindowManager::info_for(std::weak_ptr<scene::Session> const& session) const
 -> ApplicationInfo&
 {
-    return const_cast<ApplicationInfo&>(app_info.at(session));
+    return const_cast<ApplicationInfo&>(app_info.at(session.lock().get()));
 }
 
 auto miral::BasicWindowManager::info_for(std::weak_ptr<scene::Surface> const& surface) const
 -> WindowInfo&
 {
-    return const_cast<WindowInfo&>(window_info.at(surface));
+    auto const live_surface = surface.lock();
+    auto const window = surface_windows.find(live_surface.get());
+
+    // The window found may be for an earlier surface at the same address, that has gone
+    if (!live_surface || window == surface_windows.end() || window->second != live_surface)
+        BOOST_THROW_EXCEPTION(std::out_of_range{"No window info for surface"});
+
+    return info_for(window->second);
 }
 
 auto miral::BasicWindowManager::info_for(Window const& window) const
 -> WindowInfo&
 {
-    return info_for(std::weak_ptr<mir::scene::Surface>(window));
+    return const_cast<SurfaceInfo&>(window_info.at(window));
 }
 
 void miral::BasicWindowManager::ask_client_to_close(Window const& window)
@@ -789,6 +826,12 @@ void miral::BasicWindowManager::move_tree(miral::WindowInfo& root, mir::geometry
 }
 
 void miral::BasicWindowManager::modify_window(WindowInfo& window_info, WindowSpecification const& modifications)
+{
+    // Moves, resizes and state changes of the window and its children become a single scene update
+    focus_controller->apply_transaction([&] { apply_modifications(window_info, modifications); });
+}
+
+void miral::BasicWindowManager::apply_modifications(WindowInfo& window_info, WindowSpecification const& modifications)
 {
     WindowInfo window_info_tmp{window_info};
 
@@ -1242,7 +1285,7 @@ void miral::BasicWindowManager::update_event_timestamp(MirInputEvent const* iev)
 
 void miral::BasicWindowManager::invoke_under_lock(std::function<void()> const& callback)
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
     callback();
 }
 
@@ -1355,7 +1398,7 @@ void miral::BasicWindowManager::drag_window(miral::Window const& window, Displac
         return;
     }
 
-    move_tree(window_info, movement);
+    focus_controller->apply_transaction([&] { move_tree(window_info, movement); });
 }
 
 auto miral::BasicWindowManager::can_activate_window_for_session(miral::Application const& session) -> bool
@@ -2110,7 +2153,7 @@ void miral::BasicWindowManager::for_each_window_in_workspace(
 
 void miral::BasicWindowManager::add_display_for_testing(mir::geometry::Rectangle const& area)
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
     outputs.add(area);
 
     update_windows_for_outputs();
@@ -2118,7 +2161,7 @@ void miral::BasicWindowManager::add_display_for_testing(mir::geometry::Rectangle
 
 void miral::BasicWindowManager::advise_output_create(miral::Output const& output)
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
     outputs.add(output.extents());
 
     update_windows_for_outputs();
@@ -2127,7 +2170,7 @@ void miral::BasicWindowManager::advise_output_create(miral::Output const& output
 
 void miral::BasicWindowManager::advise_output_update(miral::Output const& updated, miral::Output const& original)
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
     outputs.remove(original.extents());
     outputs.add(updated.extents());
 
@@ -2137,7 +2180,7 @@ void miral::BasicWindowManager::advise_output_update(miral::Output const& update
 
 void miral::BasicWindowManager::advise_output_delete(miral::Output const& output)
 {
-    Locker lock{this};
+    Locker lock{this, __func__};
     outputs.remove(output.extents());
 
     update_windows_for_outputs();
@@ -2146,54 +2189,57 @@ void miral::BasicWindowManager::advise_output_delete(miral::Output const& output
 
 void miral::BasicWindowManager::update_windows_for_outputs()
 {
-    for (auto const& window : fullscreen_surfaces)
-    {
-        if (window)
+    focus_controller->apply_transaction([this]
         {
-            auto& info = info_for(window);
-            auto const rect =
-                policy->confirm_placement_on_display(info, mir_window_state_fullscreen, fullscreen_rect_for(info));
-            place_and_size(info, rect.top_left, rect.size);
-        }
-    }
-
-    if (outputs.size() == 0)
-        return;
-
-    auto const display_area = outputs.bounding_rectangle();
+            for (auto const& window : fullscreen_surfaces)
+            {
+                if (window)
+                {
+                    auto& info = info_for(window);
+                    auto const rect =
+                        policy->confirm_placement_on_display(info, mir_window_state_fullscreen, fullscreen_rect_for(info));
+                    place_and_size(info, rect.top_left, rect.size);
+                }
+            }
 
-    for (auto const& window : maximized_surfaces)
-    {
-        if (window)
-        {
-            auto& info1 = info_for(window);
+            if (outputs.size() == 0)
+                return;
 
-            Rectangle rect{window.top_left(), window.size()};
+            auto const display_area = outputs.bounding_rectangle();
 
-            switch (info1.state())
+            for (auto const& window : maximized_surfaces)
             {
-            case mir_window_state_maximized:
-                rect = policy->confirm_placement_on_display(info1, mir_window_state_maximized, display_area);
-                place_and_size(info1, rect.top_left, rect.size);
-                break;
-
-            case mir_window_state_horizmaximized:
-                rect.top_left.x = display_area.top_left.x;
-                rect.size.width = display_area.size.width;
-                rect = policy->confirm_placement_on_display(info1, mir_window_state_horizmaximized, rect);
-                place_and_size(info1, rect.top_left, rect.size);
-                break;
+                if (window)
+                {
+                    auto& info1 = info_for(window);
 
-            case mir_window_state_vertmaximized:
-                rect.top_left.y = display_area.top_left.y;
-                rect.size.height = display_area.size.height;
-                rect = policy->confirm_placement_on_display(info1, mir_window_state_vertmaximized, rect);
-                place_and_size(info1, rect.top_left, rect.size);
-                break;
+                    Rectangle rect{window.top_left(), window.size()};
 
-            default:
-                break;
+                    switch (info1.state())
+                    {
+                    case mir_window_state_maximized:
+                        rect = policy->confirm_placement_on_display(info1, mir_window_state_maximized, display_area);
+                        place_and_size(info1, rect.top_left, rect.size);
+                        break;
+
+                    case mir_window_state_horizmaximized:
+                        rect.top_left.x = display_area.top_left.x;
+                        rect.size.width = display_area.size.width;
+                        rect = policy->confirm_placement_on_display(info1, mir_window_state_horizmaximized, rect);
+                        place_and_size(info1, rect.top_left, rect.size);
+                        break;
+
+                    case mir_window_state_vertmaximized:
+                        rect.top_left.y = display_area.top_left.y;
+                        rect.size.height = display_area.size.height;
+                        rect = policy->confirm_placement_on_display(info1, mir_window_state_vertmaximized, rect);
+                        place_and_size(info1, rect.top_left, rect.size);
+                        break;
+
+                    default:
+                        break;
+                    }
+                }
             }
-        }
-    }
+        });
 }
@@ -38,6 +38,7 @@
 
 #include <map>
 #include <mutex>
+#include <unordered_map>
 
 namespace mir
 {
@@ -196,8 +197,24 @@ public:
     void invoke_under_lock(std::function<void()> const& callback) override;
 
 private:
-    using SurfaceInfoMap = std::map<std::weak_ptr<mir::scene::Surface>, WindowInfo, std::owner_less<std::weak_ptr<mir::scene::Surface>>>;
-    using SessionInfoMap = std::map<std::weak_ptr<mir::scene::Session>, ApplicationInfo, std::owner_less<std::weak_ptr<mir::scene::Session>>>;
+    // Window info is indexed by the identity of the Window we hand out, which
+    // stays valid (and unique) while the info holds it, even once the surface
+    // has gone. The surface's address is only used to find the Window for a
+    // live surface. Application info holds the session, so its address can't
+    // be reused while indexed. As the containers are node based, references
+    // to the info remain valid until erased.
+    struct SurfaceInfo : WindowInfo
+    {
+        SurfaceInfo(Window const& window, WindowSpecification const& params, mir::scene::Surface const* surface) :
+            WindowInfo{window, params}, surface{surface} {}
+
+        // The key into surface_windows, as it can't be recovered once the surface has gone
+        mir::scene::Surface const* const surface;
+    };
+
+    using SurfaceInfoMap = std::unordered_map<Window, SurfaceInfo>;
+    using SurfaceWindowMap = std::unordered_map<mir::scene::Surface const*, Window>;
+    using SessionInfoMap = std::unordered_map<mir::scene::Session const*, ApplicationInfo>;
 
     mir::shell::FocusController* const focus_controller;
     std::shared_ptr<mir::shell::DisplayLayout> const display_layout;
@@ -217,6 +234,7 @@ private:
     std::mutex mutex;
     SessionInfoMap app_info;
     SurfaceInfoMap window_info;
+    SurfaceWindowMap surface_windows;
     mir::geometry::Rectangles outputs;
     mir::geometry::Point cursor;
     uint64_t last_input_event_timestamp{0};
@@ -250,6 +268,7 @@ private:
     auto place_relative(mir::geometry::Rectangle const& parent, miral::WindowSpecification const& parameters, Size size)
         -> mir::optional_value<Rectangle>;
 
+    void apply_modifications(WindowInfo& window_info, WindowSpecification const& modifications);
     void move_tree(miral::WindowInfo& root, mir::geometry::Displacement movement);
     void erase(miral::WindowInfo const& info);
     void validate_modification_request(WindowSpecification const& modifications, WindowInfo const& window_info) const;
@@ -0,0 +1,657 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "binary_trace.h"
+
+#include <miral/window.h>
+
+#include <mir/scene/surface.h>
+#include <mir/event_printer.h>
+#include <mir/geometry/displacement.h>
+#include <mir/geometry/rectangle.h>
+#include <mir/thread_name.h>
+
+#include <boost/throw_exception.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+using mir::operator<<;
+
+namespace
+{
+char const magic[8] = {'M', 'I', 'R', 'A', 'L', 'W', 'M', 'T'};
+std::uint32_t const version = 1;
+
+std::atomic<std::uint64_t> next_trace_id{0};
+
+using Record = miral::BinaryTrace::Record;
+
+static_assert(std::is_trivially_copyable<Record>::value && sizeof(Record) % sizeof(std::uint64_t) == 0,
+    "A Record is copied as a whole number of words");
+
+// A record in a ring buffer. As write() may copy a slot while its owner
+// overwrites it (and then discard the copy), each word is copied with a
+// relaxed atomic access: with the fences in append() and write() this is
+// the seqlock protocol, without a data race on the record.
+struct Slot
+{
+    static std::size_t const size = sizeof(Record) / sizeof(std::uint64_t);
+    std::atomic<std::uint64_t> words[size];
+
+    void store(Record const& record)
+    {
+        std::uint64_t copy[size];
+        std::memcpy(copy, &record, sizeof copy);
+        for (auto i = 0u; i != size; ++i)
+            words[i].store(copy[i], std::memory_order_relaxed);
+    }
+
+    auto load() const -> Record
+    {
+        std::uint64_t copy[size];
+        for (auto i = 0u; i != size; ++i)
+            copy[i] = words[i].load(std::memory_order_relaxed);
+
+        Record record;
+        std::memcpy(&record, copy, sizeof record);
+        return record;
+    }
+};
+
+// Always string id 0
+char const* const string_table_full{"(string table full)"};
+
+template<typename Value>
+void write_value(std::ostream& out, Value const& value)
+{
+    out.write(reinterpret_cast<char const*>(&value), sizeof value);
+}
+
+template<typename Value>
+void read_value(std::istream& in, Value& value)
+{
+    if (!in.read(reinterpret_cast<char*>(&value), sizeof value))
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Truncated window management trace"});
+}
+
+auto as_float(std::int32_t bits) -> float
+{
+    float result;
+    std::memcpy(&result, &bits, sizeof result);
+    return result;
+}
+
+struct Braced
+{
+    explicit Braced(std::ostream& out) : out{out} { out << '{'; }
+    ~Braced() { out << '}'; }
+
+    template<typename Type>
+    auto append(char const* name, Type const& item) -> Braced&
+    {
+        if (!first_field) out << ", ";
+        if (name) out << name << '=';
+        out << item;
+        first_field = false;
+        return *this;
+    }
+
+    std::ostream& out;
+    bool first_field = true;
+};
+
+// Strings are looked up by id while decoding
+struct BinaryTraceStrings
+{
+    std::vector<std::string> const& strings;
+
+    auto operator[](std::int32_t id) const -> std::string const&
+    {
+        static std::string const unknown{"(unknown)"};
+        return 0 <= id && static_cast<std::size_t>(id) < strings.size() ? strings[id] : unknown;
+    }
+};
+
+auto text_of(BinaryTraceStrings const& strings, miral::BinaryTrace::Arg const& arg) -> std::string
+{
+    using Kind = miral::BinaryTrace::Kind;
+    using namespace mir::geometry;
+
+    auto const& v = arg.value;
+    std::stringstream out;
+
+    switch (arg.kind)
+    {
+    case Kind::none:
+        break;
+
+    case Kind::text:
+        out << strings[v[0]];
+        break;
+
+    case Kind::integer:
+        out << v[0];
+        break;
+
+    case Kind::hex:
+        out << std::hex << static_cast<std::uint32_t>(v[0]);
+        break;
+
+    case Kind::pointer:
+    {
+        auto const pointer = static_cast<std::uint64_t>(static_cast<std::uint32_t>(v[0])) |
+            static_cast<std::uint64_t>(static_cast<std::uint32_t>(v[1])) << 32;
+        if (pointer)
+            out << "0x" << std::hex << pointer;
+        else
+            out << "(nil)";
+        break;
+    }
+
+    case Kind::point:
+        out << Point{v[0], v[1]};
+        break;
+
+    case Kind::size:
+        out << Size{v[0], v[1]};
+        break;
+
+    case Kind::rectangle:
+        out << Rectangle{{v[0], v[1]}, {v[2], v[3]}};
+        break;
+
+    case Kind::displacement:
+        out << Displacement{v[0], v[1]};
+        break;
+
+    case Kind::window_state:
+        out << static_cast<MirWindowState>(v[0]);
+        break;
+
+    case Kind::window_info:
+        Braced{out}
+            .append("name", strings[v[0]])
+            .append("type", static_cast<MirWindowType>(v[1]))
+            .append("state", static_cast<MirWindowState>(v[2]))
+            .append("top_left", Point{v[3], v[4]})
+            .append("size", Size{v[5], v[6]});
+        break;
+
+    case Kind::application_info:
+        Braced{out}
+            .append("application", strings[v[0]])
+            .append("windows", v[1]);
+        break;
+
+    case Kind::window_specification:
+    {
+        using miral::BinaryTrace;
+        Braced spec{out};
+        if (v[0] & BinaryTrace::spec_name) spec.append("name", strings[v[1]]);
+        if (v[0] & BinaryTrace::spec_type) spec.append("type", static_cast<MirWindowType>(v[2]));
+        if (v[0] & BinaryTrace::spec_top_left) spec.append("top_left", Point{v[4], v[5]});
+        if (v[0] & BinaryTrace::spec_size) spec.append("size", Size{v[6], v[7]});
+        if (v[0] & BinaryTrace::spec_state) spec.append("state", static_cast<MirWindowState>(v[3]));
+        break;
+    }
+
+    case Kind::windows:
+    {
+        Braced windows{out};
+        auto const recorded = std::min<std::int32_t>(v[0], 7);
+        for (auto i = 0; i < recorded; ++i)
+            windows.append(nullptr, strings[v[1 + i]]);
+        if (v[0] > recorded)
+            windows.append(nullptr, "...");
+        break;
+    }
+
+    case Kind::keyboard_event:
+    {
+        Braced event{out};
+        event.append("from", v[0])
+            .append("action", static_cast<MirKeyboardAction>(v[1]))
+            .append("code", v[2])
+            .append("scan", v[3]);
+        out << std::hex;
+        event.append("modifiers", static_cast<std::uint32_t>(v[4]));
+        break;
+    }
+
+    case Kind::pointer_event:
+    {
+        Braced event{out};
+        event.append("from", v[0])
+            .append("action", static_cast<MirPointerAction>(v[1]))
+            .append("button_state", static_cast<std::uint32_t>(v[2]))
+            .append("x", as_float(v[3]))
+            .append("y", as_float(v[4]));
+        out << std::hex;
+        event.append("modifiers", static_cast<std::uint32_t>(v[5]));
+        break;
+    }
+
+    case Kind::touch_event:
+    {
+        Braced event{out};
+        event.append("from", v[0]);
+        if (v[1] > 0)
+        {
+            Braced{out}
+                .append("id", v[2])
+                .append("action", static_cast<MirTouchAction>(v[3]))
+                .append("x", as_float(v[4]))
+                .append("y", as_float(v[5]));
+        }
+        out << std::hex;
+        event.append("modifiers", static_cast<std::uint32_t>(v[6]));
+        break;
+    }
+    }
+
+    return out.str();
+}
+}
+
+struct miral::BinaryTrace::ThreadBuffer
+{
+    ThreadBuffer(std::size_t capacity, std::uint32_t thread) :
+        records(capacity),
+        thread{thread}
+    {
+    }
+
+    std::vector<Slot> records;
+    std::atomic<std::uint64_t> started{0};  // set before a record is written...
+    std::atomic<std::uint64_t> next{0};     // ...and this after
+    std::uint32_t const thread;
+
+    // Only used by the owning thread
+    std::unordered_map<char const*, std::uint32_t> literal_ids;
+    std::unordered_map<std::string, std::uint32_t> string_ids;
+    std::unordered_map<Window, std::uint32_t> window_name_ids;
+    std::uint64_t window_names_generation{0};
+};
+
+std::size_t const miral::BinaryTrace::max_args;
+std::size_t const miral::BinaryTrace::default_max_strings;
+
+miral::BinaryTrace::BinaryTrace(std::size_t records_per_thread, std::size_t max_strings) :
+    id{next_trace_id++},
+    records_per_thread{std::max<std::size_t>(records_per_thread, 1)},
+    max_strings{max_strings}
+{
+    string_ids.emplace(string_table_full, 0);
+    strings.push_back(string_table_full);
+}
+
+miral::BinaryTrace::~BinaryTrace() = default;
+
+auto miral::BinaryTrace::thread_buffer() -> ThreadBuffer&
+{
+    // Trace ids are never reused, so entries for destroyed traces never match
+    thread_local std::vector<std::pair<std::uint64_t, ThreadBuffer*>> thread_buffers;
+
+    for (auto const& entry : thread_buffers)
+    {
+        if (entry.first == id)
+            return *entry.second;
+    }
+
+    std::lock_guard<std::mutex> lock{buffers_mutex};
+    buffers.push_back(std::make_unique<ThreadBuffer>(records_per_thread, buffers.size()));
+    thread_buffers.emplace_back(id, buffers.back().get());
+    return *buffers.back();
+}
+
+auto miral::BinaryTrace::intern(std::string const& text) -> std::uint32_t
+{
+    return intern(thread_buffer(), text, true);
+}
+
+auto miral::BinaryTrace::intern(ThreadBuffer& buffer, std::string const& text, bool bounded) -> std::uint32_t
+{
+    auto const cached = buffer.string_ids.find(text);
+    if (cached != buffer.string_ids.end())
+        return cached->second;
+
+    std::uint32_t result;
+    {
+        std::lock_guard<std::mutex> lock{strings_mutex};
+        auto const existing = string_ids.find(text);
+        if (existing != string_ids.end())
+        {
+            result = existing->second;
+        }
+        else if (bounded && strings.size() >= max_strings)
+        {
+            // Not cached, so the thread's cache is bounded by the table
+            return 0;
+        }
+        else
+        {
+            result = strings.size();
+            string_ids.emplace(text, result);
+            strings.push_back(text);
+        }
+    }
+
+    buffer.string_ids.emplace(text, result);
+    return result;
+}
+
+auto miral::BinaryTrace::intern_literal(char const* text) -> std::uint32_t
+{
+    auto& buffer = thread_buffer();
+
+    auto const cached = buffer.literal_ids.find(text);
+    if (cached != buffer.literal_ids.end())
+        return cached->second;
+
+    auto const result = intern(buffer, text, false);
+    buffer.literal_ids.emplace(text, result);
+    return result;
+}
+
+auto miral::BinaryTrace::intern_name_of(Window const& window, mir::scene::Surface const& surface) -> std::uint32_t
+{
+    auto& buffer = thread_buffer();
+
+    auto const generation = window_names_generation.load(std::memory_order_acquire);
+    if (buffer.window_names_generation != generation)
+    {
+        buffer.window_name_ids.clear();
+        buffer.window_names_generation = generation;
+    }
+
+    auto const cached = buffer.window_name_ids.find(window);
+    if (cached != buffer.window_name_ids.end())
+        return cached->second;
+
+    // If the window is renamed after this the generation has changed, and the
+    // id is dropped on the next call
+    auto const result = intern(buffer, surface.name(), true);
+    buffer.window_name_ids.emplace(window, result);
+    return result;
+}
+
+void miral::BinaryTrace::forget_window_names()
+{
+    window_names_generation.fetch_add(1, std::memory_order_release);
+}
+
+void miral::BinaryTrace::append(Record& record)
+{
+    auto& buffer = thread_buffer();
+
+    record.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    record.thread = buffer.thread;
+
+    // As for a seqlock: write() can tell which records it may have copied
+    // while they were being overwritten
+    auto const slot = buffer.next.load(std::memory_order_relaxed);
+    buffer.started.store(slot + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    buffer.records[slot % buffer.records.size()].store(record);
+    buffer.next.store(slot + 1, std::memory_order_release);
+}
+
+auto miral::BinaryTrace::records_appended() const -> std::uint64_t
+{
+    std::lock_guard<std::mutex> lock{buffers_mutex};
+
+    std::uint64_t result = 0;
+    for (auto const& buffer : buffers)
+        result += buffer->next.load(std::memory_order_relaxed);
+
+    return result;
+}
+
+void miral::BinaryTrace::write(std::ostream& out) const
+{
+    std::vector<Record> records;
+    {
+        std::lock_guard<std::mutex> lock{buffers_mutex};
+        for (auto const& buffer : buffers)
+        {
+            auto const end = buffer->next.load(std::memory_order_acquire);
+            auto const size = buffer->records.size();
+            auto const begin = end > size ? end - size : 0;
+            auto const copied = records.size();
+
+            for (auto i = begin; i != end; ++i)
+                records.push_back(buffer->records[i % size].load());
+
+            // Writing the record with index i + size overwrites record i
+            std::atomic_thread_fence(std::memory_order_acquire);
+            auto const started = buffer->started.load(std::memory_order_relaxed);
+            auto const first_intact = started > size ? started - size : 0;
+            if (first_intact > begin)
+                records.erase(records.begin() + copied, records.begin() + copied + (std::min(first_intact, end) - begin));
+        }
+    }
+
+    std::stable_sort(begin(records), end(records),
+        [](Record const& lhs, Record const& rhs) { return lhs.timestamp < rhs.timestamp; });
+
+    out.write(magic, sizeof magic);
+    write_value(out, version);
+    write_value(out, static_cast<std::uint32_t>(sizeof(Record)));
+
+    {
+        std::lock_guard<std::mutex> lock{strings_mutex};
+        write_value(out, static_cast<std::uint32_t>(strings.size()));
+        for (auto const& string : strings)
+        {
+            write_value(out, static_cast<std::uint32_t>(string.size()));
+            out.write(string.data(), string.size());
+        }
+    }
+
+    write_value(out, static_cast<std::uint64_t>(records.size()));
+    for (auto const& record : records)
+        write_value(out, record);
+}
+
+void miral::BinaryTrace::decode(std::istream& in, std::ostream& out)
+{
+    char header[sizeof magic];
+    if (!in.read(header, sizeof header) || !std::equal(header, header + sizeof header, magic))
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Not a window management trace"});
+
+    std::uint32_t file_version;
+    std::uint32_t record_size;
+    read_value(in, file_version);
+    read_value(in, record_size);
+
+    if (file_version != version || record_size != sizeof(Record))
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Unsupported window management trace version"});
+
+    std::uint32_t string_count;
+    read_value(in, string_count);
+
+    std::vector<std::string> strings;
+    strings.reserve(string_count);
+    for (auto i = 0u; i != string_count; ++i)
+    {
+        std::uint32_t length;
+        read_value(in, length);
+        std::string string(length, '\0');
+        if (!in.read(&string[0], length))
+            BOOST_THROW_EXCEPTION(std::runtime_error{"Truncated window management trace"});
+        strings.push_back(std::move(string));
+    }
+
+    BinaryTraceStrings const lookup{strings};
+
+    std::uint64_t record_count;
+    read_value(in, record_count);
+
+    for (auto i = 0ull; i != record_count; ++i)
+    {
+        Record record;
+        read_value(in, record);
+
+        auto const seconds = record.timestamp / 1000000000;
+        auto const micros = record.timestamp % 1000000000 / 1000;
+        out << '[' << seconds << '.' << std::setw(6) << std::setfill('0') << micros << std::setfill(' ')
+            << "] <" << record.thread << "> ";
+
+        // Expand the format as printf would, given only %s conversions
+        auto const& format = lookup[record.format];
+        auto const arg_count = std::min<std::size_t>(record.arg_count, max_args);
+        std::size_t arg = 0;
+
+        for (auto c = format.begin(); c != format.end(); ++c)
+        {
+            if (*c == '%' && c + 1 != format.end())
+            {
+                ++c;
+                if (*c == 's')
+                {
+                    if (arg != arg_count)
+                        out << text_of(lookup, record.args[arg++]);
+                    continue;
+                }
+                if (*c != '%')
+                    out << '%';
+            }
+            out << *c;
+        }
+
+        out << '\n';
+    }
+}
+
+namespace
+{
+// Periodically replaces the trace file with the current contents of the trace
+class TraceFileWriter
+{
+public:
+    TraceFileWriter(std::string const& filename, miral::BinaryTrace const& trace, std::chrono::milliseconds interval) :
+        filename{filename},
+        trace{trace},
+        interval{interval}
+    {
+        // Start with an empty trace, so the file is always a valid trace
+        write_file();
+        thread = std::thread{[this] { run(); }};
+    }
+
+    ~TraceFileWriter()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stopping = true;
+        }
+        wakeup.notify_all();
+        thread.join();
+
+        write_file();
+    }
+
+private:
+    void run()
+    {
+        mir::set_thread_name("Mir/WMTrace");
+
+        std::unique_lock<std::mutex> lock{mutex};
+        while (!wakeup.wait_for(lock, interval, [this] { return stopping; }))
+        {
+            lock.unlock();
+            write_file();
+            lock.lock();
+        }
+    }
+
+    void write_file() noexcept
+    try
+    {
+        auto const appended = trace.records_appended();
+        if (written && appended == records_written)
+            return;
+
+        // Write a new file and replace the old one, so there's always a complete trace
+        auto const temporary = filename + ".tmp";
+        {
+            std::ofstream file{temporary, std::ios::binary | std::ios::trunc};
+            trace.write(file);
+            if (!file.flush())
+                return;
+        }
+
+        if (std::rename(temporary.c_str(), filename.c_str()) == 0)
+        {
+            written = true;
+            records_written = appended;
+        }
+    }
+    catch (...)
+    {
+        // There's nowhere to report this; the next write may succeed
+    }
+
+    std::string const filename;
+    miral::BinaryTrace const& trace;
+    std::chrono::milliseconds const interval;
+
+    // Only used by write_file(), which is called on one thread at a time
+    bool written{false};
+    std::uint64_t records_written{0};
+
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    bool stopping{false};
+
+    std::thread thread;
+};
+}
+
+auto miral::make_binary_trace_file(
+    std::string const& filename,
+    std::size_t records_per_thread,
+    std::chrono::milliseconds flush_interval)
+-> std::shared_ptr<BinaryTrace>
+{
+    // Open the file now so that a bad filename is reported at startup
+    if (!std::ofstream{filename, std::ios::binary | std::ios::trunc})
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Failed to open window management trace file: " + filename});
+
+    auto trace = std::make_unique<BinaryTrace>(records_per_thread);
+    auto writer = std::make_shared<TraceFileWriter>(filename, *trace, flush_interval);
+
+    return {trace.release(), [writer](BinaryTrace* trace) mutable
+        {
+            // Stops the writer and writes the final trace
+            writer.reset();
+            delete trace;
+        }};
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIRAL_BINARY_TRACE_H
+#define MIRAL_BINARY_TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mir { namespace scene { class Surface; } }
+
+namespace miral
+{
+class Window;
+
+/// A flight recorder for the window management trace.
+///
+/// Each trace line is kept as a fixed size record holding its (interned)
+/// printf-style format and typed arguments; nothing is formatted until the
+/// trace is decoded. Records go into a ring buffer owned by the calling
+/// thread, so once a thread has its buffer and has seen a string before,
+/// recording neither locks nor allocates.
+///
+/// Interned strings are kept for the life of the trace, so intern() stops
+/// adding strings once the table holds max_strings of them: later strings
+/// are recorded as "(string table full)". Literals are always added, as there
+/// are only as many of them as there are in the program.
+class BinaryTrace
+{
+public:
+    enum class Kind : std::uint32_t
+    {
+        none,
+        text,               // value[0]: string id
+        integer,            // value[0]
+        hex,                // value[0]
+        pointer,            // value[0..1]: low and high words
+        point,              // value[0..1]: x, y
+        size,               // value[0..1]: width, height
+        rectangle,          // value[0..3]: x, y, width, height
+        displacement,       // value[0..1]: dx, dy
+        window_state,       // value[0]
+        window_info,        // value[0..6]: name id, type, state, x, y, width, height
+        application_info,   // value[0..1]: name id, window count
+        window_specification, // value[0]: set fields mask, value[1..7]: name id, type, state, x, y, width, height
+        windows,            // value[0]: count, value[1..7]: name ids of the first seven
+        keyboard_event,     // value[0..4]: device, action, key code, scan code, modifiers
+        pointer_event,      // value[0..5]: device, action, buttons, x, y (float bits), modifiers
+        touch_event,        // value[0..6]: device, touch count, first id, action, x, y (float bits), modifiers
+    };
+
+    // Fields of a window_specification; the values follow the mask in this order
+    enum : std::int32_t
+    {
+        spec_name = 1 << 0,
+        spec_type = 1 << 1,
+        spec_top_left = 1 << 2,
+        spec_size = 1 << 3,
+        spec_state = 1 << 4,
+    };
+
+    struct Arg
+    {
+        Kind kind;
+        std::int32_t value[8];
+    };
+
+    static std::size_t const max_args = 5;
+
+    struct Record
+    {
+        std::uint64_t timestamp;    // nanoseconds (steady clock)
+        std::uint32_t thread;
+        std::uint32_t format;       // string id of a printf-style format using only %s
+        std::uint32_t arg_count;
+        std::uint32_t padding;
+        Arg args[max_args];
+    };
+
+    static std::size_t const default_max_strings = 16384;
+
+    explicit BinaryTrace(std::size_t records_per_thread, std::size_t max_strings = default_max_strings);
+    ~BinaryTrace();
+
+    /// Intern a string, returning its id
+    auto intern(std::string const& text) -> std::uint32_t;
+
+    /// Intern a string that lives for the duration of the program (such as
+    /// a string literal or __func__); later calls are looked up by address
+    auto intern_literal(char const* text) -> std::uint32_t;
+
+    /// Intern the name of a window's surface. Each thread caches the id, so
+    /// forget_window_names() must be called when a window is renamed or deleted
+    auto intern_name_of(Window const& window, mir::scene::Surface const& surface) -> std::uint32_t;
+
+    /// Drop the window name ids cached by every thread
+    void forget_window_names();
+
+    /// Append a record to the calling thread's ring buffer, overwriting the
+    /// oldest record once it is full
+    void append(Record& record);
+
+    /// The number of records appended so far (including any overwritten)
+    auto records_appended() const -> std::uint64_t;
+
+    /// Write the string table and the buffered records (ordered by time).
+    /// This may be called while other threads append records: a record that
+    /// is overwritten while being copied is left out.
+    void write(std::ostream& out) const;
+
+    /// Read a trace written by write() and print one text line per record
+    static void decode(std::istream& in, std::ostream& out);
+
+private:
+    struct ThreadBuffer;
+
+    BinaryTrace(BinaryTrace const&) = delete;
+    BinaryTrace& operator=(BinaryTrace const&) = delete;
+
+    auto thread_buffer() -> ThreadBuffer&;
+    auto intern(ThreadBuffer& buffer, std::string const& text, bool bounded) -> std::uint32_t;
+
+    std::uint64_t const id;
+    std::size_t const records_per_thread;
+    std::size_t const max_strings;
+
+    std::mutex mutable buffers_mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+    // Incremented by forget_window_names(), each thread clears its cache when it sees a change
+    std::atomic<std::uint64_t> window_names_generation{0};
+
+    std::mutex mutable strings_mutex;
+    std::unordered_map<std::string, std::uint32_t> string_ids;
+    std::vector<std::string> strings;
+};
+
+/// Create a trace that is written to the named file every \p flush_interval
+/// (if anything was recorded) and when the last reference to it is released.
+/// Each write replaces the file whole, so a crash loses at most the records
+/// of the last interval.
+auto make_binary_trace_file(
+    std::string const& filename,
+    std::size_t records_per_thread,
+    std::chrono::milliseconds flush_interval = std::chrono::seconds{1})
+-> std::shared_ptr<BinaryTrace>;
+}
+
+#endif //MIRAL_BINARY_TRACE_H
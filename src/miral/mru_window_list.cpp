@@ -19,47 +19,132 @@
 #include "mru_window_list.h"
 
 #include <mir/scene/surface.h>
+#include <mir/scene/null_surface_observer.h>
 
-#include <algorithm>
+#include <atomic>
+#include <vector>
 
 namespace
 {
-bool visible(miral::Window const& window)
+bool visible(mir::scene::Surface const& surface)
 {
-    std::shared_ptr<mir::scene::Surface> const& surface{window};
-
-    switch (surface->state())
+    switch (surface.state())
     {
     case mir_window_state_hidden:
     case mir_window_state_minimized:
         return false;
     default:
-        return surface->visible();
+        return surface.visible();
     }
 }
 }
 
+// Notifications can arrive on any thread, so they only mark the cached
+// visibility as stale: it is re-queried when next needed.
+class miral::MRUWindowList::VisibilityTracker : public mir::scene::NullSurfaceObserver
+{
+public:
+    bool visible(mir::scene::Surface const& surface)
+    {
+        if (stale.exchange(false))
+            visible_ = ::visible(surface);
+
+        return visible_;
+    }
+
+    void attrib_changed(mir::scene::Surface const*, MirWindowAttrib attrib, int) override
+    {
+        if (attrib == mir_window_attrib_state)
+            stale = true;
+    }
+
+    void hidden_set_to(mir::scene::Surface const*, bool) override
+    {
+        stale = true;
+    }
+
+    void frame_posted(mir::scene::Surface const*, int, mir::geometry::Size const&) override
+    {
+        // The first frame may make the surface visible, later ones don't matter
+        if (!visible_)
+            stale = true;
+    }
+
+private:
+    std::atomic<bool> stale{true};
+    std::atomic<bool> visible_{false};
+};
+
+miral::MRUWindowList::MRUWindowList() = default;
+
+miral::MRUWindowList::~MRUWindowList()
+{
+    for (auto const& entry : windows)
+    {
+        if (std::shared_ptr<mir::scene::Surface> const surface = entry.window)
+            surface->remove_observer(entry.tracker);
+    }
+}
+
 void miral::MRUWindowList::push(Window const& window)
 {
-    windows.erase(remove(begin(windows), end(windows), window), end(windows));
-    windows.push_back(window);
+    auto const existing = index.find(window);
+    if (existing != index.end())
+    {
+        windows.splice(windows.begin(), windows, existing->second);
+        return;
+    }
+
+    auto const tracker = std::make_shared<VisibilityTracker>();
+    std::shared_ptr<mir::scene::Surface>{window}->add_observer(tracker);
+    windows.push_front(Entry{window, tracker});
+    index[window] = windows.begin();
 }
 
 void miral::MRUWindowList::erase(Window const& window)
 {
-    windows.erase(remove(begin(windows), end(windows), window), end(windows));
+    auto const existing = index.find(window);
+    if (existing == index.end())
+        return;
+
+    if (std::shared_ptr<mir::scene::Surface> const surface = window)
+        surface->remove_observer(existing->second->tracker);
+
+    windows.erase(existing->second);
+    index.erase(existing);
 }
 
 auto miral::MRUWindowList::top() const -> Window
 {
-    auto const& found = std::find_if(rbegin(windows), rend(windows), visible);
-    return (found != rend(windows)) ? *found: Window{};
+    for (auto const& entry : windows)
+    {
+        if (std::shared_ptr<mir::scene::Surface> const surface = entry.window)
+        {
+            if (entry.tracker->visible(*surface))
+                return entry.window;
+        }
+    }
+
+    return Window{};
 }
 
 void miral::MRUWindowList::enumerate(Enumerator const& enumerator) const
 {
-    for (auto i = windows.rbegin(); i != windows.rend(); ++i)
-        if (visible(*i))
-            if (!enumerator(const_cast<Window&>(*i)))
+    // The enumerator may push or erase windows, so work on a copy of the list
+    std::vector<Entry> const entries{windows.begin(), windows.end()};
+
+    for (auto const& entry : entries)
+    {
+        std::shared_ptr<mir::scene::Surface> const surface = entry.window;
+
+        if (!surface || !index.count(entry.window))
+            continue;
+
+        if (entry.tracker->visible(*surface))
+        {
+            auto window = entry.window;
+            if (!enumerator(window))
                 break;
+        }
+    }
 }
@@ -22,13 +22,20 @@
 #include <miral/window.h>
 
 #include <functional>
-#include <vector>
+#include <list>
+#include <memory>
+#include <unordered_map>
 
 namespace miral
 {
+/// Windows in most recently used order. Push and erase are O(1), and whether
+/// each window is visible is cached and only re-queried after the surface
+/// notifies a change that could affect it.
 class MRUWindowList
 {
 public:
+    MRUWindowList();
+    ~MRUWindowList();
 
     void push(Window const& window);
     void erase(Window const& window);
@@ -39,7 +46,23 @@ public:
     void enumerate(Enumerator const& enumerator) const;
 
 private:
-    std::vector<Window> windows;
+    MRUWindowList(MRUWindowList const&) = delete;
+    MRUWindowList& operator=(MRUWindowList const&) = delete;
+
+    class VisibilityTracker;
+
+    struct Entry
+    {
+        Window window;
+        std::shared_ptr<VisibilityTracker> tracker;
+    };
+
+    using Entries = std::list<Entry>;
+
+    // Most recently used first
+    Entries windows;
+    // By the Window's identity, which (unlike its surface) remains once the surface has gone
+    std::unordered_map<Window, Entries::iterator> index;
 };
 }
 
@@ -18,6 +18,7 @@
 
 #include "miral/set_window_management_policy.h"
 #include "basic_window_manager.h"
+#include "binary_trace.h"
 #include "window_management_trace.h"
 
 #include <mir/server.h>
@@ -28,6 +29,10 @@ namespace msh = mir::shell;
 namespace
 {
 char const* const trace_option = "window-management-trace";
+char const* const trace_file_option = "window-management-trace-file";
+
+// Enough for the last few seconds of activity on each thread
+std::size_t const trace_records_per_thread = 4096;
 }
 
 miral::SetWindowManagementPolicy::SetWindowManagementPolicy(WindowManagementPolicyBuilder const& builder) :
@@ -40,6 +45,11 @@ miral::SetWindowManagementPolicy::~SetWindowManagementPolicy() = default;
 void miral::SetWindowManagementPolicy::operator()(mir::Server& server) const
 {
     server.add_configuration_option(trace_option, "log trace message", mir::OptionType::null);
+    server.add_configuration_option(
+        trace_file_option,
+        "record a binary trace of recent window management activity, written to this file on exit "
+        "(decode with mirwmtrace)",
+        mir::OptionType::string);
 
     server.override_the_window_manager_builder([this, &server](msh::FocusController* focus_controller)
         -> std::shared_ptr<msh::WindowManager>
@@ -48,11 +58,15 @@ void miral::SetWindowManagementPolicy::operator()(mir::Server& server) const
 
             auto const persistent_surface_store = server.the_persistent_surface_store();
 
-            if (server.get_options()->is_set(trace_option))
+            auto const binary_trace = server.get_options()->is_set(trace_file_option) ?
+                make_binary_trace_file(server.get_options()->get<std::string>(trace_file_option), trace_records_per_thread) :
+                std::shared_ptr<BinaryTrace>{};
+
+            if (server.get_options()->is_set(trace_option) || binary_trace)
             {
-                auto trace_builder = [this](WindowManagerTools const& tools) -> std::unique_ptr<miral::WindowManagementPolicy>
+                auto trace_builder = [this, binary_trace](WindowManagerTools const& tools) -> std::unique_ptr<miral::WindowManagementPolicy>
                     {
-                        return std::make_unique<WindowManagementTrace>(tools, builder);
+                        return std::make_unique<WindowManagementTrace>(tools, builder, binary_trace);
                     };
 
                 return std::make_shared<BasicWindowManager>(
@@ -19,6 +19,7 @@
 #include "miral/window_management_options.h"
 
 #include "basic_window_manager.h"
+#include "binary_trace.h"
 #include "window_management_trace.h"
 
 #include <mir/abnormal_exit.h>
@@ -34,6 +35,10 @@ namespace
 char const* const wm_option = "window-manager";
 char const* const wm_system_compositor = "system-compositor";
 char const* const trace_option = "window-management-trace";
+char const* const trace_file_option = "window-management-trace-file";
+
+// Enough for the last few seconds of activity on each thread
+std::size_t const trace_records_per_thread = 4096;
 }
 
 void miral::WindowManagerOptions::operator()(mir::Server& server) const
@@ -47,6 +52,11 @@ void miral::WindowManagerOptions::operator()(mir::Server& server) const
 
     server.add_configuration_option(wm_option, description, policies.begin()->name);
     server.add_configuration_option(trace_option, "log trace message", mir::OptionType::null);
+    server.add_configuration_option(
+        trace_file_option,
+        "record a binary trace of recent window management activity, written to this file on exit "
+        "(decode with mirwmtrace)",
+        mir::OptionType::string);
 
     server.override_the_window_manager_builder([this, &server](msh::FocusController* focus_controller)
         -> std::shared_ptr<msh::WindowManager>
@@ -57,15 +67,19 @@ void miral::WindowManagerOptions::operator()(mir::Server& server) const
             auto const display_layout = server.the_shell_display_layout();
             auto const persistent_surface_store = server.the_persistent_surface_store();
 
+            auto const binary_trace = options->is_set(trace_file_option) ?
+                make_binary_trace_file(options->get<std::string>(trace_file_option), trace_records_per_thread) :
+                std::shared_ptr<BinaryTrace>{};
+
             for (auto const& option : policies)
             {
                 if (selection == option.name)
                 {
-                    if (server.get_options()->is_set(trace_option))
+                    if (server.get_options()->is_set(trace_option) || binary_trace)
                     {
-                        auto trace_builder = [&option](WindowManagerTools const& tools) -> std::unique_ptr<miral::WindowManagementPolicy>
+                        auto trace_builder = [&option, binary_trace](WindowManagerTools const& tools) -> std::unique_ptr<miral::WindowManagementPolicy>
                             {
-                                return std::make_unique<WindowManagementTrace>(tools, option.build);
+                                return std::make_unique<WindowManagementTrace>(tools, option.build, binary_trace);
                             };
 
                         return std::make_shared<BasicWindowManager>(
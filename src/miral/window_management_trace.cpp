@@ -18,6 +18,7 @@
 
 #include "window_management_trace.h"
 #include "window_info_defaults.h"
+#include "binary_trace.h"
 
 #include <miral/application_info.h>
 #include <miral/output.h>
@@ -27,6 +28,7 @@
 #include <mir/scene/surface.h>
 #include <mir/event_printer.h>
 
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 
@@ -280,18 +282,25 @@ auto dump_of(MirTouchEvent const* event) -> std::string
     return out.str();
 }
 
-auto dump_of(MirPointerEvent const* event) -> std::string
+auto button_state_of(MirPointerEvent const* event) -> unsigned int
 {
-    std::stringstream out;
-
-    auto device_id = mir_input_event_get_device_id(mir_pointer_event_input_event(event));
-
     unsigned int button_state = 0;
 
     for (auto const a : {mir_pointer_button_primary, mir_pointer_button_secondary, mir_pointer_button_tertiary,
                          mir_pointer_button_back, mir_pointer_button_forward})
         button_state |= mir_pointer_event_button_state(event, a) ? a : 0;
 
+    return button_state;
+}
+
+auto dump_of(MirPointerEvent const* event) -> std::string
+{
+    std::stringstream out;
+
+    auto device_id = mir_input_event_get_device_id(mir_pointer_event_input_event(event));
+
+    auto const button_state = button_state_of(event);
+
     {
         BracedItemStream bout{out};
 
@@ -340,25 +349,297 @@ auto dump_of(mir::geometry::Rectangle const& rect) -> std::string
     return out.str();
 }
 
+auto dump_of(mir::geometry::Displacement const& displacement) -> std::string
+{
+    std::stringstream out;
+    out << displacement;
+    return out.str();
+}
+
 auto dump_of(miral::Output const& output) -> std::string
 {
     return dump_of(output.extents());
 }
+
+auto dump_of(std::shared_ptr<miral::Workspace> const& workspace) -> std::string
+{
+    if (!workspace)
+        return "(nil)";
+
+    std::stringstream out;
+    out << "0x" << std::hex << reinterpret_cast<std::uintptr_t>(workspace.get());
+    return out.str();
+}
+
+auto dump_of(MirResizeEdge edge) -> std::string
+{
+    std::stringstream out;
+    out << std::hex << static_cast<unsigned int>(edge);
+    return out.str();
+}
+
+auto dump_of(unsigned int value) -> std::string
+{
+    return std::to_string(value);
+}
+
+auto dump_of(std::string const& text) -> std::string
+{
+    return text;
+}
+
+auto dump_of(char const* text) -> std::string
+{
+    return text;
+}
+
+using BinaryArg = miral::BinaryTrace::Arg;
+using BinaryKind = miral::BinaryTrace::Kind;
+
+void encode(miral::BinaryTrace& binary, BinaryArg& arg, char const* text)
+{
+    arg.kind = BinaryKind::text;
+    arg.value[0] = binary.intern_literal(text);
+}
+
+void encode(miral::BinaryTrace& binary, BinaryArg& arg, std::string const& text)
+{
+    arg.kind = BinaryKind::text;
+    arg.value[0] = binary.intern(text);
+}
+
+auto name_id(miral::BinaryTrace& binary, miral::Window const& window) -> std::int32_t
+{
+    if (std::shared_ptr<mir::scene::Surface> const surface = window)
+        return binary.intern_name_of(window, *surface);
+    else
+        return binary.intern_literal(null_ptr.c_str());
+}
+
+void encode(miral::BinaryTrace& binary, BinaryArg& arg, miral::Window const& window)
+{
+    arg.kind = BinaryKind::text;
+    arg.value[0] = name_id(binary, window);
+}
+
+void encode(miral::BinaryTrace& binary, BinaryArg& arg, miral::Application const& application)
+{
+    encode(binary, arg, dump_of(application));
+}
+
+void encode(miral::BinaryTrace&, BinaryArg& arg, unsigned int value)
+{
+    arg.kind = BinaryKind::integer;
+    arg.value[0] = value;
+}
+
+void encode(miral::BinaryTrace&, BinaryArg& arg, MirResizeEdge edge)
+{
+    arg.kind = BinaryKind::hex;
+    arg.value[0] = edge;
+}
+
+void encode(miral::BinaryTrace&, BinaryArg& arg, std::shared_ptr<miral::Workspace> const& workspace)
+{
+    auto const pointer = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(workspace.get()));
+    arg.kind = BinaryKind::pointer;
+    arg.value[0] = static_cast<std::uint32_t>(pointer);
+    arg.value[1] = static_cast<std::uint32_t>(pointer >> 32);
+}
+
+void encode(miral::BinaryTrace&, BinaryArg& arg, MirWindowState state)
+{
+    arg.kind = BinaryKind::window_state;
+    arg.value[0] = state;
+}
+
+void encode_point(std::int32_t* value, mir::geometry::Point point)
+{
+    value[0] = point.x.as_int();
+    value[1] = point.y.as_int();
+}
+
+void encode_size(std::int32_t* value, mir::geometry::Size size)
+{
+    value[0] = size.width.as_int();
+    value[1] = size.height.as_int();
+}
+
+void encode(miral::BinaryTrace&, BinaryArg& arg, mir::geometry::Point point)
+{
+    arg.kind = BinaryKind::point;
+    encode_point(arg.value, point);
+}
+
+void encode(miral::BinaryTrace&, BinaryArg& arg, mir::geometry::Size size)
+{
+    arg.kind = BinaryKind::size;
+    encode_size(arg.value, size);
+}
+
+void encode(miral::BinaryTrace&, BinaryArg& arg, mir::geometry::Rectangle const& rect)
+{
+    arg.kind = BinaryKind::rectangle;
+    encode_point(arg.value, rect.top_left);
+    encode_size(arg.value + 2, rect.size);
+}
+
+void encode(miral::BinaryTrace& binary, BinaryArg& arg, miral::Output const& output)
+{
+    encode(binary, arg, output.extents());
+}
+
+void encode(miral::BinaryTrace&, BinaryArg& arg, mir::geometry::Displacement displacement)
+{
+    arg.kind = BinaryKind::displacement;
+    arg.value[0] = displacement.dx.as_int();
+    arg.value[1] = displacement.dy.as_int();
+}
+
+void encode(miral::BinaryTrace& binary, BinaryArg& arg, miral::WindowInfo const& info)
+{
+    arg.kind = BinaryKind::window_info;
+    arg.value[0] = name_id(binary, info.window());
+    arg.value[1] = info.type();
+    arg.value[2] = info.state();
+    encode_point(arg.value + 3, info.window().top_left());
+    encode_size(arg.value + 5, info.window().size());
+}
+
+void encode(miral::BinaryTrace& binary, BinaryArg& arg, miral::ApplicationInfo const& app_info)
+{
+    arg.kind = BinaryKind::application_info;
+    arg.value[0] = binary.intern(dump_of(app_info.application()));
+    arg.value[1] = app_info.windows().size();
+}
+
+void encode(miral::BinaryTrace& binary, BinaryArg& arg, miral::WindowSpecification const& specification)
+{
+    using miral::BinaryTrace;
+
+    arg.kind = BinaryKind::window_specification;
+    auto& mask = arg.value[0];
+
+    if (specification.name().is_set())
+    {
+        mask |= BinaryTrace::spec_name;
+        arg.value[1] = binary.intern(specification.name().value());
+    }
+    if (specification.type().is_set())
+    {
+        mask |= BinaryTrace::spec_type;
+        arg.value[2] = specification.type().value();
+    }
+    if (specification.state().is_set())
+    {
+        mask |= BinaryTrace::spec_state;
+        arg.value[3] = specification.state().value();
+    }
+    if (specification.top_left().is_set())
+    {
+        mask |= BinaryTrace::spec_top_left;
+        encode_point(arg.value + 4, specification.top_left().value());
+    }
+    if (specification.size().is_set())
+    {
+        mask |= BinaryTrace::spec_size;
+        encode_size(arg.value + 6, specification.size().value());
+    }
+}
+
+void encode(miral::BinaryTrace& binary, BinaryArg& arg, std::vector<miral::Window> const& windows)
+{
+    arg.kind = BinaryKind::windows;
+    arg.value[0] = windows.size();
+
+    for (auto i = 0u; i != windows.size() && i != 7; ++i)
+        arg.value[1 + i] = name_id(binary, windows[i]);
+}
+
+auto float_bits(float value) -> std::int32_t
+{
+    std::int32_t result;
+    std::memcpy(&result, &value, sizeof result);
+    return result;
+}
+
+void encode(miral::BinaryTrace&, BinaryArg& arg, MirKeyboardEvent const* event)
+{
+    arg.kind = BinaryKind::keyboard_event;
+    arg.value[0] = mir_input_event_get_device_id(mir_keyboard_event_input_event(event));
+    arg.value[1] = mir_keyboard_event_action(event);
+    arg.value[2] = mir_keyboard_event_key_code(event);
+    arg.value[3] = mir_keyboard_event_scan_code(event);
+    arg.value[4] = mir_keyboard_event_modifiers(event);
+}
+
+void encode(miral::BinaryTrace&, BinaryArg& arg, MirPointerEvent const* event)
+{
+    arg.kind = BinaryKind::pointer_event;
+    arg.value[0] = mir_input_event_get_device_id(mir_pointer_event_input_event(event));
+    arg.value[1] = mir_pointer_event_action(event);
+    arg.value[2] = button_state_of(event);
+    arg.value[3] = float_bits(mir_pointer_event_axis_value(event, mir_pointer_axis_x));
+    arg.value[4] = float_bits(mir_pointer_event_axis_value(event, mir_pointer_axis_y));
+    arg.value[5] = mir_pointer_event_modifiers(event);
+}
+
+void encode(miral::BinaryTrace&, BinaryArg& arg, MirTouchEvent const* event)
+{
+    auto const count = mir_touch_event_point_count(event);
+
+    arg.kind = BinaryKind::touch_event;
+    arg.value[0] = mir_input_event_get_device_id(mir_touch_event_input_event(event));
+    arg.value[1] = count;
+    if (count > 0)
+    {
+        arg.value[2] = mir_touch_event_id(event, 0);
+        arg.value[3] = mir_touch_event_action(event, 0);
+        arg.value[4] = float_bits(mir_touch_event_axis_value(event, 0, mir_touch_axis_x));
+        arg.value[5] = float_bits(mir_touch_event_axis_value(event, 0, mir_touch_axis_y));
+    }
+    arg.value[6] = mir_touch_event_modifiers(event);
+}
 }
 
 miral::WindowManagementTrace::WindowManagementTrace(
     WindowManagerTools const& wrapped,
-    WindowManagementPolicyBuilder const& builder) :
+    WindowManagementPolicyBuilder const& builder,
+    std::shared_ptr<BinaryTrace> const& binary) :
     wrapped{wrapped},
-    policy(builder(WindowManagerTools{this}))
+    policy(builder(WindowManagerTools{this})),
+    binary{binary}
+{
+}
+
+template<typename... Args>
+void miral::WindowManagementTrace::trace(char const* format, Args const&... args) const
 {
+    if (binary)
+    {
+        static_assert(sizeof...(args) <= BinaryTrace::max_args, "Too many arguments to trace");
+
+        BinaryTrace::Record record{};
+        record.format = binary->intern_literal(format);
+        record.arg_count = sizeof...(args);
+
+        auto arg = record.args;
+        int const expand[] = {0, (encode(*binary, *arg++, args), 0)...};
+        (void)expand;
+
+        binary->append(record);
+    }
+    else
+    {
+        mir::log_info(format, dump_of(args).c_str()...);
+    }
 }
 
 auto miral::WindowManagementTrace::count_applications() const -> unsigned int
 try {
     log_input();
     auto const result = wrapped.count_applications();
-    mir::log_info("%s -> %d", __func__, result);
+    trace("%s -> %s", __func__, result);
     trace_count++;
     return result;
 }
@@ -367,7 +648,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::for_each_application(std::function<void(miral::ApplicationInfo&)> const& functor)
 try {
     log_input();
-    mir::log_info("%s", __func__);
+    trace("%s", __func__);
     trace_count++;
     wrapped.for_each_application(functor);
 }
@@ -378,7 +659,7 @@ auto miral::WindowManagementTrace::find_application(std::function<bool(Applicati
 try {
     log_input();
     auto result = wrapped.find_application(predicate);
-    mir::log_info("%s -> %s", __func__, dump_of(result).c_str());
+    trace("%s -> %s", __func__, result);
     trace_count++;
     return result;
 }
@@ -388,7 +669,7 @@ auto miral::WindowManagementTrace::info_for(std::weak_ptr<mir::scene::Session> c
 try {
     log_input();
     auto& result = wrapped.info_for(session);
-    mir::log_info("%s -> %s", __func__, result.application()->name().c_str());
+    trace("%s -> %s", __func__, result.application());
     trace_count++;
     return result;
 }
@@ -398,7 +679,7 @@ auto miral::WindowManagementTrace::info_for(std::weak_ptr<mir::scene::Surface> c
 try {
     log_input();
     auto& result = wrapped.info_for(surface);
-    mir::log_info("%s -> %s", __func__, result.name().c_str());
+    trace("%s -> %s", __func__, result.name());
     trace_count++;
     return result;
 }
@@ -408,7 +689,7 @@ auto miral::WindowManagementTrace::info_for(Window const& window) const -> Windo
 try {
     log_input();
     auto& result = wrapped.info_for(window);
-    mir::log_info("%s -> %s", __func__, result.name().c_str());
+    trace("%s -> %s", __func__, result.name());
     trace_count++;
     return result;
 }
@@ -417,7 +698,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::ask_client_to_close(miral::Window const& window)
 try {
     log_input();
-    mir::log_info("%s -> %s", __func__, dump_of(window).c_str());
+    trace("%s -> %s", __func__, window);
     trace_count++;
     wrapped.ask_client_to_close(window);
 }
@@ -426,7 +707,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::force_close(miral::Window const& window)
 try {
     log_input();
-    mir::log_info("%s -> %s", __func__, dump_of(window).c_str());
+    trace("%s -> %s", __func__, window);
     trace_count++;
     wrapped.force_close(window);
 }
@@ -436,7 +717,7 @@ auto miral::WindowManagementTrace::active_window() const -> Window
 try {
     log_input();
     auto result = wrapped.active_window();
-    mir::log_info("%s -> %s", __func__, dump_of(result).c_str());
+    trace("%s -> %s", __func__, result);
     trace_count++;
     return result;
 }
@@ -446,7 +727,7 @@ auto miral::WindowManagementTrace::select_active_window(Window const& hint) -> W
 try {
     log_input();
     auto result = wrapped.select_active_window(hint);
-    mir::log_info("%s hint=%s -> %s", __func__, dump_of(hint).c_str(), dump_of(result).c_str());
+    trace("%s hint=%s -> %s", __func__, hint, result);
     trace_count++;
     return result;
 }
@@ -456,9 +737,7 @@ auto miral::WindowManagementTrace::window_at(mir::geometry::Point cursor) const
 try {
     log_input();
     auto result = wrapped.window_at(cursor);
-    std::stringstream out;
-    out << cursor << " -> " << dump_of(result);
-    mir::log_info("%s cursor=%s", __func__, out.str().c_str());
+    trace("%s cursor=%s -> %s", __func__, cursor, result);
     trace_count++;
     return result;
 }
@@ -468,9 +747,7 @@ auto miral::WindowManagementTrace::active_output() -> mir::geometry::Rectangle c
 try {
     log_input();
     auto result = wrapped.active_output();
-    std::stringstream out;
-    out << result;
-    mir::log_info("%s -> ", __func__, out.str().c_str());
+    trace("%s -> %s", __func__, result);
     trace_count++;
     return result;
 }
@@ -480,7 +757,7 @@ auto miral::WindowManagementTrace::info_for_window_id(std::string const& id) con
 try {
     log_input();
     auto& result = wrapped.info_for_window_id(id);
-    mir::log_info("%s id=%s -> %s", __func__, id.c_str(), dump_of(result).c_str());
+    trace("%s id=%s -> %s", __func__, id, result);
     trace_count++;
     return result;
 }
@@ -490,7 +767,7 @@ auto miral::WindowManagementTrace::id_for_window(Window const& window) const ->
 try {
     log_input();
     auto result = wrapped.id_for_window(window);
-    mir::log_info("%s window=%s -> %s", __func__, dump_of(window).c_str(), result.c_str());
+    trace("%s window=%s -> %s", __func__, window, result);
     trace_count++;
     return result;
 }
@@ -500,7 +777,7 @@ void miral::WindowManagementTrace::place_and_size_for_state(
     WindowSpecification& modifications, WindowInfo const& window_info) const
 try {
     log_input();
-    mir::log_info("%s modifications=%s window_info=%s", __func__, dump_of(modifications).c_str(), dump_of(window_info).c_str());
+    trace("%s modifications=%s window_info=%s", __func__, modifications, window_info);
     wrapped.place_and_size_for_state(modifications, window_info);
 }
 MIRAL_TRACE_EXCEPTION
@@ -508,9 +785,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::drag_active_window(mir::geometry::Displacement movement)
 try {
     log_input();
-    std::stringstream out;
-    out << movement;
-    mir::log_info("%s movement=%s", __func__, out.str().c_str());
+    trace("%s movement=%s", __func__, movement);
     trace_count++;
     wrapped.drag_active_window(movement);
 }
@@ -519,9 +794,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::drag_window(Window const& window, mir::geometry::Displacement& movement)
 try {
     log_input();
-    std::stringstream out;
-    out << movement;
-    mir::log_info("%s window=%s -> %s", __func__, dump_of(window).c_str(), out.str().c_str());
+    trace("%s window=%s -> %s", __func__, window, movement);
     trace_count++;
     wrapped.drag_window(window, movement);
 }
@@ -530,7 +803,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::focus_next_application()
 try {
     log_input();
-    mir::log_info("%s", __func__);
+    trace("%s", __func__);
     trace_count++;
     wrapped.focus_next_application();
 }
@@ -539,7 +812,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::focus_next_within_application()
 try {
     log_input();
-    mir::log_info("%s", __func__);
+    trace("%s", __func__);
     trace_count++;
     wrapped.focus_next_within_application();
 }
@@ -548,7 +821,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::focus_prev_within_application()
 try {
     log_input();
-    mir::log_info("%s", __func__);
+    trace("%s", __func__);
     trace_count++;
     wrapped.focus_prev_within_application();
 }
@@ -557,7 +830,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::raise_tree(miral::Window const& root)
 try {
     log_input();
-    mir::log_info("%s root=%s", __func__, dump_of(root).c_str());
+    trace("%s root=%s", __func__, root);
     trace_count++;
     wrapped.raise_tree(root);
 }
@@ -566,7 +839,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::start_drag_and_drop(miral::WindowInfo& window_info, std::vector<uint8_t> const& handle)
 try {
     log_input();
-    mir::log_info("%s window_info=%s", __func__, dump_of(window_info).c_str());
+    trace("%s window_info=%s", __func__, window_info);
     trace_count++;
     wrapped.start_drag_and_drop(window_info, handle);
 }
@@ -575,7 +848,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::end_drag_and_drop()
 try {
     log_input();
-    mir::log_info("%s window_info=%s", __func__);
+    trace("%s", __func__);
     trace_count++;
     wrapped.end_drag_and_drop();
 }
@@ -585,23 +858,24 @@ void miral::WindowManagementTrace::modify_window(
     miral::WindowInfo& window_info, miral::WindowSpecification const& modifications)
 try {
     log_input();
-    mir::log_info("%s window_info=%s, modifications=%s",
-                  __func__, dump_of(window_info).c_str(), dump_of(modifications).c_str());
+    trace("%s window_info=%s, modifications=%s", __func__, window_info, modifications);
     trace_count++;
     wrapped.modify_window(window_info, modifications);
+    if (binary && modifications.name().is_set())
+        binary->forget_window_names();
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::invoke_under_lock(std::function<void()> const& callback)
 try {
-    mir::log_info("%s", __func__);
+    trace("%s", __func__);
     wrapped.invoke_under_lock(callback);
 }
 MIRAL_TRACE_EXCEPTION
 
 auto miral::WindowManagementTrace::create_workspace() -> std::shared_ptr<Workspace>
 try {
-    mir::log_info("%s", __func__);
+    trace("%s", __func__);
     return wrapped.create_workspace();
 }
 MIRAL_TRACE_EXCEPTION
@@ -609,7 +883,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::add_tree_to_workspace(
     miral::Window const& window, std::shared_ptr<miral::Workspace> const& workspace)
 try {
-    mir::log_info("%s window=%s, workspace =%p", __func__, dump_of(window).c_str(), workspace.get());
+    trace("%s window=%s, workspace =%s", __func__, window, workspace);
     wrapped.add_tree_to_workspace(window, workspace);
 }
 MIRAL_TRACE_EXCEPTION
@@ -617,7 +891,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::remove_tree_from_workspace(
     miral::Window const& window, std::shared_ptr<miral::Workspace> const& workspace)
 try {
-    mir::log_info("%s window=%s, workspace =%p", __func__, dump_of(window).c_str(), workspace.get());
+    trace("%s window=%s, workspace =%s", __func__, window, workspace);
     wrapped.remove_tree_from_workspace(window, workspace);
 }
 MIRAL_TRACE_EXCEPTION
@@ -625,7 +899,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::move_workspace_content_to_workspace(
     std::shared_ptr<Workspace> const& to_workspace, std::shared_ptr<Workspace> const& from_workspace)
 try {
-    mir::log_info("%s to_workspace=%p, from_workspace=%p", __func__, to_workspace.get(), from_workspace.get());
+    trace("%s to_workspace=%s, from_workspace=%s", __func__, to_workspace, from_workspace);
     wrapped.move_workspace_content_to_workspace(to_workspace, from_workspace);
 }
 MIRAL_TRACE_EXCEPTION
@@ -633,7 +907,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::for_each_workspace_containing(
     miral::Window const& window, std::function<void(std::shared_ptr<miral::Workspace> const&)> const& callback)
 try {
-    mir::log_info("%s window=%s", __func__, dump_of(window).c_str());
+    trace("%s window=%s", __func__, window);
     wrapped.for_each_workspace_containing(window, callback);
 }
 MIRAL_TRACE_EXCEPTION
@@ -641,7 +915,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::for_each_window_in_workspace(
     std::shared_ptr<miral::Workspace> const& workspace, std::function<void(miral::Window const&)> const& callback)
 try {
-    mir::log_info("%s workspace =%p", __func__, workspace.get());
+    trace("%s workspace =%s", __func__, workspace);
     wrapped.for_each_window_in_workspace(workspace, callback);
 }
 MIRAL_TRACE_EXCEPTION
@@ -651,15 +925,15 @@ auto miral::WindowManagementTrace::place_new_window(
     WindowSpecification const& requested_specification) -> WindowSpecification
 try {
     auto const result = policy->place_new_window(app_info, requested_specification);
-    mir::log_info("%s app_info=%s, requested_specification=%s -> %s",
-              __func__, dump_of(app_info).c_str(), dump_of(requested_specification).c_str(), dump_of(result).c_str());
+    trace("%s app_info=%s, requested_specification=%s -> %s",
+        __func__, app_info, requested_specification, result);
     return result;
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::handle_window_ready(miral::WindowInfo& window_info)
 try {
-    mir::log_info("%s window_info=%s", __func__, dump_of(window_info).c_str());
+    trace("%s window_info=%s", __func__, window_info);
     policy->handle_window_ready(window_info);
 }
 MIRAL_TRACE_EXCEPTION
@@ -667,15 +941,14 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::handle_modify_window(
     miral::WindowInfo& window_info, miral::WindowSpecification const& modifications)
 try {
-    mir::log_info("%s window_info=%s, modifications=%s",
-                  __func__, dump_of(window_info).c_str(), dump_of(modifications).c_str());
+    trace("%s window_info=%s, modifications=%s", __func__, window_info, modifications);
     policy->handle_modify_window(window_info, modifications);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::handle_raise_window(miral::WindowInfo& window_info)
 try {
-    mir::log_info("%s window_info=%s", __func__, dump_of(window_info).c_str());
+    trace("%s window_info=%s", __func__, window_info);
     policy->handle_raise_window(window_info);
 }
 MIRAL_TRACE_EXCEPTION
@@ -684,7 +957,7 @@ bool miral::WindowManagementTrace::handle_keyboard_event(MirKeyboardEvent const*
 try {
     log_input = [event, this]
         {
-            mir::log_info("handle_keyboard_event event=%s", dump_of(event).c_str());
+            trace("handle_keyboard_event event=%s", event);
             log_input = []{};
         };
 
@@ -696,7 +969,7 @@ bool miral::WindowManagementTrace::handle_touch_event(MirTouchEvent const* event
 try {
     log_input = [event, this]
         {
-            mir::log_info("handle_touch_event event=%s", dump_of(event).c_str());
+            trace("handle_touch_event event=%s", event);
             log_input = []{};
         };
 
@@ -708,7 +981,7 @@ bool miral::WindowManagementTrace::handle_pointer_event(MirPointerEvent const* e
 try {
     log_input = [event, this]
         {
-            mir::log_info("handle_pointer_event event=%s", dump_of(event).c_str());
+            trace("handle_pointer_event event=%s", event);
             log_input = []{};
         };
 
@@ -719,9 +992,7 @@ MIRAL_TRACE_EXCEPTION
 auto miral::WindowManagementTrace::confirm_inherited_move(WindowInfo const& window_info, Displacement movement)
 -> Rectangle
 try {
-    std::stringstream out;
-    out << movement;
-    mir::log_info("%s window_info=%s, movement=%s", __func__, dump_of(window_info).c_str(), out.str().c_str());
+    trace("%s window_info=%s, movement=%s", __func__, window_info, movement);
 
     return policy->confirm_inherited_move(window_info, movement);
 }
@@ -738,91 +1009,93 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::advise_end()
 try {
     if (trace_count.load() > 0)
-        mir::log_info("====");
+        trace("====");
     policy->advise_end();
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_new_app(miral::ApplicationInfo& application)
 try {
-    mir::log_info("%s application=%s", __func__, dump_of(application).c_str());
+    trace("%s application=%s", __func__, application);
     policy->advise_new_app(application);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_delete_app(miral::ApplicationInfo const& application)
 try {
-    mir::log_info("%s application=%s", __func__, dump_of(application).c_str());
+    trace("%s application=%s", __func__, application);
     policy->advise_delete_app(application);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_new_window(miral::WindowInfo const& window_info)
 try {
-    mir::log_info("%s window_info=%s", __func__, dump_of(window_info).c_str());
+    trace("%s window_info=%s", __func__, window_info);
     policy->advise_new_window(window_info);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_focus_lost(miral::WindowInfo const& window_info)
 try {
-    mir::log_info("%s window_info=%s", __func__, dump_of(window_info).c_str());
+    trace("%s window_info=%s", __func__, window_info);
     policy->advise_focus_lost(window_info);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_focus_gained(miral::WindowInfo const& window_info)
 try {
-    mir::log_info("%s window_info=%s", __func__, dump_of(window_info).c_str());
+    trace("%s window_info=%s", __func__, window_info);
     policy->advise_focus_gained(window_info);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_state_change(miral::WindowInfo const& window_info, MirWindowState state)
 try {
-    mir::log_info("%s window_info=%s, state=%s", __func__, dump_of(window_info).c_str(), dump_of(state).c_str());
+    trace("%s window_info=%s, state=%s", __func__, window_info, state);
     policy->advise_state_change(window_info, state);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_move_to(miral::WindowInfo const& window_info, mir::geometry::Point top_left)
 try {
-    mir::log_info("%s window_info=%s, top_left=%s", __func__, dump_of(window_info).c_str(), dump_of(top_left).c_str());
+    trace("%s window_info=%s, top_left=%s", __func__, window_info, top_left);
     policy->advise_move_to(window_info, top_left);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_resize(miral::WindowInfo const& window_info, mir::geometry::Size const& new_size)
 try {
-    mir::log_info("%s window_info=%s, new_size=%s", __func__, dump_of(window_info).c_str(), dump_of(new_size).c_str());
+    trace("%s window_info=%s, new_size=%s", __func__, window_info, new_size);
     policy->advise_resize(window_info, new_size);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_delete_window(miral::WindowInfo const& window_info)
 try {
-    mir::log_info("%s window_info=%s", __func__, dump_of(window_info).c_str());
+    trace("%s window_info=%s", __func__, window_info);
     policy->advise_delete_window(window_info);
+    if (binary)
+        binary->forget_window_names();
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_raise(std::vector<miral::Window> const& windows)
 try {
-    mir::log_info("%s window_info=%s", __func__, dump_of(windows).c_str());
+    trace("%s window_info=%s", __func__, windows);
     policy->advise_raise(windows);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::handle_request_drag_and_drop(miral::WindowInfo& window_info)
 try {
-    mir::log_info("%s window_info=%s", __func__, dump_of(window_info).c_str());
+    trace("%s window_info=%s", __func__, window_info);
     policy->handle_request_drag_and_drop(window_info);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::handle_request_move(miral::WindowInfo& window_info, MirInputEvent const* input_event)
 try {
-    mir::log_info("%s window_info=%s", __func__, dump_of(window_info).c_str());
+    trace("%s window_info=%s", __func__, window_info);
     policy->handle_request_move(window_info, input_event);
 }
 MIRAL_TRACE_EXCEPTION
@@ -830,7 +1103,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::handle_request_resize(
     miral::WindowInfo& window_info, MirInputEvent const* input_event, MirResizeEdge edge)
 try {
-    mir::log_info("%s window_info=%s, edge=0x%1x", __func__, dump_of(window_info).c_str(), edge);
+    trace("%s window_info=%s, edge=0x%s", __func__, window_info, edge);
     policy->handle_request_resize(window_info, input_event, edge);
 }
 MIRAL_TRACE_EXCEPTION
@@ -838,7 +1111,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::advise_adding_to_workspace(
     std::shared_ptr<miral::Workspace> const& workspace, std::vector<miral::Window> const& windows)
 try {
-    mir::log_info("%s workspace=%p, windows=%s", __func__, workspace.get(), dump_of(windows).c_str());
+    trace("%s workspace=%s, windows=%s", __func__, workspace, windows);
     policy->advise_adding_to_workspace(workspace, windows);
 }
 MIRAL_TRACE_EXCEPTION
@@ -846,7 +1119,7 @@ MIRAL_TRACE_EXCEPTION
 void miral::WindowManagementTrace::advise_removing_from_workspace(
     std::shared_ptr<miral::Workspace> const& workspace, std::vector<miral::Window> const& windows)
 try {
-    mir::log_info("%s workspace=%p, windows=%s", __func__, workspace.get(), dump_of(windows).c_str());
+    trace("%s workspace=%s, windows=%s", __func__, workspace, windows);
     policy->advise_removing_from_workspace(workspace, windows);
 }
 MIRAL_TRACE_EXCEPTION
@@ -858,29 +1131,29 @@ auto miral::WindowManagementTrace::confirm_placement_on_display(
     Rectangle const& new_placement) -> Rectangle
 try {
     auto const& result = policy->confirm_placement_on_display(window_info, new_state, new_placement);
-    mir::log_info("%s window_info=%s, new_state= %s, new_placement= %s -> %s", __func__,
-        dump_of(window_info).c_str(), dump_of(new_state).c_str(), dump_of(new_placement).c_str(), dump_of(result).c_str());
+    trace("%s window_info=%s, new_state= %s, new_placement= %s -> %s", __func__,
+        window_info, new_state, new_placement, result);
     return result;
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_output_create(Output const& output)
 try {
-    mir::log_info("%s output=%s", __func__, dump_of(output).c_str());
+    trace("%s output=%s", __func__, output);
     return policy->advise_output_create(output);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_output_update(Output const& updated, Output const& original)
 try {
-    mir::log_info("%s updated=%s, original=%s", __func__, dump_of(updated).c_str(), dump_of(original).c_str());
+    trace("%s updated=%s, original=%s", __func__, updated, original);
     return policy->advise_output_update(updated, original);
 }
 MIRAL_TRACE_EXCEPTION
 
 void miral::WindowManagementTrace::advise_output_delete(Output const& output)
 try {
-    mir::log_info("%s output=%s", __func__, dump_of(output).c_str());
+    trace("%s output=%s", __func__, output);
     return policy->advise_output_delete(output);
 }
 MIRAL_TRACE_EXCEPTION
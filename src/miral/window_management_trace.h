@@ -29,11 +29,18 @@
 
 namespace miral
 {
+class BinaryTrace;
+
 class WindowManagementTrace : public WindowManagementPolicy,
     WindowManagerToolsImplementation
 {
 public:
-    WindowManagementTrace(WindowManagerTools const& wrapped, WindowManagementPolicyBuilder const& builder);
+    /// If a binary trace is supplied the trace is recorded there instead of
+    /// being logged
+    WindowManagementTrace(
+        WindowManagerTools const& wrapped,
+        WindowManagementPolicyBuilder const& builder,
+        std::shared_ptr<BinaryTrace> const& binary = nullptr);
 
 private:
     virtual auto count_applications() const -> unsigned int override;
@@ -162,8 +169,13 @@ public:
 private:
     WindowManagerTools wrapped;
     std::unique_ptr<miral::WindowManagementPolicy> const policy;
+    std::shared_ptr<BinaryTrace> const binary;
     std::atomic<unsigned> mutable trace_count;
     std::function<void()> log_input;
+
+    // The format may only use %s conversions
+    template<typename... Args>
+    void trace(char const* format, Args const&... args) const;
 };
 }
 
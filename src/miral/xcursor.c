@@ -897,3 +897,78 @@ xcursor_load_theme(const char *theme, int size,
 	if (inherits)
 		free(inherits);
 }
+
+static XcursorImages *
+load_cursor_from_theme(const char *theme, const char *name, int size,
+		       int depth)
+{
+	char *full, *dir;
+	char *inherits = NULL;
+	const char *path, *i;
+	FILE *f;
+	XcursorImages *images = NULL;
+
+	for (path = XcursorLibraryPath();
+	     path && !images;
+	     path = _XcursorNextPath(path)) {
+		dir = _XcursorBuildThemeDir(path, theme);
+		if (!dir)
+			continue;
+
+		full = _XcursorBuildFullname(dir, "cursors", name);
+
+		if (full) {
+			f = fopen(full, "r");
+			if (f) {
+				images = XcursorFileLoadImages(f, size);
+				if (images)
+					XcursorImagesSetName(images, name);
+				fclose(f);
+			}
+			free(full);
+		}
+
+		if (!inherits) {
+			full = _XcursorBuildFullname(dir, "", "index.theme");
+			if (full) {
+				inherits = _XcursorThemeInherits(full);
+				free(full);
+			}
+		}
+
+		free(dir);
+	}
+
+	/* Themes that inherit from each other would otherwise never finish */
+	if (depth < 16) {
+		for (i = inherits; i && !images; i = _XcursorNextPath(i))
+			images = load_cursor_from_theme(i, name, size,
+							depth + 1);
+	}
+
+	if (inherits)
+		free(inherits);
+
+	return images;
+}
+
+/** Load one cursor of a theme
+ *
+ * This function loads the named cursor from a given theme or, if the
+ * theme doesn't have it, from the themes it inherits. Unlike
+ * xcursor_load_theme() only the one cursor file is read.
+ *
+ * \param theme The name of theme that should be searched
+ * \param name The name of the cursor (a file name, not a path)
+ * \param size The desired size of the cursor images
+ * \return The cursor's images, which the caller is expected to destroy
+ * with XcursorImagesDestroy(), or NULL if the cursor wasn't found
+ */
+XcursorImages *
+xcursor_load_cursor(const char *theme, const char *name, int size)
+{
+	if (!theme)
+		theme = "default";
+
+	return load_cursor_from_theme(theme, name, size, 0);
+}
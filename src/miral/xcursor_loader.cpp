@@ -36,11 +36,13 @@ extern "C"
 }
 
 namespace mg = mir::graphics;
-namespace mi = mir::input;
 namespace geom = mir::geometry;
 
 namespace
 {
+// Enough for the cursors a toolkit asks for, few enough not to matter
+std::size_t const max_missing_images{256};
+
 class XCursorImage : public mg::CursorImage
 {
 public:
@@ -142,23 +144,63 @@ xcursor_name_for_mir_cursor(std::string const& mir_cursor_name)
 }
 }
 
-miral::XCursorLoader::XCursorLoader()
+miral::XCursorLoader::XCursorLoader() :
+    XCursorLoader{"default"}
 {
-    load_cursor_theme("default");
 }
 
-miral::XCursorLoader::XCursorLoader(std::string const& theme)
+miral::XCursorLoader::XCursorLoader(std::string const& theme) :
+    theme{theme}
 {
-    load_cursor_theme(theme);
 }
 
-// Each XcursorImages represents images for the different sizes of a given symbolic cursor.
-void miral::XCursorLoader::load_appropriately_sized_image(_XcursorImages *images)
+std::shared_ptr<mg::CursorImage> miral::XCursorLoader::image(
+    std::string const& cursor_name,
+    geom::Size const& size)
 {
-    // We would rather take this lock in load_cursor_theme but the Xcursor lib style
-    // makes it difficult to use our standard 'pass the lg around to _locked members' pattern
+    auto xcursor_name = xcursor_name_for_mir_cursor(cursor_name);
+
     std::lock_guard<std::mutex> lg(guard);
 
+    if (auto const image = image_locked(lg, xcursor_name, size))
+        return image;
+
+    // Fall back
+    return image_locked(lg, "arrow", size);
+}
+
+auto miral::XCursorLoader::image_locked(
+    std::lock_guard<std::mutex> const&,
+    std::string const& xcursor_name,
+    geom::Size const& size) -> std::shared_ptr<mg::CursorImage>
+{
+    auto const key = std::make_tuple(xcursor_name, size.width.as_int(), size.height.as_int());
+
+    auto const it = loaded_images.find(key);
+    if (it != loaded_images.end())
+        return it->second;
+
+    // Cursor names come from clients: don't let them name other files
+    if (xcursor_name.empty() || xcursor_name.find('/') != std::string::npos)
+        return nullptr;
+
+    // Searching the theme means reading directories, so don't repeat a failed search
+    if (missing_images.count(key))
+        return nullptr;
+
+    // Cursors are named by their square dimension...called the nominal size in XCursor terminology, so we just look up by width.
+    // Later we verify the actual size.
+    auto const images = xcursor_load_cursor(theme.c_str(), xcursor_name.c_str(), size.width.as_int());
+    if (!images)
+    {
+        // A client could name any number of cursors, so start afresh rather than grow without limit
+        if (missing_images.size() == max_missing_images)
+            missing_images.clear();
+
+        missing_images.insert(key);
+        return nullptr;
+    }
+
     // We have to save all the images as XCursor expects us to free them.
     // This contains the actual image data though, so we need to ensure they stay alive
     // with the lifetime of the mg::CursorImage instance which refers to them.
@@ -167,49 +209,17 @@ void miral::XCursorLoader::load_appropriately_sized_image(_XcursorImages *images
             XcursorImagesDestroy(images);
         });
 
+    auto chosen = images->images[0];
     for (int i = 0; i < images->nimage; i++)
     {
         _XcursorImage *candidate = images->images[i];
-        if (candidate->width == mi::default_cursor_size.width.as_uint32_t() &&
-            candidate->height == mi::default_cursor_size.height.as_uint32_t())
+        if (candidate->width == size.width.as_uint32_t() &&
+            candidate->height == size.height.as_uint32_t())
         {
-            loaded_images[std::string(images->name)] = std::make_shared<XCursorImage>(candidate, saved_xcursor_library_resource);
-            return;
+            chosen = candidate;
+            break;
         }
     }
 
-    loaded_images[std::string(images->name)] = std::make_shared<XCursorImage>(images->images[0], saved_xcursor_library_resource);
-}
-
-void miral::XCursorLoader::load_cursor_theme(std::string const& theme_name)
-{
-    // Cursors are named by their square dimension...called the nominal size in XCursor terminology, so we just look up by width.
-    // Later we verify the actual size.
-    xcursor_load_theme(theme_name.c_str(), mi::default_cursor_size.width.as_uint32_t(),
-        [](XcursorImages* images, void *this_ptr)  -> void
-        {
-            // Can't use lambda capture as this lambda is thunked to a C function ptr
-            auto p = static_cast<miral::XCursorLoader*>(this_ptr);
-            p->load_appropriately_sized_image(images);
-        }, this);
-}
-
-std::shared_ptr<mg::CursorImage> miral::XCursorLoader::image(
-    std::string const& cursor_name,
-    geom::Size const& /*size*/)
-{
-    auto xcursor_name = xcursor_name_for_mir_cursor(cursor_name);
-
-    std::lock_guard<std::mutex> lg(guard);
-
-    auto it = loaded_images.find(xcursor_name);
-    if (it != loaded_images.end())
-        return it->second;
-
-    // Fall back
-    it = loaded_images.find("arrow");
-    if (it != loaded_images.end())
-        return it->second;
-
-    return nullptr;
+    return loaded_images[key] = std::make_shared<XCursorImage>(chosen, saved_xcursor_library_resource);
 }
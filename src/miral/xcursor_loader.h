@@ -26,17 +26,18 @@
 #include <string>
 #include <map>
 #include <mutex>
-
-// Unfortunately this library does not compile as C++ so we can not namespace it.
-extern "C"
-{
-struct _XcursorImages;
-}
+#include <set>
+#include <tuple>
 
 namespace mir { namespace graphics { class CursorImage; } }
 
 namespace miral
 {
+/// Loads cursor images from an XCursor theme.
+///
+/// Each cursor is read from the theme (and decoded) the first time an image
+/// of it is requested, and kept for later requests at the same size. The
+/// theme is not searched again for a (recently) missing cursor.
 class XCursorLoader : public mir::input::CursorImages
 {
 public:
@@ -53,12 +54,21 @@ protected:
     XCursorLoader& operator=(XCursorLoader const&) = delete;
 
 private:
+    std::string const theme;
+
     std::mutex guard;
 
-    std::map<std::string, std::shared_ptr<mir::graphics::CursorImage>> loaded_images;
+    // Keyed by XCursor name, width and height
+    using ImageKey = std::tuple<std::string, int, int>;
+    std::map<ImageKey, std::shared_ptr<mir::graphics::CursorImage>> loaded_images;
+
+    // Images the theme lacks. Client chosen, so limited in number
+    std::set<ImageKey> missing_images;
 
-    void load_cursor_theme(std::string const& theme_name);
-    void load_appropriately_sized_image(_XcursorImages *images);
+    auto image_locked(
+        std::lock_guard<std::mutex> const&,
+        std::string const& xcursor_name,
+        mir::geometry::Size const& size) -> std::shared_ptr<mir::graphics::CursorImage>;
 };
 }
 
@@ -19,9 +19,14 @@
 #include "mir/log.h"
 #include "mir/graphics/platform.h"
 #include "mir/graphics/platform_probe.h"
+#include "mir/probe_cache.h"
+#include "mir/shared_library_prober.h"
 
 #include <boost/throw_exception.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+
 std::shared_ptr<mir::SharedLibrary>
 mir::graphics::module_for_device(
     std::vector<std::shared_ptr<SharedLibrary>> const& modules,
@@ -107,3 +112,53 @@ mir::graphics::module_for_device(
     }
     BOOST_THROW_EXCEPTION((std::runtime_error{"Failed to find platform for current system"}));
 }
+
+std::shared_ptr<mir::SharedLibrary>
+mir::graphics::module_for_device(
+    std::string const& path,
+    ProbeCache const& cache,
+    options::ProgramOption const& options,
+    std::shared_ptr<ConsoleServices> const& console,
+    SharedLibraryProberReport& report)
+{
+    // The platforms probe the DRM devices, and mesa-x11 needs an X server
+    auto const x11_display = getenv("DISPLAY");
+    auto const key =
+        "graphics\n" + library_fingerprint(path) + device_fingerprint("drm") +
+        "DISPLAY=" + (x11_display ? x11_display : "");
+
+    auto const cached = cache.lookup(key, path);
+    if (!cached.empty())
+    {
+        try
+        {
+            report.loading_library(cached);
+            return module_for_device({std::make_shared<SharedLibrary>(cached)}, options, console);
+        }
+        catch (std::runtime_error const& error)
+        {
+            report.loading_failed(cached, error);
+        }
+    }
+
+    std::vector<std::shared_ptr<SharedLibrary>> modules;
+    std::vector<std::string> filenames;
+
+    select_named_libraries_for_path(
+        path,
+        [&](std::string const& filename, std::shared_ptr<SharedLibrary> const& module)
+        {
+            modules.push_back(module);
+            filenames.push_back(filename);
+            return Selection::persist;
+        },
+        report);
+
+    if (modules.empty())
+        BOOST_THROW_EXCEPTION((std::runtime_error{"Failed to find any platform plugins in: " + path}));
+
+    auto const module = module_for_device(modules, options, console);
+    cache.store(key, filenames[std::find(begin(modules), end(modules), module) - begin(modules)]);
+
+    return module;
+}
@@ -53,8 +53,10 @@ char const* const mo::touchspots_opt              = "enable-touchspots";
 char const* const mo::cursor_opt                  = "cursor";
 char const* const mo::fatal_except_opt            = "on-fatal-error-except";
 char const* const mo::debug_opt                   = "debug";
+char const* const mo::log_severity_opt            = "log-severity";
 char const* const mo::composite_delay_opt         = "composite-delay";
 char const* const mo::enable_key_repeat_opt       = "enable-key-repeat";
+char const* const mo::touch_resampling_opt        = "touch-resampling";
 char const* const mo::x11_display_opt             = "x11-display-experimental";
 char const* const mo::wayland_extensions_opt      = "wayland_extensions";
 char const* const mo::wayland_extensions_value    = "wl_shell:xdg_wm_base:zxdg_shell_v6";
@@ -66,6 +68,7 @@ char const* const mo::lttng_opt_value = "lttng";
 char const* const mo::platform_graphics_lib = "platform-graphics-lib";
 char const* const mo::platform_input_lib = "platform-input-lib";
 char const* const mo::platform_path = "platform-path";
+char const* const mo::platform_probe_cache_opt = "platform-probe-cache";
 
 char const* const mo::console_provider = "console-provider";
 char const* const mo::logind_console = "logind";
@@ -161,12 +164,18 @@ mo::DefaultConfiguration::DefaultConfiguration(
         (no_server_socket_opt, "Do not provide a socket filename for client connections")
         (arw_server_socket_opt, "Make socket filename globally rw (equivalent to chmod a=rw)")
         (prompt_socket_opt, "Provide a \"..._trusted\" filename for prompt helper connections")
+        (frontend_threads_opt, po::value<int>()->default_value(1),
+            "Threads in the IPC thread pool. Requests from each client are "
+            "handled in order; separate clients are served in parallel.")
         (platform_graphics_lib, po::value<std::string>(),
             "Library to use for platform graphics support (default: autodetect)")
         (platform_input_lib, po::value<std::string>(),
             "Library to use for platform input support (default: input-stub.so)")
         (platform_path, po::value<std::string>()->default_value(MIR_SERVER_PLATFORM_PATH),
             "Directory to look for platform libraries (default: " MIR_SERVER_PLATFORM_PATH ")")
+        (platform_probe_cache_opt, po::value<bool>()->default_value(true),
+            "Remember the platform libraries chosen by probing and, until the libraries or devices "
+            "change, load only those.")
         (enable_input_opt, po::value<bool>()->default_value(enable_input_default),
             "Enable input.")
         (compositor_report_opt, po::value<std::string>()->default_value(off_opt_value),
@@ -210,10 +219,16 @@ mo::DefaultConfiguration::DefaultConfiguration(
             "Cursor (mouse pointer) to use [{auto,null,software}]")
         (enable_key_repeat_opt, po::value<bool>()->default_value(true),
              "Enable server generated key repeat")
+        (touch_resampling_opt, po::value<std::string>(),
+            "Deliver touch motion once per frame, resampled to the display's refresh: "
+            "a comma separated list of touchscreen names, or \"all\".")
         (fatal_except_opt, "On \"fatal error\" conditions [e.g. drivers behaving "
             "in unexpected ways] throw an exception (instead of a core dump)")
         (debug_opt, "Enable extra development debugging. "
             "This is only interesting for people doing Mir server or client development.")
+        (log_severity_opt, po::value<std::string>()->default_value("debug"),
+            "Least severe log messages to write (less severe messages are discarded). "
+            "[{critical,error,warning,informational,debug}]")
         (console_provider,
             po::value<std::string>()->default_value("auto"),
             "Console device handling\n"
@@ -135,9 +135,16 @@ void mie::LibInputDevice::stop()
 {
     sink = nullptr;
     builder = nullptr;
+    pending_events.clear();
 }
 
 void mie::LibInputDevice::process_event(libinput_event* event)
+{
+    queue_event(event);
+    flush_events();
+}
+
+void mie::LibInputDevice::queue_event(libinput_event* event)
 {
     if (!sink)
         return;
@@ -147,19 +154,19 @@ void mie::LibInputDevice::process_event(libinput_event* event)
         switch(libinput_event_get_type(event))
         {
         case LIBINPUT_EVENT_KEYBOARD_KEY:
-            sink->handle_input(convert_event(libinput_event_get_keyboard_event(event)));
+            queue(convert_event(libinput_event_get_keyboard_event(event)));
             break;
         case LIBINPUT_EVENT_POINTER_MOTION:
-            sink->handle_input(convert_motion_event(libinput_event_get_pointer_event(event)));
+            queue(convert_motion_event(libinput_event_get_pointer_event(event)));
             break;
         case LIBINPUT_EVENT_POINTER_MOTION_ABSOLUTE:
-            sink->handle_input(convert_absolute_motion_event(libinput_event_get_pointer_event(event)));
+            queue(convert_absolute_motion_event(libinput_event_get_pointer_event(event)));
             break;
         case LIBINPUT_EVENT_POINTER_BUTTON:
-            sink->handle_input(convert_button_event(libinput_event_get_pointer_event(event)));
+            queue(convert_button_event(libinput_event_get_pointer_event(event)));
             break;
         case LIBINPUT_EVENT_POINTER_AXIS:
-            sink->handle_input(convert_axis_event(libinput_event_get_pointer_event(event)));
+            queue(convert_axis_event(libinput_event_get_pointer_event(event)));
             break;
         // touch events are processed as a batch of changes over all touch pointts
         case LIBINPUT_EVENT_TOUCH_DOWN:
@@ -177,7 +184,7 @@ void mie::LibInputDevice::process_event(libinput_event* event)
         case LIBINPUT_EVENT_TOUCH_FRAME:
             if (is_output_active())
             {
-                sink->handle_input(convert_touch_frame(libinput_event_get_touch_event(event)));
+                queue(convert_touch_frame(libinput_event_get_touch_event(event)));
             }
             break;
         default:
@@ -190,6 +197,43 @@ void mie::LibInputDevice::process_event(libinput_event* event)
     }
 }
 
+void mie::LibInputDevice::queue(std::shared_ptr<MirEvent> const& event)
+{
+    // libinput gives the events from one evdev frame the same time, so a new
+    // time starts the next frame
+    if (!pending_events.empty() &&
+        pending_events.back()->to_input()->event_time() != event->to_input()->event_time())
+    {
+        flush_events();
+    }
+
+    pending_events.push_back(event);
+}
+
+void mie::LibInputDevice::flush_events()
+{
+    if (pending_events.empty())
+        return;
+
+    std::vector<std::shared_ptr<MirEvent>> frame;
+    frame.swap(pending_events);
+
+    if (!sink)
+        return;
+
+    try
+    {
+        if (frame.size() == 1)
+            sink->handle_input(frame.front());
+        else
+            sink->handle_input_frame(frame);
+    }
+    catch(std::exception const& error)
+    {
+        mir::log_error("Failure processing input event received from libinput: " + boost::diagnostic_information(error));
+    }
+}
+
 mir::EventUPtr mie::LibInputDevice::convert_event(libinput_event_keyboard* keyboard)
 {
     std::chrono::nanoseconds const time = std::chrono::microseconds(libinput_event_keyboard_get_time_usec(keyboard));
@@ -64,6 +64,11 @@ public:
     void apply_settings(TouchscreenSettings const&) override;
 
     void process_event(libinput_event* event);
+    /// Converts the event and holds on to it until its frame is complete: the
+    /// queued frame is flushed first if the event starts a new one
+    void queue_event(libinput_event* event);
+    /// Hands the queued events to the sink as a single frame
+    void flush_events();
     ::libinput_device* device() const;
     ::libinput_device_group* group();
     void add_device_of_group(LibInputDevicePtr ptr);
@@ -74,6 +79,7 @@ private:
     EventUPtr convert_absolute_motion_event(libinput_event_pointer* pointer);
     EventUPtr convert_axis_event(libinput_event_pointer* pointer);
     EventUPtr convert_touch_frame(libinput_event_touch* touch);
+    void queue(std::shared_ptr<MirEvent> const& event);
     void handle_touch_down(libinput_event_touch* touch);
     void handle_touch_up(libinput_event_touch* touch);
     void handle_touch_motion(libinput_event_touch* touch);
@@ -89,6 +95,7 @@ private:
 
     InputSink* sink{nullptr};
     EventBuilder* builder{nullptr};
+    std::vector<std::shared_ptr<MirEvent>> pending_events;
 
     InputDeviceInfo info;
     mir::geometry::Point pointer_pos;
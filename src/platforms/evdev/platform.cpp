@@ -355,6 +355,17 @@ void mie::Platform::process_input_events()
         return EventType(libinput_get_event(lilib), libinput_event_destroy);
     };
 
+    // Each device collects the events of a frame and hands them to its sink in
+    // one go. To keep the order of events across devices, a device's frame is
+    // flushed as soon as an event from another device arrives.
+    LibInputDevice* queued{nullptr};
+    auto const flush_devices = [&queued]
+    {
+        if (queued)
+            queued->flush_events();
+        queued = nullptr;
+    };
+
     while(auto ev = next_event())
     {
         auto type = libinput_event_get_type(ev.get());
@@ -362,10 +373,12 @@ void mie::Platform::process_input_events()
 
         if (type == LIBINPUT_EVENT_DEVICE_ADDED)
         {
+            flush_devices();
             device_added(device);
         }
         else if(type == LIBINPUT_EVENT_DEVICE_REMOVED)
         {
+            flush_devices();
             device_removed(device);
         }
         else
@@ -373,9 +386,18 @@ void mie::Platform::process_input_events()
             auto dev = find_device(
                 libinput_device_get_device_group(device));
             if (dev != end(devices))
-                (*dev)->process_event(ev.get());
+            {
+                if (queued != dev->get())
+                {
+                    flush_devices();
+                    queued = dev->get();
+                }
+                (*dev)->queue_event(ev.get());
+            }
         }
     }
+
+    flush_devices();
 }
 
 void mie::Platform::pause_for_config()
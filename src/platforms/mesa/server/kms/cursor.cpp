@@ -28,6 +28,7 @@
 
 #include <boost/exception/errinfo_errno.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 #include <vector>
 
@@ -38,6 +39,9 @@ namespace geom = mir::geometry;
 namespace
 {
 const uint64_t fallback_cursor_size = 64;
+
+// Enough for the cursors a desktop switches between
+std::size_t const max_cached_images = 8;
 char const* const mir_drm_cursor_64x64 = "MIR_DRM_CURSOR_64x64";
 
 // Transforms a relative position within the display bounds described by \a rect which is rotated with \a orientation
@@ -149,6 +153,7 @@ mgm::Cursor::Cursor(
     std::shared_ptr<CurrentConfiguration> const& current_configuration) :
         output_container(output_container),
         current_position(),
+        images(1),
         last_set_failed(false),
         min_buffer_width{std::numeric_limits<uint32_t>::max()},
         min_buffer_height{std::numeric_limits<uint32_t>::max()},
@@ -194,26 +199,42 @@ void mgm::Cursor::pad_and_write_image_data_locked(
     std::lock_guard<std::mutex> const& lg,
     GBMBOWrapper& buffer)
 {
+    auto& image = images.front();
     auto const orientation = buffer.orientation();
     bool const sideways = orientation == mir_orientation_left || orientation == mir_orientation_right;
 
     auto const min_width  = sideways ? min_buffer_width : min_buffer_height;
     auto const min_height = sideways ? min_buffer_height : min_buffer_width;
 
-    auto const image_width = std::min(min_width, size.width.as_uint32_t());
-    auto const image_height = std::min(min_height, size.height.as_uint32_t());
-    auto const image_stride = size.width.as_uint32_t() * 4;
+    auto const image_width = std::min(min_width, image.size.width.as_uint32_t());
+    auto const image_height = std::min(min_height, image.size.height.as_uint32_t());
+    auto const image_stride = image.size.width.as_uint32_t() * 4;
 
     auto const buffer_stride = std::max(min_width*4, gbm_bo_get_stride(buffer));  // in bytes
     auto const buffer_height = std::max(min_height, gbm_bo_get_height(buffer));
     size_t const padded_size = buffer_stride * buffer_height;
 
-    auto padded = std::unique_ptr<uint8_t[]>(new uint8_t[padded_size]);
+    auto const cached = std::find_if(begin(image.padded), end(image.padded), [&](PaddedImage const& padded)
+        {
+            return padded.orientation == orientation &&
+                padded.image_width == image_width && padded.image_height == image_height &&
+                padded.buffer_stride == buffer_stride && padded.buffer_height == buffer_height;
+        });
+
+    if (cached != end(image.padded))
+    {
+        write_buffer_data_locked(lg, buffer, cached->data.data(), cached->data.size());
+        return;
+    }
+
+    image.padded.push_back(
+        {orientation, image_width, image_height, buffer_stride, buffer_height, std::vector<uint8_t>(padded_size)});
+    auto& padded = image.padded.back().data;
     size_t rhs_padding = buffer_stride - 4*image_width;
 
     auto const filler = 0; // 0x3f; is useful to make buffer visible for debugging
-    uint8_t const* src = argb8888.data();
-    uint8_t* dest = &padded[0];
+    uint8_t const* src = image.argb8888.data();
+    uint8_t* dest = padded.data();
 
     switch (orientation)
     {
@@ -272,7 +293,31 @@ void mgm::Cursor::pad_and_write_image_data_locked(
         break;
     }
 
-    write_buffer_data_locked(lg, buffer, &padded[0], padded_size);
+    write_buffer_data_locked(lg, buffer, padded.data(), padded_size);
+}
+
+void mgm::Cursor::select_image_locked(std::lock_guard<std::mutex> const&, CursorImage const& cursor_image)
+{
+    auto const size = cursor_image.size();
+    auto const data = static_cast<uint8_t const*>(cursor_image.as_argb_8888());
+    auto const length = size.width.as_uint32_t() * size.height.as_uint32_t() * 4;
+
+    // Comparing the pixels is much cheaper than padding (and rotating) them again
+    auto const cached = std::find_if(begin(images), end(images), [&](Image const& image)
+        {
+            return image.size == size && std::equal(begin(image.argb8888), end(image.argb8888), data);
+        });
+
+    if (cached != end(images))
+    {
+        std::rotate(begin(images), cached, cached + 1);
+        return;
+    }
+
+    if (images.size() == max_cached_images)
+        images.pop_back();
+
+    images.insert(begin(images), Image{size, {data, data + length}, {}});
 }
 
 void mgm::Cursor::show()
@@ -290,10 +335,7 @@ void mgm::Cursor::show(CursorImage const& cursor_image)
 {
     std::lock_guard<std::mutex> lg(guard);
 
-    size = cursor_image.size();
-
-    argb8888.resize(size.width.as_uint32_t() * size.height.as_uint32_t() * 4);
-    memcpy(argb8888.data(), cursor_image.as_argb_8888(), argb8888.size());
+    select_image_locked(lg, cursor_image);
 
     hotspot = cursor_image.hotspot();
     {
@@ -387,7 +429,7 @@ void mgm::Cursor::place_cursor_at_locked(
         if (output_rect.contains(position))
         {
             auto dp = transform(output_rect, position - output_rect.top_left, orientation);
-            auto hs = transform(geom::Rectangle{{0,0}, size}, hotspot, orientation);
+            auto hs = transform(geom::Rectangle{{0,0}, images.front().size}, hotspot, orientation);
 
             // It's a little strange that we implement hotspot this way as there is
             // drmModeSetCursor2 with hotspot support. However it appears to not actually
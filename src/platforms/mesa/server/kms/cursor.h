@@ -97,6 +97,7 @@ private:
     void pad_and_write_image_data_locked(
         std::lock_guard<std::mutex> const&,
         GBMBOWrapper& buffer);
+    void select_image_locked(std::lock_guard<std::mutex> const&, CursorImage const& cursor_image);
     void clear(std::lock_guard<std::mutex> const&);
 
     GBMBOWrapper& buffer_for_output(KMSOutput const& output);
@@ -106,8 +107,29 @@ private:
     KMSOutputContainer& output_container;
     geometry::Point current_position;
     geometry::Displacement hotspot;
-    geometry::Size size;
-    std::vector<uint8_t> argb8888;
+
+    // The image data rotated and padded to fill a buffer
+    struct PaddedImage
+    {
+        MirOrientation orientation;
+        uint32_t image_width;
+        uint32_t image_height;
+        uint32_t buffer_stride;
+        uint32_t buffer_height;
+        std::vector<uint8_t> data;
+    };
+
+    // A cursor image, with the padded versions of it written so far
+    struct Image
+    {
+        geometry::Size size;
+        std::vector<uint8_t> argb8888;
+        std::vector<PaddedImage> padded;
+    };
+
+    // Recently shown images, so switching back to one (or rotating it) doesn't
+    // pad it again. The current image is first.
+    std::vector<Image> images;
 
     bool visible;
     bool last_set_failed;
@@ -34,7 +34,8 @@ namespace mg = mir::graphics;
 namespace ms = mir::scene;
 namespace mf = mir::frontend;
 
-mc::BufferStreamFactory::BufferStreamFactory()
+mc::BufferStreamFactory::BufferStreamFactory(std::shared_ptr<CompositorReport> const& report) :
+    report{report}
 {
 }
 
@@ -51,5 +52,5 @@ std::shared_ptr<mc::BufferStream> mc::BufferStreamFactory::create_buffer_stream(
     mg::BufferProperties const& buffer_properties)
 {
     return std::make_shared<mc::Stream>(
-        buffer_properties.size, buffer_properties.format);
+        buffer_properties.size, buffer_properties.format, report);
 }
@@ -21,6 +21,8 @@
 #include "queueing_schedule.h"
 #include "dropping_schedule.h"
 #include "mir/graphics/buffer.h"
+#include "mir/compositor/compositor_report.h"
+#include "../report/null_report_factory.h"
 #include <boost/throw_exception.hpp>
 
 namespace mc = mir::compositor;
@@ -36,12 +38,20 @@ enum class mc::Stream::ScheduleMode {
 
 mc::Stream::Stream(
     geom::Size size, MirPixelFormat pf) :
+    Stream(size, pf, mir::report::null_compositor_report())
+{
+}
+
+mc::Stream::Stream(
+    geom::Size size, MirPixelFormat pf, std::shared_ptr<CompositorReport> const& report) :
     schedule_mode(ScheduleMode::Queueing),
     schedule(std::make_shared<mc::QueueingSchedule>()),
     arbiter(std::make_shared<mc::MultiMonitorArbiter>(schedule)),
     size(size),
     pf(pf),
     first_frame_posted(false),
+    submitted_buffers(0),
+    report(report),
     frame_callback{[](auto){}}
 {
 }
@@ -53,12 +63,16 @@ void mc::Stream::submit_buffer(std::shared_ptr<mg::Buffer> const& buffer)
     if (!buffer)
         BOOST_THROW_EXCEPTION(std::invalid_argument("cannot submit null buffer"));
 
+    uint64_t sequence;
     {
         std::lock_guard<decltype(mutex)> lk(mutex); 
         first_frame_posted = true;
         pf = buffer->pixel_format();
+        sequence = ++submitted_buffers;
         schedule->schedule(buffer);
     }
+    // The scene uses the stream's address as the ID of its renderables
+    report->buffer_submitted(static_cast<BufferStream*>(this), buffer->id(), sequence);
     {
         std::lock_guard<decltype(callback_mutex)> lock{callback_mutex};
         frame_callback(buffer->size());
@@ -36,10 +36,12 @@ namespace frontend { class ClientBuffers; }
 namespace compositor
 {
 class Schedule;
+class CompositorReport;
 class Stream : public BufferStream
 {
 public:
     Stream(geometry::Size sz, MirPixelFormat format);
+    Stream(geometry::Size sz, MirPixelFormat format, std::shared_ptr<CompositorReport> const& report);
     ~Stream();
 
     void submit_buffer(std::shared_ptr<graphics::Buffer> const& buffer) override;
@@ -69,6 +71,8 @@ private:
     geometry::Size size; 
     MirPixelFormat pf;
     bool first_frame_posted;
+    uint64_t submitted_buffers;
+    std::shared_ptr<CompositorReport> const report;
 
     std::mutex callback_mutex;
     std::function<void(geometry::Size const&)> frame_callback;
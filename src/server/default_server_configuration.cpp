@@ -26,7 +26,7 @@
 #include "mir/default_configuration.h"
 #include "mir/cookie/authority.h"
 
-#include "mir/logging/dumb_console_logger.h"
+#include "mir/logging/async_logger.h"
 #include "mir/options/program_option.h"
 #include "mir/frontend/session_credentials.h"
 #include "mir/frontend/session_authorizer.h"
@@ -37,6 +37,7 @@
 #include "mir/input/vt_filter.h"
 #include "mir/input/input_manager.h"
 #include "mir/time/steady_clock.h"
+#include "mir/thread/work_stealing_thread_pool.h"
 #include "mir/geometry/rectangles.h"
 #include "mir/default_configuration.h"
 #include "mir/scene/null_prompt_session_listener.h"
@@ -45,6 +46,8 @@
 #include "mir/scene/coordinate_translator.h"
 #include "mir/console_services.h"
 
+#include <algorithm>
+#include <thread>
 #include <type_traits>
 
 namespace mc = mir::compositor;
@@ -177,6 +180,16 @@ std::shared_ptr<mir::ServerActionQueue> mir::DefaultServerConfiguration::the_ser
     return the_main_loop();
 }
 
+std::shared_ptr<mir::thread::WorkStealingThreadPool> mir::DefaultServerConfiguration::the_background_thread_pool()
+{
+    return background_thread_pool(
+        []()
+        {
+            auto const threads = std::max(1u, std::thread::hardware_concurrency());
+            return std::make_shared<mir::thread::WorkStealingThreadPool>(threads, "Mir/Worker");
+        });
+}
+
 std::shared_ptr<mir::ServerStatusListener> mir::DefaultServerConfiguration::the_server_status_listener()
 {
     return server_status_listener(
@@ -225,9 +238,25 @@ auto mir::DefaultServerConfiguration::the_logger()
     -> std::shared_ptr<ml::Logger>
 {
     return logger(
-        []() -> std::shared_ptr<ml::Logger>
+        [this]() -> std::shared_ptr<ml::Logger>
         {
-            return std::make_shared<ml::DumbConsoleLogger>();
+            static std::pair<char const*, ml::Severity> const severities[] = {
+                {"critical", ml::Severity::critical},
+                {"error", ml::Severity::error},
+                {"warning", ml::Severity::warning},
+                {"informational", ml::Severity::informational},
+                {"debug", ml::Severity::debug}};
+
+            auto const opt = the_options()->get<std::string>(options::log_severity_opt);
+
+            for (auto const& severity : severities)
+            {
+                if (opt == severity.first)
+                    return std::make_shared<ml::AsyncLogger>(severity.second);
+            }
+
+            throw AbnormalExit(std::string("Invalid ") + options::log_severity_opt + " option: " + opt +
+                " (valid options are: \"critical\", \"error\", \"warning\", \"informational\" and \"debug\")");
         });
 }
 
@@ -25,6 +25,7 @@
 
 #include <thread>
 #include <string>
+#include <vector>
 #include <functional>
 
 namespace google
@@ -45,11 +46,16 @@ class ConnectionCreator;
 class ConnectorReport;
 
 /// provides a client-side socket fd for each connection
+///
+/// Requests are processed by a pool of \p threads "Mir/IPC" threads. Each
+/// connection's handlers run on a per-connection strand, so requests from one
+/// client are handled in order while separate clients are served in parallel.
 class BasicConnector : public Connector
 {
 public:
     explicit BasicConnector(
         std::shared_ptr<ConnectionCreator> const& connection_creator,
+        int threads,
         std::shared_ptr<ConnectorReport> const& report);
     ~BasicConnector() noexcept;
     void start() override;
@@ -68,7 +74,7 @@ protected:
     std::shared_ptr<ConnectorReport> const report;
 
 private:
-    std::thread io_service_thread;
+    std::vector<std::thread> io_service_threads;
     std::shared_ptr<ConnectionCreator> const connection_creator;
 };
 
@@ -79,6 +85,7 @@ public:
     explicit PublishedSocketConnector(
         const std::string& socket_file,
         std::shared_ptr<ConnectionCreator> const& connection_creator,
+        int threads,
         EmergencyCleanupRegistry& emergency_cleanup_registry,
         std::shared_ptr<ConnectorReport> const& report);
     ~PublishedSocketConnector() noexcept;
@@ -65,6 +65,8 @@
 #include "mir/geometry/rectangles.h"
 #include "protobuf_buffer_packer.h"
 #include "protobuf_input_converter.h"
+#include "shared_memory_input_sink.h"
+#include "mir/input/event_ring.h"
 
 #include "mir_toolkit/client_types.h"
 #include "mir_toolkit/cursors.h"
@@ -210,6 +212,9 @@ void mf::SessionMediator::connect(
 
 namespace
 {
+// Enough for several frames of high rate touch input
+std::size_t const input_ring_slots{256};
+
 template<typename T>
 std::vector<geom::Rectangle>
 extract_input_shape_from(T const& params)
@@ -347,6 +352,13 @@ void mf::SessionMediator::create_surface(
     auto buffering_sender = std::make_shared<mf::ReorderingMessageSender>(message_sender);
     std::shared_ptr<mf::EventSink> sink = sink_factory->create_sink(buffering_sender);
 
+    std::shared_ptr<mi::EventRing> input_ring;
+    if (request->has_shared_memory_input() && request->shared_memory_input())
+    {
+        input_ring = std::make_shared<mi::EventRing>(input_ring_slots);
+        sink = std::make_shared<mf::SharedMemoryInputSink>(input_ring, sink);
+    }
+
     auto const surf_id = shell->create_surface(session, params, sink);
 
     auto surface = session->get_surface(surf_id);
@@ -375,6 +387,13 @@ void mf::SessionMediator::create_surface(
         response->mutable_buffer_stream()->set_buffer_usage(request->buffer_usage());
         legacy_default_stream_map[surf_id] = buffer_stream_id;
     }
+
+    if (input_ring)
+    {
+        response->add_fd(input_ring->shm_fd());
+        response->add_fd(input_ring->wakeup_fd());
+    }
+
     done->Run();
     // ...then uncork the message sender, sending all buffered surface events.
     buffering_sender->uncork();
@@ -0,0 +1,92 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "shared_memory_input_sink.h"
+#include "mir/input/event_ring.h"
+
+namespace mf = mir::frontend;
+namespace mg = mir::graphics;
+
+mf::SharedMemoryInputSink::SharedMemoryInputSink(
+    std::shared_ptr<input::EventRing> const& ring,
+    std::shared_ptr<EventSink> const& fallback) :
+    ring{ring},
+    fallback{fallback}
+{
+}
+
+void mf::SharedMemoryInputSink::handle_event(EventUPtr&& event)
+{
+    auto const type = mir_event_get_type(event.get());
+
+    std::lock_guard<std::mutex> lock{mutex};
+
+    if (type == mir_event_type_input || type == mir_event_type_input_device_state)
+    {
+        // Events in the ring must not overtake input still on its way through the socket
+        if (ring->bypasses_consumed() == bypassed && ring->push(*event))
+            return;
+
+        ++bypassed;
+    }
+
+    fallback->handle_event(std::move(event));
+}
+
+void mf::SharedMemoryInputSink::handle_lifecycle_event(MirLifecycleState state)
+{
+    fallback->handle_lifecycle_event(state);
+}
+
+void mf::SharedMemoryInputSink::handle_display_config_change(mg::DisplayConfiguration const& config)
+{
+    fallback->handle_display_config_change(config);
+}
+
+void mf::SharedMemoryInputSink::send_ping(int32_t serial)
+{
+    fallback->send_ping(serial);
+}
+
+void mf::SharedMemoryInputSink::handle_input_config_change(MirInputConfig const& config)
+{
+    fallback->handle_input_config_change(config);
+}
+
+void mf::SharedMemoryInputSink::handle_error(ClientVisibleError const& error)
+{
+    fallback->handle_error(error);
+}
+
+void mf::SharedMemoryInputSink::send_buffer(BufferStreamId id, mg::Buffer& buffer, mg::BufferIpcMsgType type)
+{
+    fallback->send_buffer(id, buffer, type);
+}
+
+void mf::SharedMemoryInputSink::add_buffer(mg::Buffer& buffer)
+{
+    fallback->add_buffer(buffer);
+}
+
+void mf::SharedMemoryInputSink::error_buffer(geometry::Size req, MirPixelFormat format, std::string const& error_msg)
+{
+    fallback->error_buffer(req, format, error_msg);
+}
+
+void mf::SharedMemoryInputSink::update_buffer(mg::Buffer& buffer)
+{
+    fallback->update_buffer(buffer);
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_FRONTEND_SHARED_MEMORY_INPUT_SINK_H_
+#define MIR_FRONTEND_SHARED_MEMORY_INPUT_SINK_H_
+
+#include "mir/frontend/event_sink.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace mir
+{
+namespace input
+{
+class EventRing;
+}
+namespace frontend
+{
+/**
+ * Delivers a surface's input events through a shared memory EventRing
+ *
+ * Everything else goes to the wrapped (socket) sink. The client drains the
+ * ring before handling an event from the socket, so events sent here are seen
+ * in the order sent.
+ *
+ * When the ring refuses an input event (because it is full or the event is
+ * too large) that event goes to the socket, and so does later input until the
+ * client reports, through the ring, that it has handled every input event
+ * sent that way. Switching back any sooner would let newer events overtake
+ * older ones.
+ */
+class SharedMemoryInputSink : public EventSink
+{
+public:
+    SharedMemoryInputSink(
+        std::shared_ptr<input::EventRing> const& ring,
+        std::shared_ptr<EventSink> const& fallback);
+
+    void handle_event(EventUPtr&& event) override;
+    void handle_lifecycle_event(MirLifecycleState state) override;
+    void handle_display_config_change(graphics::DisplayConfiguration const& config) override;
+    void send_ping(int32_t serial) override;
+    void handle_input_config_change(MirInputConfig const& config) override;
+    void handle_error(ClientVisibleError const& error) override;
+
+    void send_buffer(BufferStreamId id, graphics::Buffer& buffer, graphics::BufferIpcMsgType type) override;
+    void add_buffer(graphics::Buffer& buffer) override;
+    void error_buffer(geometry::Size req, MirPixelFormat format, std::string const& error_msg) override;
+    void update_buffer(graphics::Buffer& buffer) override;
+
+private:
+    std::shared_ptr<input::EventRing> const ring;
+    std::shared_ptr<EventSink> const fallback;
+
+    // Held while sending events, so the ring and socket see them in the same order
+    std::mutex mutex;
+    // The number of input events sent to the socket instead of the ring
+    std::uint32_t bypassed{0};
+};
+}
+}
+
+#endif /* MIR_FRONTEND_SHARED_MEMORY_INPUT_SINK_H_ */
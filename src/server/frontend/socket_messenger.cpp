@@ -23,6 +23,7 @@
 #include "mir/raii.h"
 
 #include <boost/throw_exception.hpp>
+#include <boost/version.hpp>
 
 #include <errno.h>
 #include <string.h>
@@ -34,9 +35,22 @@ namespace mfd = mf::detail;
 namespace bs = boost::system;
 namespace ba = boost::asio;
 
+namespace
+{
+ba::io_service& io_service_for(ba::local::stream_protocol::socket& socket)
+{
+#if BOOST_VERSION >= 106600
+    return static_cast<ba::io_service&>(socket.get_executor().context());
+#else
+    return socket.get_io_service();
+#endif
+}
+}
+
 mfd::SocketMessenger::SocketMessenger(std::shared_ptr<ba::local::stream_protocol::socket> const& socket)
     : socket(socket),
-      socket_fd{IntOwnedFd{socket->native_handle()}}
+      socket_fd{IntOwnedFd{socket->native_handle()}},
+      strand{io_service_for(*socket)}
 {
     // Make the socket non-blocking to avoid hanging the server when a client
     // is unresponsive. Also increase the send buffer size to 64KiB to allow
@@ -101,7 +115,7 @@ void mfd::SocketMessenger::async_receive_msg(
          *socket,
          buffer,
          boost::asio::transfer_exactly(ba::buffer_size(buffer)),
-         handler);
+         strand.wrap(handler));
 }
 
 bs::error_code mfd::SocketMessenger::receive_msg(
@@ -51,6 +51,9 @@ private:
     std::shared_ptr<boost::asio::local::stream_protocol::socket> socket;
     mir::Fd socket_fd;
 
+    // Serialises this connection's handlers when the IPC pool has several threads
+    boost::asio::io_service::strand strand;
+
     std::mutex message_lock;
     SessionCredentials session_creds{0, 0, 0};
 };
@@ -20,15 +20,14 @@
 
 #include "mir/fd.h"
 #include "mir/log.h"
+#include "mir/work_queue.h"
 
 #include <sys/eventfd.h>
 
 #include <boost/throw_exception.hpp>
 
 #include <cstring>
-#include <deque>
 #include <functional>
-#include <mutex>
 #include <system_error>
 
 namespace
@@ -38,13 +37,14 @@ class WaylandExecutor : public mir::Executor
 public:
     void spawn (std::function<void ()>&& work) override
     {
+        // The event loop drains the whole queue, so only needs notifying
+        // when the queue becomes non-empty
+        if (workqueue.push(std::move(work)))
         {
-            std::lock_guard<std::recursive_mutex> lock{mutex};
-            workqueue.emplace_back(std::move(work));
-        }
-        if (auto err = eventfd_write(notify_fd, 1))
-        {
-            BOOST_THROW_EXCEPTION((std::system_error{err, std::system_category(), "eventfd_write failed to notify event loop"}));
+            if (auto err = eventfd_write(notify_fd, 1))
+            {
+                BOOST_THROW_EXCEPTION((std::system_error{err, std::system_category(), "eventfd_write failed to notify event loop"}));
+            }
         }
     }
 
@@ -71,7 +71,7 @@ public:
 
 private:
     WaylandExecutor(wl_event_loop* loop)
-        : notify_fd{eventfd(0, EFD_CLOEXEC | EFD_SEMAPHORE | EFD_NONBLOCK)},
+        : notify_fd{eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)},
         notify_source{wl_event_loop_add_fd(loop, notify_fd, WL_EVENT_READABLE, &on_notify, this)}
     {
         if (notify_fd == mir::Fd::invalid)
@@ -83,18 +83,6 @@ private:
         }
     }
 
-    std::function<void()> get_work()
-    {
-        std::lock_guard<std::recursive_mutex> lock{mutex};
-        if (!workqueue.empty())
-        {
-            auto const work = std::move(workqueue.front());
-            workqueue.pop_front();
-            return work;
-        }
-        return {};
-    }
-
     static int on_notify(int fd, uint32_t, void* data)
     {
         auto executor = static_cast<WaylandExecutor*>(data);
@@ -108,21 +96,21 @@ private:
                 err);
         }
 
-        while (auto work = executor->get_work())
-        {
-            try
-            {
-                work();
-            }
-            catch(...)
+        executor->workqueue.run_all([](std::function<void()>& work)
             {
-                mir::log(
-                    mir::logging::Severity::critical,
-                    MIR_LOG_COMPONENT,
-                    std::current_exception(),
-                    "Exception processing Wayland event loop work item");
-            }
-        }
+                try
+                {
+                    work();
+                }
+                catch(...)
+                {
+                    mir::log(
+                        mir::logging::Severity::critical,
+                        MIR_LOG_COMPONENT,
+                        std::current_exception(),
+                        "Exception processing Wayland event loop work item");
+                }
+            });
 
         return 0;
     }
@@ -132,16 +120,12 @@ private:
         DestructionShim* shim;
         shim = wl_container_of(listener, shim, destruction_listener);
 
-        {
-            std::lock_guard<std::recursive_mutex> lock{shim->executor->mutex};
-            wl_event_source_remove(shim->executor->notify_source);
-        }
+        wl_event_source_remove(shim->executor->notify_source);
         delete shim;
     }
 
-    std::recursive_mutex mutex;
     mir::Fd const notify_fd;
-    std::deque<std::function<void()>> workqueue;
+    mir::WorkQueue workqueue;
 
     wl_event_source* const notify_source;
 
@@ -54,13 +54,16 @@ mf::WindowWlSurfaceRole::WindowWlSurfaceRole(WlSeat* seat, wl_client* client, Wl
           output_manager{output_manager},
           sink{std::make_shared<WlSurfaceEventSink>(seat, client, surface, this)},
           params{std::make_unique<scene::SurfaceCreationParameters>(
-                 scene::SurfaceCreationParameters().of_type(mir_window_type_freestyle))}
+                 scene::SurfaceCreationParameters().of_type(mir_window_type_freestyle))},
+          configure_timer{wl_event_loop_add_timer(
+                 wl_display_get_event_loop(wl_client_get_display(client)), &configure_timed_out, this)}
 {
     surface->set_role(this);
 }
 
 mf::WindowWlSurfaceRole::~WindowWlSurfaceRole()
 {
+    wl_event_source_remove(configure_timer);
     surface->clear_role();
     sink->disconnect();
     *destroyed = true;
@@ -301,6 +304,60 @@ void mf::WindowWlSurfaceRole::commit(WlSurfaceState const& state)
     {
         create_mir_window();
     }
+
+    if (outstanding_configure && outstanding_configure_acked)
+        configure_caught_up();
+}
+
+int const mf::WindowWlSurfaceRole::configure_timeout_ms{100};
+
+bool mf::WindowWlSurfaceRole::hold_configure(
+    std::experimental::optional<geometry::Point> const& new_top_left,
+    geometry::Size const& new_size)
+{
+    if (!outstanding_configure)
+        return false;
+
+    configure_held = true;
+    held_top_left = new_top_left;
+    held_size = new_size;
+    return true;
+}
+
+void mf::WindowWlSurfaceRole::configure_sent(uint32_t serial)
+{
+    outstanding_configure = serial;
+    outstanding_configure_acked = false;
+    wl_event_source_timer_update(configure_timer, configure_timeout_ms);
+}
+
+void mf::WindowWlSurfaceRole::configure_acked(uint32_t serial)
+{
+    // Serials wrap, so compare the difference
+    if (outstanding_configure && static_cast<int32_t>(serial - outstanding_configure.value()) >= 0)
+        outstanding_configure_acked = true;
+}
+
+int mf::WindowWlSurfaceRole::configure_timed_out(void* data)
+{
+    auto const self = static_cast<WindowWlSurfaceRole*>(data);
+
+    if (self->outstanding_configure)
+        self->configure_caught_up();
+
+    return 0;
+}
+
+void mf::WindowWlSurfaceRole::configure_caught_up()
+{
+    outstanding_configure = std::experimental::nullopt;
+    wl_event_source_timer_update(configure_timer, 0);
+
+    if (configure_held)
+    {
+        configure_held = false;
+        handle_resize(held_top_left, held_size);
+    }
 }
 
 void mf::WindowWlSurfaceRole::visiblity(bool visible)
@@ -33,6 +33,7 @@
 
 struct wl_client;
 struct wl_resource;
+struct wl_event_source;
 
 namespace mir
 {
@@ -82,6 +83,9 @@ public:
     virtual void handle_resize(std::experimental::optional<geometry::Point> const& new_top_left,
                                geometry::Size const& new_size) = 0;
 
+    /// The client has acknowledged the configure event with this serial
+    void configure_acked(uint32_t serial);
+
 protected:
     std::shared_ptr<bool> const destroyed;
 
@@ -92,6 +96,15 @@ protected:
 
     void commit(WlSurfaceState const& state) override;
 
+    /// For roles whose configure events the client acknowledges: a configure
+    /// is outstanding from configure_sent() until the client has acked it and
+    /// committed. If one is outstanding this holds on to the resize and returns
+    /// true; handle_resize() is called again with the latest held resize once
+    /// the client catches up (or configure_timeout passes).
+    bool hold_configure(std::experimental::optional<geometry::Point> const& new_top_left,
+                        geometry::Size const& new_size);
+    void configure_sent(uint32_t serial);
+
 private:
     wl_client* const client;
     WlSurface* const surface;
@@ -103,6 +116,17 @@ private:
     SurfaceId surface_id_;
     std::unique_ptr<shell::SurfaceSpecification> pending_changes;
 
+    static int const configure_timeout_ms;
+    wl_event_source* const configure_timer;
+    std::experimental::optional<uint32_t> outstanding_configure;
+    bool outstanding_configure_acked{false};
+    bool configure_held{false};
+    std::experimental::optional<geometry::Point> held_top_left;
+    geometry::Size held_size;
+
+    static int configure_timed_out(void* data);
+    void configure_caught_up();
+
     void visiblity(bool visible) override;
 
     shell::SurfaceSpecification& spec();
@@ -47,7 +47,7 @@ public:
     void set_window_geometry(int32_t x, int32_t y, int32_t width, int32_t height) override;
     void ack_configure(uint32_t serial) override;
 
-    void send_configure();
+    auto send_configure() -> uint32_t;
 
     std::experimental::optional<WindowWlSurfaceRole*> const& window_role();
 
@@ -225,14 +225,15 @@ void mf::XdgSurfaceStable::set_window_geometry(int32_t x, int32_t y, int32_t wid
 
 void mf::XdgSurfaceStable::ack_configure(uint32_t serial)
 {
-    (void)serial;
-    // TODO
+    if (auto& role = window_role())
+        role.value()->configure_acked(serial);
 }
 
-void mf::XdgSurfaceStable::send_configure()
+auto mf::XdgSurfaceStable::send_configure() -> uint32_t
 {
     auto const serial = wl_display_next_serial(wl_client_get_display(wayland::XdgSurface::client));
     xdg_surface_send_configure(resource, serial);
+    return serial;
 }
 
 std::experimental::optional<mf::WindowWlSurfaceRole*> const& mf::XdgSurfaceStable::window_role()
@@ -323,7 +324,7 @@ mf::XdgToplevelStable::XdgToplevelStable(struct wl_client* client, struct wl_res
     wl_array_init(&states);
     xdg_toplevel_send_configure(resource, 0, 0, &states);
     wl_array_release(&states);
-    xdg_surface->send_configure();
+    configure_sent(xdg_surface->send_configure());
 }
 
 void mf::XdgToplevelStable::destroy()
@@ -449,9 +450,13 @@ void mf::XdgToplevelStable::set_minimized()
     set_state_now(mir_window_state_minimized);
 }
 
-void mf::XdgToplevelStable::handle_resize(std::experimental::optional<geometry::Point> const& /*new_top_left*/,
+void mf::XdgToplevelStable::handle_resize(std::experimental::optional<geometry::Point> const& new_top_left,
                                           geometry::Size const& new_size)
 {
+    // Don't flood a client that is still catching up: only the latest size matters
+    if (hold_configure(new_top_left, new_size))
+        return;
+
     wl_array states;
     wl_array_init(&states);
 
@@ -482,7 +487,7 @@ void mf::XdgToplevelStable::handle_resize(std::experimental::optional<geometry::
     xdg_toplevel_send_configure(resource, new_size.width.as_int(), new_size.height.as_int(), &states);
     wl_array_release(&states);
 
-    xdg_surface->send_configure();
+    configure_sent(xdg_surface->send_configure());
 }
 
 mf::XdgToplevelStable* mf::XdgToplevelStable::from(wl_resource* surface)
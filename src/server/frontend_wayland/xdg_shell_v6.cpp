@@ -46,7 +46,7 @@ public:
     void set_window_geometry(int32_t x, int32_t y, int32_t width, int32_t height) override;
     void ack_configure(uint32_t serial) override;
 
-    void send_configure();
+    auto send_configure() -> uint32_t;
 
     std::experimental::optional<WindowWlSurfaceRole*> const& window_role();
 
@@ -207,14 +207,15 @@ void mf::XdgSurfaceV6::set_window_geometry(int32_t x, int32_t y, int32_t width,
 
 void mf::XdgSurfaceV6::ack_configure(uint32_t serial)
 {
-    (void)serial;
-    // TODO
+    if (auto& role = window_role())
+        role.value()->configure_acked(serial);
 }
 
-void mf::XdgSurfaceV6::send_configure()
+auto mf::XdgSurfaceV6::send_configure() -> uint32_t
 {
     auto const serial = wl_display_next_serial(wl_client_get_display(wayland::XdgSurfaceV6::client));
     zxdg_surface_v6_send_configure(resource, serial);
+    return serial;
 }
 
 std::experimental::optional<mf::WindowWlSurfaceRole*> const& mf::XdgSurfaceV6::window_role()
@@ -309,7 +310,7 @@ mf::XdgToplevelV6::XdgToplevelV6(struct wl_client* client, struct wl_resource* r
     wl_array_init(&states);
     zxdg_toplevel_v6_send_configure(resource, 0, 0, &states);
     wl_array_release(&states);
-    xdg_surface->send_configure();
+    configure_sent(xdg_surface->send_configure());
 }
 
 void mf::XdgToplevelV6::destroy()
@@ -435,9 +436,13 @@ void mf::XdgToplevelV6::set_minimized()
     set_state_now(mir_window_state_minimized);
 }
 
-void mf::XdgToplevelV6::handle_resize(std::experimental::optional<geometry::Point> const& /*new_top_left*/,
+void mf::XdgToplevelV6::handle_resize(std::experimental::optional<geometry::Point> const& new_top_left,
                        geometry::Size const& new_size)
 {
+    // Don't flood a client that is still catching up: only the latest size matters
+    if (hold_configure(new_top_left, new_size))
+        return;
+
     wl_array states;
     wl_array_init(&states);
 
@@ -468,7 +473,7 @@ void mf::XdgToplevelV6::handle_resize(std::experimental::optional<geometry::Poin
     zxdg_toplevel_v6_send_configure(resource, new_size.width.as_int(), new_size.height.as_int(), &states);
     wl_array_release(&states);
 
-    xdg_surface->send_configure();
+    configure_sent(xdg_surface->send_configure());
 }
 
 mf::XdgToplevelV6* mf::XdgToplevelV6::from(wl_resource* surface)
@@ -35,33 +35,32 @@ class AlarmImpl : public mir::time::Alarm
 {
 public:
     AlarmImpl(
-        GMainContext* main_context,
+        std::shared_ptr<mir::detail::AlarmTimers> const& timers,
         std::shared_ptr<mir::time::Clock> const& clock,
         std::unique_ptr<mir::LockableCallback>&& callback,
         std::function<void()> const& exception_handler)
-        : main_context{g_main_context_ref(main_context)},
+        : timers{timers},
           clock{clock},
           state_{State::cancelled},
-          exception_handler{exception_handler},
-          wrapped_callback{std::make_shared<mir::LockableCallbackWrapper>(
-              std::move(callback), [this] { state_ = State::triggered; })}
+          timer{std::make_shared<mir::detail::AlarmTimers::Timer>(
+              std::make_shared<mir::LockableCallbackWrapper>(
+                  std::move(callback), [this] { state_ = State::triggered; }),
+              exception_handler)}
     {
     }
 
     ~AlarmImpl() override
     {
-        gsource.ensure_no_further_dispatch();
-        g_main_context_unref(main_context);
+        timers->ensure_no_further_dispatch(*timer);
     }
 
     bool cancel() override
     {
         std::lock_guard<std::mutex> lock{alarm_mutex};
 
-        gsource.ensure_no_further_dispatch();
+        timers->ensure_no_further_dispatch(*timer);
         if (state_ ==  State::pending)
         {
-            gsource = mir::detail::GSourceHandle{};
             state_ = State::cancelled;
         }
         return state_ == State::cancelled;
@@ -84,24 +83,17 @@ public:
 
         auto old_state = state_;
         state_ = State::pending;
-        gsource = mir::detail::add_timer_gsource(
-            main_context,
-            clock,
-            wrapped_callback,
-            exception_handler,
-            time_point);
+        timers->schedule(*timer, time_point);
 
         return old_state == State::pending;
     }
 
 private:
     mutable std::mutex alarm_mutex;
-    GMainContext* main_context;
+    std::shared_ptr<mir::detail::AlarmTimers> const timers;
     std::shared_ptr<mir::time::Clock> const clock;
     State state_;
-    std::function<void()> exception_handler;
-    std::shared_ptr<mir::LockableCallback> wrapped_callback;
-    mir::detail::GSourceHandle gsource;
+    std::shared_ptr<mir::detail::AlarmTimers::Timer> const timer;
 };
 
 }
@@ -131,6 +123,7 @@ mir::GLibMainLoop::GLibMainLoop(
       running_{false},
       fd_sources{main_context},
       signal_sources{fd_sources},
+      alarm_timers{std::make_shared<detail::AlarmTimers>(main_context, clock)},
       before_iteration_hook{[]{}}
 {
 }
@@ -351,7 +344,7 @@ std::unique_ptr<mir::time::Alarm> mir::GLibMainLoop::create_alarm(
         };
 
     return std::make_unique<AlarmImpl>(
-        main_context, clock, std::move(callback), exception_hander);
+        alarm_timers, clock, std::move(callback), exception_hander);
 }
 
 void mir::GLibMainLoop::reprocess_all_sources()
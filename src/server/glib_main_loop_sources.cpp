@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <limits>
 #include <system_error>
 #include <sstream>
 
@@ -253,118 +254,196 @@ void md::add_server_action_gsource(
     g_source_attach(gsource, main_context);
 }
 
-md::GSourceHandle md::add_timer_gsource(
-    GMainContext* main_context,
-    std::shared_ptr<time::Clock> const& clock,
-    std::shared_ptr<LockableCallback> const& handler,
-    std::function<void()> const& exception_handler,
-    time::Timestamp target_time)
+/***************
+ * AlarmTimers *
+ ***************/
+
+struct md::AlarmTimers::TimerGSource
 {
-    struct TimerContext
+    GSource gsource;
+    AlarmTimers* timers;
+
+    static gboolean prepare(GSource* source, gint* timeout)
     {
-        TimerContext(std::shared_ptr<time::Clock> const& clock,
-                     std::shared_ptr<LockableCallback> const& handler,
-                     std::function<void()> const& exception_handler,
-                     time::Timestamp target_time)
-            : clock{clock}, handler{handler}, exception_handler{exception_handler},
-              target_time{target_time}, enabled{true}
+        auto const timers = reinterpret_cast<TimerGSource*>(source)->timers;
+
+        std::lock_guard<decltype(timers->mutex)> lock{timers->mutex};
+
+        if (timers->advance())
         {
+            *timeout = -1;
+            return TRUE;
         }
-        std::shared_ptr<time::Clock> clock;
-        std::shared_ptr<LockableCallback> handler;
-        std::function<void()> exception_handler;
-        time::Timestamp target_time;
-        std::recursive_mutex mutex;
-        bool enabled;
-    };
 
-    struct TimerGSource
+        *timeout = timers->timeout_for_next_expiry();
+        return FALSE;
+    }
+
+    static gboolean check(GSource* source)
     {
-        GSource gsource;
-        TimerContext ctx;
-        bool ctx_constructed;
+        auto const timers = reinterpret_cast<TimerGSource*>(source)->timers;
 
-        static gboolean prepare(GSource* source, gint *timeout)
-        {
-            auto const& ctx = reinterpret_cast<TimerGSource*>(source)->ctx;
+        std::lock_guard<decltype(timers->mutex)> lock{timers->mutex};
+        return timers->advance();
+    }
 
-            auto const now = ctx.clock->now();
-            bool const ready = (now >= ctx.target_time);
-            if (ready)
-                *timeout = -1;
-            else
-                *timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
-                    ctx.clock->min_wait_until(ctx.target_time)).count();
+    static gboolean dispatch(GSource* source, GSourceFunc, gpointer)
+    {
+        reinterpret_cast<TimerGSource*>(source)->timers->dispatch();
+        return G_SOURCE_CONTINUE;
+    }
+};
 
-            return ready;
-        }
+md::AlarmTimers::Timer::Timer(
+    std::shared_ptr<LockableCallback> const& handler,
+    std::function<void()> const& exception_handler)
+    : handler{handler},
+      exception_handler{exception_handler},
+      generation{0}
+{
+}
 
-        static gboolean check(GSource* source)
-        {
-            auto const& ctx = reinterpret_cast<TimerGSource*>(source)->ctx;
+md::AlarmTimers::AlarmTimers(GMainContext* main_context, std::shared_ptr<time::Clock> const& clock)
+    : main_context{g_main_context_ref(main_context)},
+      clock{clock},
+      epoch{clock->now()},
+      gsource{[this]
+          {
+              static GSourceFuncs gsource_funcs{
+                  TimerGSource::prepare,
+                  TimerGSource::check,
+                  TimerGSource::dispatch,
+                  nullptr,
+                  nullptr,
+                  nullptr
+              };
+
+              auto const gsource = g_source_new(&gsource_funcs, sizeof(TimerGSource));
+              reinterpret_cast<TimerGSource*>(gsource)->timers = this;
+              return gsource;
+          }()}
+{
+    g_source_attach(gsource, this->main_context);
+}
 
-            auto const now = ctx.clock->now();
-            bool const ready = (now >= ctx.target_time);
-            return ready;
-        }
+md::AlarmTimers::~AlarmTimers()
+{
+    g_source_destroy(gsource);
+    g_source_unref(gsource);
+    g_main_context_unref(main_context);
+}
 
-        static gboolean dispatch(GSource* source, GSourceFunc, gpointer)
-        {
-            auto& ctx = reinterpret_cast<TimerGSource*>(source)->ctx;
-            try
-            {
-                // Attempt to preserve locking order during callback dispatching
-                // so we acquire the caller's lock before our own.
-                auto& handler = *ctx.handler;
-                std::lock_guard<LockableCallback> handler_lock{handler};
-                std::lock_guard<decltype(ctx.mutex)> lock{ctx.mutex};
-                if (ctx.enabled)
-                    handler();
-            }
-            catch(...)
-            {
-                ctx.exception_handler();
-            }
+void md::AlarmTimers::schedule(Timer& timer, time::Timestamp target_time)
+{
+    auto const tick = tick_for(target_time);
 
-            return FALSE;
-        }
+    std::lock_guard<decltype(mutex)> lock{mutex};
 
-        static void finalize(GSource* source)
-        {
-            auto const timer_gsource = reinterpret_cast<TimerGSource*>(source);
-            if (timer_gsource->ctx_constructed)
-                timer_gsource->ctx.~TimerContext();
-        }
+    auto const previous_expiry = wheel.next_expiry();
 
-        static void disable(GSource* source)
-        {
-            auto& ctx = reinterpret_cast<TimerGSource*>(source)->ctx;
-            std::lock_guard<decltype(ctx.mutex)> lock{ctx.mutex};
-            ctx.enabled = false;
-        }
-    };
+    ++timer.generation;
+    wheel.schedule(timer, tick);
 
-    static GSourceFuncs gsource_funcs{
-        TimerGSource::prepare,
-        TimerGSource::check,
-        TimerGSource::dispatch,
-        TimerGSource::finalize,
-        nullptr,
-        nullptr
-    };
+    // Only disturb the main loop if it's waiting for a later deadline
+    if (!previous_expiry || tick < previous_expiry.value())
+        g_main_context_wakeup(main_context);
+}
 
-    GSourceHandle gsource{
-        g_source_new(&gsource_funcs, sizeof(TimerGSource)),
-        [](GSource* gsource) { TimerGSource::disable(gsource); }};
-    auto const timer_gsource = reinterpret_cast<TimerGSource*>(static_cast<GSource*>(gsource));
+void md::AlarmTimers::ensure_no_further_dispatch(Timer& timer)
+{
+    {
+        std::lock_guard<decltype(mutex)> lock{mutex};
+        ++timer.generation;
+        wheel.cancel(timer);
+    }
 
-    timer_gsource->ctx_constructed = false;
-    new (&timer_gsource->ctx) TimerContext{clock, handler, exception_handler, target_time};
-    timer_gsource->ctx_constructed = true;
+    // Wait for a dispatch already in progress (unless it is on this thread)
+    std::lock_guard<decltype(timer.dispatch_mutex)> wait_for_dispatch{timer.dispatch_mutex};
+}
 
-    g_source_attach(gsource, main_context);
+auto md::AlarmTimers::tick_for(time::Timestamp time_point) const -> TimerWheel::Tick
+{
+    if (time_point <= epoch)
+        return 0;
 
-    return gsource;
+    // Round up so that a timer never fires before its target time
+    auto const since_epoch = time_point - epoch;
+    auto ticks = std::chrono::duration_cast<std::chrono::milliseconds>(since_epoch);
+    if (ticks < since_epoch)
+        ++ticks;
+
+    return ticks.count();
+}
+
+auto md::AlarmTimers::current_tick() const -> TimerWheel::Tick
+{
+    auto const now = clock->now();
+
+    if (now <= epoch)
+        return 0;
+
+    return std::chrono::duration_cast<std::chrono::milliseconds>(now - epoch).count();
+}
+
+bool md::AlarmTimers::advance()
+{
+    wheel.advance_to(current_tick(), expired);
+
+    for (auto const timer : expired)
+    {
+        // A timer is only in the wheel while its owner holds a reference
+        auto const alarm_timer = static_cast<Timer*>(timer);
+        due.push_back({alarm_timer->shared_from_this(), alarm_timer->generation});
+    }
+    expired.clear();
+
+    return !due.empty();
+}
+
+int md::AlarmTimers::timeout_for_next_expiry() const
+{
+    auto const next_expiry = wheel.next_expiry();
+
+    if (!next_expiry)
+        return -1;
+
+    auto const wait = clock->min_wait_until(epoch + std::chrono::milliseconds{next_expiry.value()});
+    auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(wait);
+    if (timeout < wait)
+        ++timeout;
+
+    return std::max<int64_t>(0, std::min<int64_t>(timeout.count(), std::numeric_limits<gint>::max()));
+}
+
+void md::AlarmTimers::dispatch()
+{
+    {
+        std::lock_guard<decltype(mutex)> lock{mutex};
+        std::swap(due, dispatching);
+    }
+
+    for (auto const& next : dispatching)
+    {
+        auto& timer = *next.timer;
+        try
+        {
+            // Attempt to preserve locking order during callback dispatching
+            // so we acquire the caller's lock before our own.
+            auto& handler = *timer.handler;
+            std::lock_guard<LockableCallback> handler_lock{handler};
+            std::lock_guard<decltype(timer.dispatch_mutex)> lock{timer.dispatch_mutex};
+
+            // Skip timers that have been rescheduled or cancelled since they fell due
+            if (timer.generation == next.generation)
+                handler();
+        }
+        catch(...)
+        {
+            timer.exception_handler();
+        }
+    }
+
+    dispatching.clear();
 }
 
 /*************
@@ -38,6 +38,7 @@
 
 #include "mir/shared_library.h"
 #include "mir/shared_library_prober.h"
+#include "mir/probe_cache.h"
 #include "mir/abnormal_exit.h"
 #include "mir/emergency_cleanup.h"
 #include "mir/log.h"
@@ -104,13 +105,16 @@ std::shared_ptr<mg::Platform> mir::DefaultServerConfiguration::the_graphics_plat
                 else
                 {
                     auto const& path = the_options()->get<std::string>(options::platform_path);
-                    auto platforms = mir::libraries_for_path(path, *the_shared_library_prober_report());
-                    if (platforms.empty())
-                    {
-                        auto msg = "Failed to find any platform plugins in: " + path;
-                        throw std::runtime_error(msg.c_str());
-                    }
-                    platform_library = mir::graphics::module_for_device(platforms, dynamic_cast<mir::options::ProgramOption&>(*the_options()), the_console_services());
+                    mir::ProbeCache const probe_cache{
+                        the_options()->get<bool>(options::platform_probe_cache_opt) ?
+                            mir::probe_cache_file("graphics-platform") : ""};
+
+                    platform_library = mir::graphics::module_for_device(
+                        path,
+                        probe_cache,
+                        dynamic_cast<mir::options::ProgramOption&>(*the_options()),
+                        the_console_services(),
+                        *the_shared_library_prober_report());
                 }
                 auto create_host_platform =
                     [platform_library]() -> std::function<std::remove_pointer<mg::CreateHostPlatform>::type>
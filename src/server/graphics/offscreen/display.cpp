@@ -63,8 +63,8 @@ void mgo::detail::EGLDisplayHandle::initialize()
     if (eglInitialize(egl_display, &major, &minor) == EGL_FALSE)
         BOOST_THROW_EXCEPTION(mg::egl_error("Failed to initialize EGL"));
 
-    if ((major != 1) || (minor != 4))
-        BOOST_THROW_EXCEPTION(std::runtime_error("EGL version 1.4 needed"));
+    if ((major < 1) || (major == 1 && minor < 4))
+        BOOST_THROW_EXCEPTION(std::runtime_error("EGL version 1.4 or later needed"));
 }
 
 mgo::detail::EGLDisplayHandle::~EGLDisplayHandle() noexcept
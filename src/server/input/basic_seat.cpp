@@ -177,6 +177,11 @@ void mi::BasicSeat::dispatch_event(std::shared_ptr<MirEvent> const& event)
     input_state_tracker.dispatch(event);
 }
 
+void mi::BasicSeat::dispatch_events(std::vector<std::shared_ptr<MirEvent>> const& events)
+{
+    input_state_tracker.dispatch(events);
+}
+
 geom::Rectangle mi::BasicSeat::bounding_rectangle() const
 {
     return output_tracker->get_bounding_rectangle();
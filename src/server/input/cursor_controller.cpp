@@ -168,6 +168,14 @@ struct UpdateCursorOnSceneChanges : ms::Observer
         surface_observers.clear();
     }
 
+    void transaction_begun()
+    {
+    }
+
+    void transaction_ended()
+    {
+    }
+
 private:
     mi::CursorController* const cursor_controller;
 
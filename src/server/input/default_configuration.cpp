@@ -19,6 +19,7 @@
 #include "mir/default_server_configuration.h"
 
 #include "key_repeat_dispatcher.h"
+#include "touch_resampling_dispatcher.h"
 #include "event_filter_chain_dispatcher.h"
 #include "config_changer.h"
 #include "cursor_controller.h"
@@ -38,6 +39,7 @@
 #include "mir/input/input_probe.h"
 #include "mir/input/platform.h"
 #include "mir/input/xkb_mapper.h"
+#include "mir/input/device.h"
 #include "mir/options/configuration.h"
 #include "mir/options/option.h"
 #include "mir/dispatch/multiplexing_dispatchable.h"
@@ -52,6 +54,9 @@
 
 #include "mir_toolkit/cursors.h"
 
+#include <cstring>
+#include <set>
+
 namespace mi = mir::input;
 namespace mr = mir::report;
 namespace ms = mir::scene;
@@ -81,6 +86,39 @@ mir::DefaultServerConfiguration::the_event_filter_chain_dispatcher()
         });
 }
 
+std::shared_ptr<mi::TouchResamplingDispatcher>
+mir::DefaultServerConfiguration::the_touch_resampling_dispatcher()
+{
+    return touch_resampling_dispatcher(
+        [this]()
+        {
+            std::chrono::milliseconds const resample_latency{5};
+            std::chrono::milliseconds const max_prediction{8};
+
+            std::set<std::string> names;
+            auto const options = the_options();
+            if (options->is_set(options::touch_resampling_opt))
+            {
+                auto const value = options->get<std::string>(options::touch_resampling_opt) + ',';
+
+                for (char const* start = value.c_str(); char const* end = strchr(start, ','); start = end+1)
+                {
+                    if (start != end)
+                        names.insert(std::string{start, end});
+                }
+            }
+
+            auto const resample_device = [names](mi::Device const& device)
+                {
+                    return names.count("all") || names.count(device.name());
+                };
+
+            return std::make_shared<mi::TouchResamplingDispatcher>(
+                the_event_filter_chain_dispatcher(), the_main_loop(), the_display(),
+                resample_device, resample_latency, max_prediction);
+        });
+}
+
 std::shared_ptr<msh::InputTargeter>
 mir::DefaultServerConfiguration::the_input_targeter()
 {
@@ -119,8 +157,12 @@ mir::DefaultServerConfiguration::the_input_dispatcher()
             auto enable_repeat = options->get<bool>(options::enable_key_repeat_opt) &&
                 !options->is_set(options::host_socket_opt);
 
+            std::shared_ptr<mi::InputDispatcher> next_dispatcher = the_event_filter_chain_dispatcher();
+            if (options->is_set(options::touch_resampling_opt))
+                next_dispatcher = the_touch_resampling_dispatcher();
+
             return std::make_shared<mi::KeyRepeatDispatcher>(
-                the_event_filter_chain_dispatcher(), the_main_loop(), the_cookie_authority(),
+                next_dispatcher, the_main_loop(), the_cookie_authority(),
                 enable_repeat, key_repeat_timeout, key_repeat_delay, false);
         });
 }
@@ -304,6 +346,10 @@ std::shared_ptr<mi::DefaultInputDeviceHub> mir::DefaultServerConfiguration::the_
            // pressed keys get repeated indefinitely
            if (key_repeater)
                key_repeater->set_input_device_hub(hub);
+
+           // Touchscreens are selected for resampling by name as they are added
+           if (the_options()->is_set(options::touch_resampling_opt))
+               the_touch_resampling_dispatcher()->set_input_device_hub(hub);
            return hub;
        });
 }
@@ -37,6 +37,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <memory>
 
 namespace mi = mir::input;
@@ -277,13 +278,21 @@ MirInputDeviceId mi::DefaultInputDeviceHub::RegisteredDevice::id()
     return device_id;
 }
 
-void mi::DefaultInputDeviceHub::RegisteredDevice::handle_input(std::shared_ptr<MirEvent> const& event)
+namespace
+{
+void check_device_event(MirEvent const& event)
 {
-    auto type = mir_event_get_type(event.get());
+    auto type = mir_event_get_type(&event);
 
     if (type != mir_event_type_input &&
         type != mir_event_type_input_device_state)
         BOOST_THROW_EXCEPTION(std::invalid_argument("Invalid input event received from device"));
+}
+}
+
+void mi::DefaultInputDeviceHub::RegisteredDevice::handle_input(std::shared_ptr<MirEvent> const& event)
+{
+    check_device_event(*event);
 
     if (!seat)
         return;
@@ -291,6 +300,17 @@ void mi::DefaultInputDeviceHub::RegisteredDevice::handle_input(std::shared_ptr<M
     seat->dispatch_event(event);
 }
 
+void mi::DefaultInputDeviceHub::RegisteredDevice::handle_input_frame(std::vector<std::shared_ptr<MirEvent>> const& events)
+{
+    for (auto const& event : events)
+        check_device_event(*event);
+
+    if (!seat)
+        return;
+
+    seat->dispatch_events(events);
+}
+
 bool mi::DefaultInputDeviceHub::RegisteredDevice::device_matches(std::shared_ptr<InputDevice> const& dev) const
 {
     return dev == device;
@@ -24,9 +24,11 @@
 
 #include "mir/shared_library_prober.h"
 #include "mir/shared_library.h"
+#include "mir/probe_cache.h"
 #include "mir/log.h"
 #include "mir/libname.h"
 
+#include <cstdlib>
 #include <stdexcept>
 
 namespace mi = mir::input;
@@ -96,7 +98,50 @@ mir::UniqueModulePtr<mi::Platform> mi::probe_input_platforms(
     }
     else
     {
-        select_libraries_for_path(options.get<std::string>(mo::platform_path), module_selector, prober_report);
+        auto const path = options.get<std::string>(mo::platform_path);
+        auto const use_cache =
+            options.is_set(mo::platform_probe_cache_opt) && options.get<bool>(mo::platform_probe_cache_opt);
+        mir::ProbeCache const cache{use_cache ? mir::probe_cache_file("input-platform") : ""};
+
+        // The platforms probe the input devices, and the X11 platform needs an X server
+        auto const x11_display = getenv("DISPLAY");
+        auto const key =
+            "input\n" + mir::library_fingerprint(path) + mir::device_fingerprint("input") +
+            "DISPLAY=" + (x11_display ? x11_display : "") +
+            "\nhost-socket=" + (options.is_set(mo::host_socket_opt) ? "set" : "unset");
+
+        auto const cached = cache.lookup(key, path);
+        if (!cached.empty())
+        {
+            try
+            {
+                prober_report.loading_library(cached);
+                module_selector(std::make_shared<mir::SharedLibrary>(cached));
+            }
+            catch (std::runtime_error const& error)
+            {
+                prober_report.loading_failed(cached, error);
+            }
+        }
+
+        if (!platform_module)
+        {
+            std::string chosen;
+
+            select_named_libraries_for_path(
+                path,
+                [&](std::string const& filename, std::shared_ptr<mir::SharedLibrary> const& module)
+                {
+                    auto const selection = module_selector(module);
+                    if (platform_module == module)
+                        chosen = filename;
+                    return selection;
+                },
+                prober_report);
+
+            if (!chosen.empty())
+                cache.store(key, chosen);
+        }
     }
 
     if (!platform_module)
@@ -90,25 +90,76 @@ void mi::SeatInputDeviceTracker::dispatch(std::shared_ptr<MirEvent> const& event
     if (mir_event_get_type(event.get()) == mir_event_type_input)
     {
         std::lock_guard<std::mutex> lock(device_state_mutex);
+        PendingNotifications pending;
 
-        auto input_event = mir_event_get_input_event(event.get());
+        auto const accepted = update_seat_state(*event, pending);
+        notify(pending);
 
-        if (filter_input_event(input_event))
+        if (!accepted)
             return;
+    }
+
+    dispatcher->dispatch(event);
+    observer->seat_dispatch_event(event);
+}
 
-        update_seat_properties(input_event);
+void mi::SeatInputDeviceTracker::dispatch(std::vector<std::shared_ptr<MirEvent>> const& events)
+{
+    std::vector<std::shared_ptr<MirEvent> const*> accepted;
+    accepted.reserve(events.size());
 
-        key_mapper->map_event(*event);
+    {
+        // The whole frame is applied under one lock, and listeners hear about the
+        // resulting cursor position and touch spots once rather than per event
+        std::lock_guard<std::mutex> lock(device_state_mutex);
+        PendingNotifications pending;
 
-        if (mir_input_event_type_pointer == mir_input_event_get_type(input_event))
+        for (auto const& event : events)
         {
-            mev::set_cursor_position(*event, cursor_x, cursor_y);
-            mev::set_button_state(*event, buttons);
+            if (mir_event_get_type(event.get()) != mir_event_type_input ||
+                update_seat_state(*event, pending))
+            {
+                accepted.push_back(&event);
+            }
         }
+
+        notify(pending);
     }
 
-    dispatcher->dispatch(event);
-    observer->seat_dispatch_event(event);
+    for (auto const event : accepted)
+    {
+        dispatcher->dispatch(*event);
+        observer->seat_dispatch_event(*event);
+    }
+}
+
+bool mi::SeatInputDeviceTracker::update_seat_state(MirEvent& event, PendingNotifications& pending)
+{
+    auto input_event = mir_event_get_input_event(&event);
+
+    if (filter_input_event(input_event))
+        return false;
+
+    update_seat_properties(input_event, pending);
+
+    key_mapper->map_event(event);
+
+    if (mir_input_event_type_pointer == mir_input_event_get_type(input_event))
+    {
+        mev::set_cursor_position(event, cursor_x, cursor_y);
+        mev::set_button_state(event, buttons);
+    }
+
+    return true;
+}
+
+void mi::SeatInputDeviceTracker::notify(PendingNotifications const& pending)
+{
+    if (pending.spots_changed)
+        update_spots();
+
+    if (pending.cursor_moved)
+        cursor_listener->cursor_moved_to(cursor_x, cursor_y);
 }
 
 bool mi::SeatInputDeviceTracker::filter_input_event(MirInputEvent const* event)
@@ -127,7 +178,7 @@ bool mi::SeatInputDeviceTracker::filter_input_event(MirInputEvent const* event)
     return false;
 }
 
-void mi::SeatInputDeviceTracker::update_seat_properties(MirInputEvent const* event)
+void mi::SeatInputDeviceTracker::update_seat_properties(MirInputEvent const* event, PendingNotifications& pending)
 {
     auto id = mir_input_event_get_device_id(event);
 
@@ -143,12 +194,13 @@ void mi::SeatInputDeviceTracker::update_seat_properties(MirInputEvent const* eve
         break;
     case mir_input_event_type_touch:
         if (stored_data->second.update_spots(mir_input_event_get_touch_event(event)))
-            update_spots();
+            pending.spots_changed = true;
         break;
     case mir_input_event_type_pointer:
         {
             auto const* pointer = mir_input_event_get_pointer_event(event);
             update_cursor(pointer);
+            pending.cursor_moved = true;
             if(stored_data->second.update_button_state(mir_pointer_event_buttons(pointer)))
                 update_states();
             break;
@@ -257,8 +309,6 @@ void mi::SeatInputDeviceTracker::update_cursor(MirPointerEvent const* event)
     cursor_y += mir_pointer_event_axis_value(event, mir_pointer_axis_relative_y);
 
     confine_pointer();
-
-    cursor_listener->cursor_moved_to(cursor_x, cursor_y);
 }
 
 mir::EventUPtr mi::SeatInputDeviceTracker::create_device_state() const
@@ -30,6 +30,7 @@
 #include <unordered_map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace mir
 {
@@ -65,6 +66,8 @@ public:
     void remove_device(MirInputDeviceId);
 
     void dispatch(std::shared_ptr<MirEvent> const& event);
+    /// Dispatches the events of a single device frame, updating seat state once for the lot
+    void dispatch(std::vector<std::shared_ptr<MirEvent>> const& events);
 
     MirPointerButtons button_state() const;
     geometry::Point cursor_position() const;
@@ -78,7 +81,15 @@ public:
 
     void update_outputs(geometry::Rectangles const& outputs);
 private:
-    void update_seat_properties(MirInputEvent const* event);
+    struct PendingNotifications
+    {
+        bool cursor_moved{false};
+        bool spots_changed{false};
+    };
+
+    bool update_seat_state(MirEvent& event, PendingNotifications& pending);
+    void notify(PendingNotifications const& pending);
+    void update_seat_properties(MirInputEvent const* event, PendingNotifications& pending);
     void update_cursor(MirPointerEvent const* event);
     void update_spots();
     void update_states();
@@ -75,6 +75,12 @@ struct InputDispatcherSceneObserver :
     void end_observation() override
     {
     }
+    void transaction_begun() override
+    {
+    }
+    void transaction_ended() override
+    {
+    }
 
     void attrib_changed(ms::Surface const*, MirWindowAttrib /*attrib*/, int /*value*/) override
     {
@@ -0,0 +1,184 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "touch_resampler.h"
+
+#include "mir/events/event_builders.h"
+#include "mir/events/event_private.h"
+
+#include <algorithm>
+
+namespace mi = mir::input;
+namespace mev = mir::events;
+
+namespace
+{
+// Enough to bracket any sample time a frame or so behind the newest sample
+std::size_t const max_samples_per_contact = 4;
+
+// Samples further apart than this say too little about the current velocity to extrapolate from
+std::chrono::nanoseconds const max_extrapolation_interval{std::chrono::milliseconds{20}};
+
+float lerp(float a, float b, float alpha)
+{
+    return a + alpha * (b - a);
+}
+}
+
+mi::TouchResampler::TouchResampler(std::chrono::nanoseconds max_prediction) :
+    max_prediction{max_prediction}
+{
+}
+
+bool mi::TouchResampler::hold(std::shared_ptr<MirEvent const> const& event)
+{
+    auto const input_event = mir_event_get_input_event(event.get());
+    auto const touch_event = mir_input_event_get_touch_event(input_event);
+    auto const time = std::chrono::nanoseconds{mir_input_event_get_event_time(input_event)};
+    auto& device = devices[mir_input_event_get_device_id(input_event)];
+
+    bool only_motion = true;
+
+    for (auto i = 0u; i != mir_touch_event_point_count(touch_event); ++i)
+    {
+        auto const id = mir_touch_event_id(touch_event, i);
+        auto const action = mir_touch_event_action(touch_event, i);
+
+        if (action != mir_touch_action_change)
+        {
+            only_motion = false;
+            device.contacts.erase(id);
+            if (action == mir_touch_action_up)
+                continue;
+        }
+
+        auto& samples = device.contacts[id];
+        if (!samples.empty() && samples.back().time >= time)
+            samples.clear();
+
+        samples.push_back({
+            time,
+            mir_touch_event_axis_value(touch_event, i, mir_touch_axis_x),
+            mir_touch_event_axis_value(touch_event, i, mir_touch_axis_y)});
+
+        if (samples.size() > max_samples_per_contact)
+            samples.pop_front();
+    }
+
+    if (only_motion)
+    {
+        device.held = event;
+    }
+    else
+    {
+        device.held.reset();
+        device.last_delivered = std::max(device.last_delivered, time);
+    }
+
+    return only_motion;
+}
+
+std::shared_ptr<MirEvent> mi::TouchResampler::resample(MirInputDeviceId id, std::chrono::nanoseconds sample_time)
+{
+    auto const found = devices.find(id);
+    if (found == devices.end() || !found->second.held)
+        return nullptr;
+
+    auto& device = found->second;
+    std::shared_ptr<MirEvent> const result{mev::clone_event(*device.held)};
+
+    auto const touch_event = result->to_input()->to_touch();
+    auto event_time = device.last_delivered;
+    auto caught_up = true;
+
+    for (auto i = 0u; i != touch_event->pointer_count(); ++i)
+    {
+        auto const contact = device.contacts.find(touch_event->id(i));
+        if (contact == device.contacts.end() || contact->second.empty())
+            continue;
+
+        float x, y;
+        event_time = std::max(event_time, position_at(contact->second, sample_time, x, y));
+        touch_event->set_x(i, x);
+        touch_event->set_y(i, y);
+
+        if (sample_time < contact->second.back().time)
+            caught_up = false;
+    }
+
+    touch_event->set_event_time(event_time);
+    device.last_delivered = event_time;
+
+    if (caught_up)
+        device.held.reset();
+
+    return result;
+}
+
+bool mi::TouchResampler::holds_motion(MirInputDeviceId id) const
+{
+    auto const found = devices.find(id);
+    return found != devices.end() && found->second.held;
+}
+
+void mi::TouchResampler::forget_device(MirInputDeviceId id)
+{
+    devices.erase(id);
+}
+
+std::chrono::nanoseconds mi::TouchResampler::position_at(
+    std::deque<Sample> const& samples, std::chrono::nanoseconds time, float& x, float& y) const
+{
+    auto const after = std::find_if(begin(samples), end(samples),
+        [time](Sample const& sample) { return sample.time >= time; });
+
+    if (after == begin(samples))
+    {
+        // Older than anything recorded: the best we know is the oldest sample
+        x = after->x;
+        y = after->y;
+        return after->time;
+    }
+
+    if (after != end(samples))
+    {
+        auto const before = after - 1;
+        auto const alpha = float((time - before->time).count()) / (after->time - before->time).count();
+        x = lerp(before->x, after->x, alpha);
+        y = lerp(before->y, after->y, alpha);
+        return time;
+    }
+
+    auto const& newest = samples.back();
+    x = newest.x;
+    y = newest.y;
+
+    if (samples.size() < 2)
+        return newest.time;
+
+    auto const& previous = samples[samples.size() - 2];
+    auto const interval = newest.time - previous.time;
+    if (interval > max_extrapolation_interval)
+        return newest.time;
+
+    // Predicting further than half a sample interval ahead overshoots on every change of direction
+    auto const limit = newest.time + std::min(max_prediction, interval / 2);
+    auto const predicted_time = std::min(time, limit);
+    auto const alpha = float((predicted_time - previous.time).count()) / interval.count();
+    x = lerp(previous.x, newest.x, alpha);
+    y = lerp(previous.y, newest.y, alpha);
+    return predicted_time;
+}
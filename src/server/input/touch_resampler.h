@@ -0,0 +1,93 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_INPUT_TOUCH_RESAMPLER_H_
+#define MIR_INPUT_TOUCH_RESAMPLER_H_
+
+#include "mir_toolkit/event.h"
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+namespace mir
+{
+namespace input
+{
+/**
+ * Resamples touch motion to a chosen point in time
+ *
+ * Touch events that only move existing contacts are held back; resample()
+ * then produces a single motion event with each contact placed where it was
+ * at the requested time, interpolated between the recorded samples or, if
+ * the time lies beyond the newest sample, extrapolated by at most
+ * max_prediction. Events that add or remove contacts are never held back.
+ *
+ * \note TouchResampler is not threadsafe; callers must provide their own locking.
+ */
+class TouchResampler
+{
+public:
+    explicit TouchResampler(std::chrono::nanoseconds max_prediction);
+
+    /**
+     * Records the contacts of a touch event
+     *
+     * \returns true if the event has been held back for resampling, or false if
+     *          it must be delivered as it is (any motion held back for the
+     *          device is superseded by it)
+     */
+    bool hold(std::shared_ptr<MirEvent const> const& event);
+
+    /**
+     * The motion held back for the device resampled to sample_time, or nullptr if there is none
+     *
+     * The motion stays held until sample_time reaches its newest sample, so that
+     * later frames can catch up with where the contacts came to rest.
+     */
+    std::shared_ptr<MirEvent> resample(MirInputDeviceId id, std::chrono::nanoseconds sample_time);
+
+    /// Whether resample() has motion to deliver for the device
+    bool holds_motion(MirInputDeviceId id) const;
+
+    void forget_device(MirInputDeviceId id);
+
+private:
+    struct Sample
+    {
+        std::chrono::nanoseconds time;
+        float x;
+        float y;
+    };
+
+    struct DeviceState
+    {
+        std::unordered_map<MirTouchId, std::deque<Sample>> contacts;
+        std::shared_ptr<MirEvent const> held;
+        std::chrono::nanoseconds last_delivered{0};
+    };
+
+    std::chrono::nanoseconds position_at(std::deque<Sample> const& samples, std::chrono::nanoseconds time,
+        float& x, float& y) const;
+
+    std::chrono::nanoseconds const max_prediction;
+    std::unordered_map<MirInputDeviceId, DeviceState> devices;
+};
+}
+}
+
+#endif /* MIR_INPUT_TOUCH_RESAMPLER_H_ */
@@ -0,0 +1,267 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "touch_resampling_dispatcher.h"
+
+#include "mir/input/device.h"
+#include "mir/input/input_device_hub.h"
+#include "mir/input/input_device_observer.h"
+#include "mir/input/mir_touchscreen_config.h"
+#include "mir/graphics/display.h"
+#include "mir/graphics/display_configuration.h"
+#include "mir/time/alarm_factory.h"
+#include "mir/time/alarm.h"
+
+#include <vector>
+
+namespace mi = mir::input;
+namespace mg = mir::graphics;
+
+namespace
+{
+// Used until an output has presented two frames we can measure
+std::chrono::nanoseconds const default_frame_period{16666667};
+
+struct ResamplingDeviceObserver : mi::InputDeviceObserver
+{
+    ResamplingDeviceObserver(
+        mi::TouchResamplingDispatcher* dispatcher,
+        mi::TouchResamplingDispatcher::DeviceFilter const& resample_device) :
+        dispatcher{dispatcher},
+        resample_device{resample_device}
+    {
+    }
+
+    void device_added(std::shared_ptr<mi::Device> const& device) override
+    {
+        if (!contains(device->capabilities(), mi::DeviceCapability::touchscreen) || !resample_device(*device))
+            return;
+
+        auto const config = device->touchscreen_configuration();
+        dispatcher->enable_device(device->id(), config.is_set() ? config.value().output_id() : 0);
+    }
+
+    void device_changed(std::shared_ptr<mi::Device> const& device) override
+    {
+        // The touchscreen may have been mapped to another output
+        device_added(device);
+    }
+
+    void device_removed(std::shared_ptr<mi::Device> const& device) override
+    {
+        dispatcher->remove_device(device->id());
+    }
+
+    void changes_complete() override
+    {
+    }
+
+    mi::TouchResamplingDispatcher* const dispatcher;
+    mi::TouchResamplingDispatcher::DeviceFilter const resample_device;
+};
+
+unsigned first_active_output(mg::Display& display)
+{
+    std::unique_ptr<mg::DisplayConfiguration const> const conf = display.configuration();
+    unsigned result = 0;
+
+    conf->for_each_output(
+        [&result](mg::DisplayConfigurationOutput const& output)
+        {
+            if (!result && output.used && output.connected)
+                result = output.id.as_value();
+        });
+
+    return result;
+}
+
+mir::time::Timestamp to_timestamp(std::chrono::nanoseconds monotonic_time)
+{
+    return mir::time::Timestamp{std::chrono::duration_cast<mir::time::Duration>(monotonic_time)};
+}
+}
+
+mi::TouchResamplingDispatcher::TouchResamplingDispatcher(
+    std::shared_ptr<InputDispatcher> const& next_dispatcher,
+    std::shared_ptr<time::AlarmFactory> const& alarm_factory,
+    std::shared_ptr<graphics::Display> const& display,
+    DeviceFilter const& resample_device,
+    std::chrono::nanoseconds resample_latency,
+    std::chrono::nanoseconds max_prediction) :
+    next_dispatcher{next_dispatcher},
+    alarm_factory{alarm_factory},
+    display{display},
+    resample_device{resample_device},
+    resample_latency{resample_latency},
+    resampler{max_prediction}
+{
+}
+
+void mi::TouchResamplingDispatcher::set_input_device_hub(std::shared_ptr<InputDeviceHub> const& hub)
+{
+    hub->add_observer(std::make_shared<ResamplingDeviceObserver>(this, resample_device));
+}
+
+void mi::TouchResamplingDispatcher::enable_device(MirInputDeviceId id, unsigned output_id)
+{
+    if (!output_id)
+        output_id = first_active_output(*display);
+
+    std::lock_guard<std::mutex> lock{mutex};
+
+    auto& device = devices[id];
+    device.output_id = output_id;
+    if (!device.alarm)
+        device.alarm = alarm_factory->create_alarm([this, id] { deliver_frame(id); });
+}
+
+void mi::TouchResamplingDispatcher::remove_device(MirInputDeviceId id)
+{
+    // Destroying the alarm waits for a running deliver_frame(), which takes the
+    // mutex: so destroy it only after releasing the mutex
+    std::shared_ptr<time::Alarm> alarm;
+
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+
+        auto const device = devices.find(id);
+        if (device == devices.end())
+            return;
+
+        alarm = std::move(device->second.alarm);
+        devices.erase(device);
+        resampler.forget_device(id);
+    }
+}
+
+bool mi::TouchResamplingDispatcher::dispatch(std::shared_ptr<MirEvent const> const& event)
+{
+    std::lock_guard<std::mutex> ordering{dispatch_mutex};
+
+    if (mir_event_get_type(event.get()) == mir_event_type_input)
+    {
+        auto const iev = mir_event_get_input_event(event.get());
+        if (mir_input_event_get_type(iev) == mir_input_event_type_touch)
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+
+            auto const device = devices.find(mir_input_event_get_device_id(iev));
+            if (device != devices.end() && resampler.hold(event))
+            {
+                auto& state = device->second;
+                if (state.alarm->state() != time::Alarm::pending)
+                {
+                    state.next_frame = next_frame_on(lock, state.output_id);
+                    state.alarm->reschedule_for(to_timestamp(state.next_frame));
+                }
+                return true;
+            }
+        }
+    }
+
+    return next_dispatcher->dispatch(event);
+}
+
+void mi::TouchResamplingDispatcher::deliver_frame(MirInputDeviceId id)
+{
+    std::lock_guard<std::mutex> ordering{dispatch_mutex};
+    std::shared_ptr<MirEvent const> resampled;
+
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+
+        auto const device = devices.find(id);
+        if (device == devices.end())
+            return;
+
+        auto& state = device->second;
+        resampled = resampler.resample(id, state.next_frame - resample_latency);
+
+        // The contacts moved since the time shown in this frame: show where they went in the next
+        if (resampler.holds_motion(id))
+        {
+            state.next_frame = next_frame_on(lock, state.output_id);
+            state.alarm->reschedule_for(to_timestamp(state.next_frame));
+        }
+    }
+
+    if (resampled)
+        next_dispatcher->dispatch(resampled);
+}
+
+std::chrono::nanoseconds mi::TouchResamplingDispatcher::next_frame_on(
+    std::lock_guard<std::mutex> const&, unsigned output_id)
+{
+    auto const timing = outputs.emplace(output_id, OutputTiming{{}, default_frame_period}).first;
+    auto& last_frame = timing->second.last_frame;
+    auto& frame_period = timing->second.frame_period;
+
+    mg::Frame frame;
+    try
+    {
+        frame = display->last_frame_on(output_id);
+    }
+    catch (...)
+    {
+        // Not every display knows about every output; fall back on the nominal frame period
+    }
+
+    if (frame.ust.clock_id != CLOCK_MONOTONIC)
+        frame = {};
+
+    if (frame.msc > last_frame.msc)
+    {
+        if (last_frame.msc)
+        {
+            auto const period = (frame.ust - last_frame.ust) / (frame.msc - last_frame.msc);
+            if (period > std::chrono::nanoseconds::zero() && period < std::chrono::seconds{1})
+                frame_period = period;
+        }
+        last_frame = frame;
+    }
+
+    auto const now = std::chrono::steady_clock::now().time_since_epoch();
+    auto const phase = last_frame.ust.nanoseconds;
+    auto const frames_since = now > phase ? (now - phase) / frame_period : 0;
+
+    return phase + (frames_since + 1) * frame_period;
+}
+
+void mi::TouchResamplingDispatcher::start()
+{
+    next_dispatcher->start();
+}
+
+void mi::TouchResamplingDispatcher::stop()
+{
+    std::vector<std::shared_ptr<time::Alarm>> alarms;
+
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+
+        for (auto& device : devices)
+        {
+            alarms.push_back(device.second.alarm);
+            resampler.forget_device(device.first);
+        }
+    }
+
+    // Cancelling waits for a running deliver_frame(), which takes the mutex
+    for (auto const& alarm : alarms)
+        alarm->cancel();
+
+    next_dispatcher->stop();
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_INPUT_TOUCH_RESAMPLING_DISPATCHER_H_
+#define MIR_INPUT_TOUCH_RESAMPLING_DISPATCHER_H_
+
+#include "touch_resampler.h"
+
+#include "mir/input/input_dispatcher.h"
+#include "mir/graphics/frame.h"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace mir
+{
+namespace graphics
+{
+class Display;
+}
+namespace time
+{
+class AlarmFactory;
+class Alarm;
+}
+namespace input
+{
+class Device;
+class InputDeviceHub;
+
+/**
+ * Delivers touch motion once per frame of the output a touchscreen is mapped to
+ *
+ * Motion from selected touchscreens is held back and resampled to
+ * resample_latency before the output's next vblank, so every frame a client
+ * draws shows the contacts at the same distance behind the finger rather than
+ * wherever the last device sample happened to land. Motion keeps being
+ * delivered each frame until the frames catch up with the newest sample.
+ * Contacts going down or up are delivered immediately.
+ */
+class TouchResamplingDispatcher : public InputDispatcher
+{
+public:
+    using DeviceFilter = std::function<bool(Device const&)>;
+
+    TouchResamplingDispatcher(
+        std::shared_ptr<InputDispatcher> const& next_dispatcher,
+        std::shared_ptr<time::AlarmFactory> const& alarm_factory,
+        std::shared_ptr<graphics::Display> const& display,
+        DeviceFilter const& resample_device,
+        std::chrono::nanoseconds resample_latency,
+        std::chrono::nanoseconds max_prediction);
+
+    // InputDispatcher
+    bool dispatch(std::shared_ptr<MirEvent const> const& event) override;
+    void start() override;
+    void stop() override;
+
+    void set_input_device_hub(std::shared_ptr<InputDeviceHub> const& hub);
+
+    /// Resamples touches from the device to frames on the output (0 for the first active output)
+    void enable_device(MirInputDeviceId id, unsigned output_id);
+    void remove_device(MirInputDeviceId id);
+
+private:
+    struct OutputTiming
+    {
+        graphics::Frame last_frame;
+        std::chrono::nanoseconds frame_period;
+    };
+
+    struct DeviceState
+    {
+        unsigned output_id;
+        std::shared_ptr<time::Alarm> alarm;
+        std::chrono::nanoseconds next_frame{0};
+    };
+
+    std::chrono::nanoseconds next_frame_on(std::lock_guard<std::mutex> const&, unsigned output_id);
+    void deliver_frame(MirInputDeviceId id);
+
+    std::shared_ptr<InputDispatcher> const next_dispatcher;
+    std::shared_ptr<time::AlarmFactory> const alarm_factory;
+    std::shared_ptr<graphics::Display> const display;
+    DeviceFilter const resample_device;
+    std::chrono::nanoseconds const resample_latency;
+
+    // Held while deciding on and passing on an event, so events from dispatch()
+    // and from the frame alarms reach next_dispatcher in the order decided.
+    // Taken before mutex.
+    std::mutex dispatch_mutex;
+
+    std::mutex mutex;
+    TouchResampler resampler;
+    std::unordered_map<MirInputDeviceId, DeviceState> devices;
+    std::unordered_map<unsigned, OutputTiming> outputs;
+};
+
+}
+}
+
+#endif // MIR_INPUT_TOUCH_RESAMPLING_DISPATCHER_H_
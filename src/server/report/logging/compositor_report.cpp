@@ -66,6 +66,10 @@ void mrl::CompositorReport::renderables_in_frame(SubCompositorId, mir::graphics:
 {
 }
 
+void mrl::CompositorReport::buffer_submitted(mir::graphics::Renderable::ID, mir::graphics::BufferID, uint64_t)
+{
+}
+
 void mrl::CompositorReport::rendered_frame(SubCompositorId id)
 {
     std::lock_guard<std::mutex> lock(mutex);
@@ -50,6 +50,7 @@ public:
     void started() override;
     void stopped() override;
     void scheduled() override;
+    void buffer_submitted(graphics::Renderable::ID stream, graphics::BufferID buffer, uint64_t sequence) override;
 
 private:
     std::shared_ptr<mir::logging::Logger> const logger;
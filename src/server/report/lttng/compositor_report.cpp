@@ -47,10 +47,19 @@ void mir::report::lttng::CompositorReport::renderables_in_frame(
     SubCompositorId id, graphics::RenderableList const& list)
 {
     std::vector<uint32_t> ids(list.size());
-    auto it = list.begin();
-    for(auto& id : ids)
-        id = (*it++)->buffer()->id().as_value();
-    mir_tracepoint(mir_server_compositor, buffers_in_frame, id, ids.data(), ids.size());
+    std::vector<uintptr_t> renderable_ids(list.size());
+    for (size_t i = 0; i != list.size(); ++i)
+    {
+        ids[i] = list[i]->buffer()->id().as_value();
+        renderable_ids[i] = reinterpret_cast<uintptr_t>(list[i]->id());
+    }
+    mir_tracepoint(mir_server_compositor, buffers_in_frame, id, ids.data(), ids.size(), renderable_ids.data());
+}
+
+void mir::report::lttng::CompositorReport::buffer_submitted(
+    graphics::Renderable::ID stream, graphics::BufferID buffer, uint64_t sequence)
+{
+    mir_tracepoint(mir_server_compositor, buffer_submitted, stream, buffer.as_value(), sequence);
 }
 
 void mir::report::lttng::CompositorReport::rendered_frame(SubCompositorId id)
@@ -43,6 +43,7 @@ public:
     void started() override;
     void stopped() override;
     void scheduled() override;
+    void buffer_submitted(graphics::Renderable::ID stream, graphics::BufferID buffer, uint64_t sequence) override;
 private:
     ServerTracepointProvider tp_provider;
 };
@@ -80,10 +80,22 @@ TRACEPOINT_EVENT(
 TRACEPOINT_EVENT(
     mir_server_compositor,
     buffers_in_frame,
-    TP_ARGS(void const*, id, unsigned int*, buffer_ids, size_t, buffer_ids_len),
+    TP_ARGS(void const*, id, unsigned int*, buffer_ids, size_t, buffer_ids_len, uintptr_t*, renderable_ids),
     TP_FIELDS(
         ctf_integer_hex(uintptr_t, id, (uintptr_t)(id))
         ctf_sequence(unsigned int, buffer_ids, buffer_ids, size_t, buffer_ids_len)
+        ctf_sequence_hex(uintptr_t, renderable_ids, renderable_ids, size_t, buffer_ids_len)
+    )
+)
+
+TRACEPOINT_EVENT(
+    mir_server_compositor,
+    buffer_submitted,
+    TP_ARGS(void const*, stream, unsigned int, buffer_id, uint64_t, sequence),
+    TP_FIELDS(
+        ctf_integer_hex(uintptr_t, stream, (uintptr_t)(stream))
+        ctf_integer(unsigned int, buffer_id, buffer_id)
+        ctf_integer(uint64_t, sequence, sequence)
     )
 )
 
@@ -17,6 +17,7 @@
  */
 
 #include "display_report.h"
+#include "mir/graphics/frame.h"
 
 #include "mir/report/lttng/mir_tracepoint.h"
 
@@ -48,7 +49,7 @@ void mir::report::lttng::DisplayReport::report_drm_master_failure(int error)
 }
 
 void mir::report::lttng::DisplayReport::report_vsync(unsigned int output_id,
-                                                     mir::graphics::Frame const&)
+                                                     mir::graphics::Frame const& frame)
 {
-    mir_tracepoint(mir_server_display, report_vsync, output_id);
+    mir_tracepoint(mir_server_display, report_vsync, output_id, frame.msc, frame.ust.nanoseconds.count());
 }
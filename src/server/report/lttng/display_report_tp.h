@@ -65,9 +65,11 @@ TRACEPOINT_EVENT(
 TRACEPOINT_EVENT(
     mir_server_display,
     report_vsync,
-    TP_ARGS(int, id),
+    TP_ARGS(int, id, int64_t, msc, int64_t, ust),
     TP_FIELDS(
         ctf_integer(int, id, id)
+        ctf_integer(int64_t, msc, msc)
+        ctf_integer(int64_t, ust, ust)
      )
 )
 
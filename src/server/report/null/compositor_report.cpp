@@ -51,3 +51,7 @@ void mrn::CompositorReport::stopped()
 void mrn::CompositorReport::scheduled()
 {
 }
+
+void mrn::CompositorReport::buffer_submitted(mir::graphics::Renderable::ID, mir::graphics::BufferID, uint64_t)
+{
+}
@@ -32,6 +32,7 @@
 #include "mir/events/event_builders.h"
 #include "mir/frontend/event_sink.h"
 #include "mir/graphics/graphic_buffer_allocator.h"
+#include "mir/time/alarm_factory.h"
 
 #include <boost/throw_exception.hpp>
 
@@ -58,7 +59,8 @@ ms::ApplicationSession::ApplicationSession(
     std::shared_ptr<SessionListener> const& session_listener,
     mg::DisplayConfiguration const& initial_config,
     std::shared_ptr<mf::EventSink> const& sink,
-    std::shared_ptr<graphics::GraphicBufferAllocator> const& gralloc) : 
+    std::shared_ptr<graphics::GraphicBufferAllocator> const& gralloc,
+    std::shared_ptr<time::AlarmFactory> const& alarm_factory) :
     surface_stack(surface_stack),
     surface_factory(surface_factory),
     buffer_stream_factory(buffer_stream_factory),
@@ -68,6 +70,7 @@ ms::ApplicationSession::ApplicationSession(
     session_listener(session_listener),
     event_sink(sink),
     gralloc(gralloc),
+    alarm_factory(alarm_factory),
     next_surface_id(0)
 {
     assert(surface_stack);
@@ -143,7 +146,8 @@ mf::SurfaceId ms::ApplicationSession::create_surface(
         id,
         *surface,
         output_cache,
-        surface_sink);
+        surface_sink,
+        *alarm_factory);
     surface->add_observer(observer);
 
     {
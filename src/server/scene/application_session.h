@@ -42,6 +42,7 @@ class GraphicBufferAllocator;
 class BufferAttribute;
 }
 namespace shell { class SurfaceStack; }
+namespace time { class AlarmFactory; }
 namespace scene
 {
 class SessionListener;
@@ -63,7 +64,8 @@ public:
         std::shared_ptr<SessionListener> const& session_listener,
         graphics::DisplayConfiguration const& initial_config,
         std::shared_ptr<frontend::EventSink> const& sink,
-        std::shared_ptr<graphics::GraphicBufferAllocator> const& allocator);
+        std::shared_ptr<graphics::GraphicBufferAllocator> const& allocator,
+        std::shared_ptr<time::AlarmFactory> const& alarm_factory);
 
     ~ApplicationSession();
 
@@ -114,6 +116,7 @@ private:
     std::shared_ptr<SessionListener> const session_listener;
     std::shared_ptr<frontend::EventSink> const event_sink;
     std::shared_ptr<graphics::GraphicBufferAllocator> const gralloc;
+    std::shared_ptr<time::AlarmFactory> const alarm_factory;
 
     frontend::SurfaceId next_id();
 
@@ -37,6 +37,7 @@
 #include "surface_allocator.h"
 #include "surface_stack.h"
 #include "threaded_snapshot_strategy.h"
+#include "mir/thread/work_stealing_thread_pool.h"
 #include "prompt_session_manager_impl.h"
 #include "default_coordinate_translator.h"
 #include "unsupported_coordinate_translator.h"
@@ -183,7 +184,8 @@ mir::DefaultServerConfiguration::the_session_coordinator()
                 the_session_listener(),
                 the_display(),
                 the_application_not_responding_detector(),
-                the_buffer_allocator());
+                the_buffer_allocator(),
+                the_main_loop());
         });
 }
 
@@ -214,7 +216,8 @@ mir::DefaultServerConfiguration::the_snapshot_strategy()
         [this]()
         {
             return std::make_shared<ms::ThreadedSnapshotStrategy>(
-                the_pixel_buffer());
+                the_pixel_buffer(),
+                the_background_thread_pool());
         });
 }
 
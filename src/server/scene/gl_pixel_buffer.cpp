@@ -104,6 +104,16 @@ void ms::GLPixelBuffer::fill_from(graphics::Buffer& buffer)
 
     prepare();
 
+    /*
+     * Snapshots may be taken on any thread of a pool, so don't leave the
+     * context current on this one
+     */
+    struct ReleaseContext
+    {
+        renderer::gl::Context const& context;
+        ~ReleaseContext() { context.release_current(); }
+    } const release{*gl_context};
+
     auto const texture_source =
         dynamic_cast<mir::renderer::gl::TextureSource*>(
             buffer.native_buffer_base());
@@ -93,13 +93,15 @@ void ms::LegacySceneChangeNotification::add_surface_observer(ms::Surface* surfac
     auto notifier = [surface, this, was_visible = false] () mutable
         {
             if (surface->visible() || was_visible)
-                scene_notify_change();
+                notify_scene_change();
             was_visible = surface->visible();
         };
 
     if (buffer_notify_change)
     {
-        auto observer = std::make_shared<LegacySurfaceChangeNotification>(notifier, buffer_notify_change);
+        auto observer = std::make_shared<LegacySurfaceChangeNotification>(
+            notifier,
+            [this](int frames) { notify_buffer_change(frames); });
         surface->add_observer(observer);
 
         std::unique_lock<decltype(surface_observers_guard)> lg(surface_observers_guard);
@@ -107,7 +109,10 @@ void ms::LegacySceneChangeNotification::add_surface_observer(ms::Surface* surfac
     }
     else
     {
-        auto observer = std::make_shared<NonLegacySurfaceChangeNotification>(notifier, damage_notify_change, surface);
+        auto observer = std::make_shared<NonLegacySurfaceChangeNotification>(
+            notifier,
+            [this](int frames, mir::geometry::Rectangle const& damage) { notify_damage_change(frames, damage); },
+            surface);
         surface->add_observer(observer);
 
         std::unique_lock<decltype(surface_observers_guard)> lg(surface_observers_guard);
@@ -121,7 +126,7 @@ void ms::LegacySceneChangeNotification::surface_added(ms::Surface* surface)
 
     // If the surface already has content we need to (re)composite
     if (!buffer_notify_change && surface->visible())
-        scene_notify_change();
+        notify_scene_change();
 }
 
 void ms::LegacySceneChangeNotification::surface_exists(ms::Surface* surface)
@@ -142,17 +147,17 @@ void ms::LegacySceneChangeNotification::surface_removed(ms::Surface* surface)
     }
 
     if (surface->visible())
-        scene_notify_change();
+        notify_scene_change();
 }
 
 void ms::LegacySceneChangeNotification::surfaces_reordered()
 {
-    scene_notify_change();
+    notify_scene_change();
 }
 
 void ms::LegacySceneChangeNotification::scene_changed()
 {
-    scene_notify_change();
+    notify_scene_change();
 }
 
 void ms::LegacySceneChangeNotification::end_observation()
@@ -166,3 +171,57 @@ void ms::LegacySceneChangeNotification::end_observation()
     }
     surface_observers.clear();
 }
+
+void ms::LegacySceneChangeNotification::transaction_begun()
+{
+    std::lock_guard<decltype(transaction_guard)> lock{transaction_guard};
+
+    if (transaction_depth++ == 0)
+        transaction_thread = std::this_thread::get_id();
+}
+
+void ms::LegacySceneChangeNotification::transaction_ended()
+{
+    {
+        std::lock_guard<decltype(transaction_guard)> lock{transaction_guard};
+
+        // An observer added during a transaction sees its end without its start
+        if (transaction_depth == 0 || --transaction_depth > 0)
+            return;
+
+        transaction_thread = std::thread::id{};
+
+        if (!scene_change_deferred)
+            return;
+
+        scene_change_deferred = false;
+    }
+
+    scene_notify_change();
+}
+
+void ms::LegacySceneChangeNotification::notify_scene_change()
+{
+    {
+        std::lock_guard<decltype(transaction_guard)> lock{transaction_guard};
+
+        // Only the transaction's own changes wait for it to end
+        if (transaction_depth > 0 && transaction_thread == std::this_thread::get_id())
+        {
+            scene_change_deferred = true;
+            return;
+        }
+    }
+
+    scene_notify_change();
+}
+
+void ms::LegacySceneChangeNotification::notify_buffer_change(int frames)
+{
+    buffer_notify_change(frames);
+}
+
+void ms::LegacySceneChangeNotification::notify_damage_change(int frames, mir::geometry::Rectangle const& damage)
+{
+    damage_notify_change(frames, damage);
+}
@@ -25,3 +25,5 @@ void ms::NullObserver::surface_removed(ms::Surface* /* surface */) {}
 void ms::NullObserver::surfaces_reordered() {}
 void ms::NullObserver::surface_exists(ms::Surface* /* surface */) {}
 void ms::NullObserver::end_observation() {}
+void ms::NullObserver::transaction_begun() {}
+void ms::NullObserver::transaction_ended() {}
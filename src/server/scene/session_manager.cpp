@@ -98,7 +98,8 @@ ms::SessionManager::SessionManager(
     std::shared_ptr<SessionListener> const& session_listener,
     std::shared_ptr<graphics::Display const> const& display,
     std::shared_ptr<ApplicationNotRespondingDetector> const& anr_detector,
-    std::shared_ptr<graphics::GraphicBufferAllocator> const& allocator) :
+    std::shared_ptr<graphics::GraphicBufferAllocator> const& allocator,
+    std::shared_ptr<time::AlarmFactory> const& alarm_factory) :
     observers(std::make_shared<SessionObservers>()),
     surface_stack(surface_stack),
     surface_factory(surface_factory),
@@ -109,7 +110,8 @@ ms::SessionManager::SessionManager(
     session_listener(session_listener),
     display{display},
     anr_detector{anr_detector},
-    allocator(allocator)
+    allocator(allocator),
+    alarm_factory{alarm_factory}
 {
     observers->register_interest(session_listener);
 }
@@ -149,7 +151,8 @@ std::shared_ptr<ms::Session> ms::SessionManager::open_session(
             observers,
             *display->configuration(),
             sender,
-            allocator);
+            allocator,
+            alarm_factory);
 
     app_container->insert_session(new_session);
 
@@ -35,6 +35,7 @@ class GraphicBufferAllocator;
 }
 
 namespace shell { class SurfaceStack; }
+namespace time { class AlarmFactory; }
 
 namespace scene
 {
@@ -61,7 +62,8 @@ public:
         std::shared_ptr<SessionListener> const& session_listener,
         std::shared_ptr<graphics::Display const> const& display,
         std::shared_ptr<ApplicationNotRespondingDetector> const& anr_detector,
-        std::shared_ptr<graphics::GraphicBufferAllocator> const& allocator); 
+        std::shared_ptr<graphics::GraphicBufferAllocator> const& allocator,
+        std::shared_ptr<time::AlarmFactory> const& alarm_factory);
 
     virtual ~SessionManager() noexcept;
 
@@ -97,6 +99,7 @@ private:
     std::shared_ptr<graphics::Display const> const display;
     std::shared_ptr<ApplicationNotRespondingDetector> const anr_detector;
     std::shared_ptr<graphics::GraphicBufferAllocator> const allocator;
+    std::shared_ptr<time::AlarmFactory> const alarm_factory;
 };
 
 }
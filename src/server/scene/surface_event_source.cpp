@@ -24,6 +24,8 @@
 
 #include "mir/geometry/size.h"
 #include "mir/geometry/rectangle.h"
+#include "mir/time/alarm.h"
+#include "mir/time/alarm_factory.h"
 
 #include <cstring>
 #include <algorithm>
@@ -36,19 +38,60 @@ ms::SurfaceEventSource::SurfaceEventSource(
     frontend::SurfaceId id,
     Surface const& surface,
     OutputPropertiesCache const& outputs,
-    std::shared_ptr<frontend::EventSink> const& event_sink) :
+    std::shared_ptr<frontend::EventSink> const& event_sink,
+    time::AlarmFactory& alarm_factory) :
     id(id),
     surface{surface},
     outputs{outputs},
-    event_sink(event_sink)
+    event_sink(event_sink),
+    resize_alarm{alarm_factory.create_alarm([this] { release_held_resize(); })}
 {
 }
 
+ms::SurfaceEventSource::~SurfaceEventSource() = default;
+
+std::chrono::milliseconds const ms::SurfaceEventSource::resize_timeout{100};
+
 void ms::SurfaceEventSource::resized_to(Surface const*, geometry::Size const& size)
 {
+    std::lock_guard<std::mutex> lock{resize_mutex};
+
+    if (resize_outstanding)
+    {
+        held_resize = size;
+        return;
+    }
+
+    resize_outstanding = true;
+    held_resize = optional_value<geometry::Size>{};
+
+    // Rescheduling doesn't wait for a running callback, so it is safe under the lock
+    resize_alarm->reschedule_in(resize_timeout);
+
+    // Sent under the lock, so a resize can't overtake an older one on another thread
     event_sink->handle_event(mev::make_event(id, size));
 }
 
+void ms::SurfaceEventSource::frame_posted(Surface const*, int, geometry::Size const&)
+{
+    release_held_resize();
+}
+
+void ms::SurfaceEventSource::release_held_resize()
+{
+    std::lock_guard<std::mutex> lock{resize_mutex};
+
+    resize_outstanding = false;
+
+    if (!held_resize.is_set())
+        return;
+
+    resize_outstanding = true;
+    resize_alarm->reschedule_in(resize_timeout);
+
+    event_sink->handle_event(mev::make_event(id, held_resize.consume()));
+}
+
 void ms::SurfaceEventSource::moved_to(Surface const*, geometry::Point const& top_left)
 {
     auto new_output_properties = outputs.properties_for(geom::Rectangle{top_left, surface.size()});
@@ -111,32 +111,50 @@ private:
 ms::SurfaceStack::SurfaceStack(
     std::shared_ptr<SceneReport> const& report) :
     report{report},
+    snapshot{std::make_shared<Snapshot const>()},
     scene_changed{false}
 {
 }
 
+auto ms::SurfaceStack::current_snapshot() const -> std::shared_ptr<Snapshot const>
+{
+    // Not lock-free: the standard library guards the shared_ptr with a short
+    // internal lock, held only while copying the pointer
+    return std::atomic_load(&snapshot);
+}
+
+void ms::SurfaceStack::publish(std::shared_ptr<Snapshot const> const& next)
+{
+    std::atomic_store(&snapshot, next);
+}
+
 mc::SceneElementSequence ms::SurfaceStack::scene_elements_for(mc::CompositorID id)
 {
-    RecursiveReadLock lg(guard);
+    std::shared_lock<std::shared_timed_mutex> transaction_lock{transaction_scene_lock};
+    auto const current = current_snapshot();
 
     scene_changed = false;
     mc::SceneElementSequence elements;
-    for (auto const& surface : surfaces)
+    for (auto const& surface : current->surfaces)
     {
         if (surface->visible())
         {
+            auto const tracker = current->rendering_trackers.find(surface.get());
+            if (tracker == current->rendering_trackers.end())
+                continue;
+
             for (auto& renderable : surface->generate_renderables(id))
             {
                 elements.emplace_back(
                     std::make_shared<SurfaceSceneElement>(
                         surface->name(),
                         renderable,
-                        rendering_trackers[surface.get()],
+                        tracker->second,
                         id));
             }
         }
     }
-    for (auto const& renderable : overlays)
+    for (auto const& renderable : current->overlays)
     {
         elements.emplace_back(std::make_shared<OverlaySceneElement>(renderable));
     }
@@ -145,15 +163,16 @@ mc::SceneElementSequence ms::SurfaceStack::scene_elements_for(mc::CompositorID i
 
 int ms::SurfaceStack::frames_pending(mc::CompositorID id) const
 {
-    RecursiveReadLock lg(guard);
+    std::shared_lock<std::shared_timed_mutex> transaction_lock{transaction_scene_lock};
+    auto const current = current_snapshot();
 
     int result = scene_changed ? 1 : 0;
-    for (auto const& surface : surfaces)
+    for (auto const& surface : current->surfaces)
     {
         if (surface->visible())
         {
-            auto const tracker = rendering_trackers.find(surface.get());
-            if (tracker != rendering_trackers.end() && tracker->second->is_exposed_in(id))
+            auto const tracker = current->rendering_trackers.find(surface.get());
+            if (tracker != current->rendering_trackers.end() && tracker->second->is_exposed_in(id))
             {
                 // Note that we ask the surface and not a Renderable.
                 // This is because we don't want to waste time and resources
@@ -169,28 +188,30 @@ int ms::SurfaceStack::frames_pending(mc::CompositorID id) const
 
 void ms::SurfaceStack::register_compositor(mc::CompositorID cid)
 {
-    RecursiveWriteLock lg(guard);
+    std::lock_guard<std::mutex> lg(guard);
 
     registered_compositors.insert(cid);
 
-    update_rendering_tracker_compositors();
+    update_rendering_tracker_compositors(*snapshot);
 }
 
 void ms::SurfaceStack::unregister_compositor(mc::CompositorID cid)
 {
-    RecursiveWriteLock lg(guard);
+    std::lock_guard<std::mutex> lg(guard);
 
     registered_compositors.erase(cid);
 
-    update_rendering_tracker_compositors();
+    update_rendering_tracker_compositors(*snapshot);
 }
 
 void ms::SurfaceStack::add_input_visualization(
     std::shared_ptr<mg::Renderable> const& overlay)
 {
     {
-        RecursiveWriteLock lg(guard);
-        overlays.push_back(overlay);
+        std::lock_guard<std::mutex> lg(guard);
+        auto next = std::make_shared<Snapshot>(*snapshot);
+        next->overlays.push_back(overlay);
+        publish(next);
     }
     emit_scene_changed();
 }
@@ -200,13 +221,15 @@ void ms::SurfaceStack::remove_input_visualization(
 {
     auto overlay = weak_overlay.lock();
     {
-        RecursiveWriteLock lg(guard);
-        auto const p = std::find(overlays.begin(), overlays.end(), overlay);
-        if (p == overlays.end())
+        std::lock_guard<std::mutex> lg(guard);
+        auto next = std::make_shared<Snapshot>(*snapshot);
+        auto const p = std::find(next->overlays.begin(), next->overlays.end(), overlay);
+        if (p == next->overlays.end())
         {
             BOOST_THROW_EXCEPTION(std::runtime_error("Attempt to remove an overlay which was never added or which has been previously removed"));
         }
-        overlays.erase(p);
+        next->overlays.erase(p);
+        publish(next);
     }
     
     emit_scene_changed();
@@ -214,10 +237,7 @@ void ms::SurfaceStack::remove_input_visualization(
 
 void ms::SurfaceStack::emit_scene_changed()
 {
-    {
-        RecursiveWriteLock lg(guard);
-        scene_changed = true;
-    }
+    scene_changed = true;
     observers.scene_changed();
 }
 
@@ -226,9 +246,11 @@ void ms::SurfaceStack::add_surface(
     mi::InputReceptionMode input_mode)
 {
     {
-        RecursiveWriteLock lg(guard);
-        surfaces.push_back(surface);
-        create_rendering_tracker_for(surface);
+        std::lock_guard<std::mutex> lg(guard);
+        auto next = std::make_shared<Snapshot>(*snapshot);
+        next->surfaces.push_back(surface);
+        next->rendering_trackers[surface.get()] = create_rendering_tracker_for(surface);
+        publish(next);
     }
     surface->set_reception_mode(input_mode);
     observers.surface_added(surface.get());
@@ -242,14 +264,17 @@ void ms::SurfaceStack::remove_surface(std::weak_ptr<Surface> const& surface)
 
     bool found_surface = false;
     {
-        RecursiveWriteLock lg(guard);
+        std::lock_guard<std::mutex> lg(guard);
 
+        auto const& surfaces = snapshot->surfaces;
         auto const surface = std::find(surfaces.begin(), surfaces.end(), keep_alive);
 
         if (surface != surfaces.end())
         {
-            surfaces.erase(surface);
-            rendering_trackers.erase(keep_alive.get());
+            auto next = std::make_shared<Snapshot>(*snapshot);
+            next->surfaces.erase(next->surfaces.begin() + (surface - surfaces.begin()));
+            next->rendering_trackers.erase(keep_alive.get());
+            publish(next);
             found_surface = true;
         }
     }
@@ -279,8 +304,8 @@ InReverse<Container> in_reverse(Container& container) { return InReverse<Contain
 auto ms::SurfaceStack::surface_at(geometry::Point cursor) const
 -> std::shared_ptr<Surface>
 {
-    RecursiveReadLock lg(guard);
-    for (auto const& surface : in_reverse(surfaces))
+    auto const current = current_snapshot();
+    for (auto const& surface : in_reverse(current->surfaces))
     {
         // TODO There's a lack of clarity about how the input area will
         // TODO be maintained and whether this test will detect clicks on
@@ -295,8 +320,8 @@ auto ms::SurfaceStack::surface_at(geometry::Point cursor) const
 
 void ms::SurfaceStack::for_each(std::function<void(std::shared_ptr<mi::Surface> const&)> const& callback)
 {
-    RecursiveReadLock lg(guard);
-    for (auto &surface : surfaces)
+    auto const current = current_snapshot();
+    for (auto const& surface : current->surfaces)
     {
         callback(surface);
     }
@@ -309,13 +334,16 @@ void ms::SurfaceStack::raise(std::weak_ptr<Surface> const& s)
     {
         auto const surface = s.lock();
 
-        RecursiveWriteLock ul(guard);
+        std::lock_guard<std::mutex> ul(guard);
+        auto const& surfaces = snapshot->surfaces;
         auto const p = std::find(surfaces.begin(), surfaces.end(), surface);
 
         if (p != surfaces.end())
         {
-            surfaces.erase(p);
-            surfaces.push_back(surface);
+            auto next = std::make_shared<Snapshot>(*snapshot);
+            next->surfaces.erase(next->surfaces.begin() + (p - surfaces.begin()));
+            next->surfaces.push_back(surface);
+            publish(next);
             surfaces_reordered = true;
         }
     }
@@ -331,35 +359,76 @@ void ms::SurfaceStack::raise(SurfaceSet const& ss)
 {
     bool surfaces_reordered{false};
     {
-        RecursiveWriteLock ul(guard);
+        std::lock_guard<std::mutex> ul(guard);
 
-        auto const old_surfaces = surfaces;
+        auto next = std::make_shared<Snapshot>(*snapshot);
         std::stable_partition(
-            begin(surfaces), end(surfaces),
+            begin(next->surfaces), end(next->surfaces),
             [&](std::weak_ptr<Surface> const& s) { return !ss.count(s); });
 
-        if (old_surfaces != surfaces)
+        if (next->surfaces != snapshot->surfaces)
+        {
+            publish(next);
             surfaces_reordered = true;
+        }
     }
 
     if (surfaces_reordered)
         observers.surfaces_reordered();
 }
 
-void ms::SurfaceStack::create_rendering_tracker_for(std::shared_ptr<Surface> const& surface)
+void ms::SurfaceStack::apply_transaction(std::function<void()> const& changes)
 {
-    auto const tracker = std::make_shared<RenderingTracker>(surface);
+    std::lock_guard<std::recursive_mutex> lock{transaction_guard};
 
-    RecursiveWriteLock ul(guard);
-    tracker->active_compositors(registered_compositors);
-    rendering_trackers[surface.get()] = tracker;
+    observers.transaction_begun();
+
+    try
+    {
+        // Nested transactions already hold the scene lock
+        std::unique_lock<std::shared_timed_mutex> scene_lock{transaction_scene_lock, std::defer_lock};
+        bool const outermost{!in_transaction};
+
+        if (outermost)
+        {
+            scene_lock.lock();
+            in_transaction = true;
+        }
+
+        try
+        {
+            changes();
+        }
+        catch (...)
+        {
+            if (outermost)
+                in_transaction = false;
+            throw;
+        }
+
+        if (outermost)
+            in_transaction = false;
+    }
+    catch (...)
+    {
+        observers.transaction_ended();
+        throw;
+    }
+
+    observers.transaction_ended();
 }
 
-void ms::SurfaceStack::update_rendering_tracker_compositors()
+auto ms::SurfaceStack::create_rendering_tracker_for(std::shared_ptr<Surface> const& surface) const
+-> std::shared_ptr<RenderingTracker>
 {
-    RecursiveReadLock ul(guard);
+    auto const tracker = std::make_shared<RenderingTracker>(surface);
+    tracker->active_compositors(registered_compositors);
+    return tracker;
+}
 
-    for (auto const& pair : rendering_trackers)
+void ms::SurfaceStack::update_rendering_tracker_compositors(Snapshot const& current) const
+{
+    for (auto const& pair : current.rendering_trackers)
         pair.second->active_compositors(registered_compositors);
 }
 
@@ -368,8 +437,8 @@ void ms::SurfaceStack::add_observer(std::shared_ptr<ms::Observer> const& observe
     observers.add(observer);
 
     // Notify observer of existing surfaces
-    RecursiveReadLock lk(guard);
-    for (auto &surface : surfaces)
+    auto const current = current_snapshot();
+    for (auto const& surface : current->surfaces)
     {
         observer->surface_exists(surface.get());
     }
@@ -421,3 +490,15 @@ void ms::Observers::end_observation()
     for_each([&](std::shared_ptr<Observer> const& observer)
         { observer->end_observation(); });
 }
+
+void ms::Observers::transaction_begun()
+{
+    for_each([&](std::shared_ptr<Observer> const& observer)
+        { observer->transaction_begun(); });
+}
+
+void ms::Observers::transaction_ended()
+{
+    for_each([&](std::shared_ptr<Observer> const& observer)
+        { observer->transaction_ended(); });
+}
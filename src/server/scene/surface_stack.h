@@ -24,7 +24,6 @@
 #include "mir/compositor/scene.h"
 #include "mir/scene/observer.h"
 #include "mir/input/scene.h"
-#include "mir/recursive_read_write_mutex.h"
 
 #include "mir/basic_observers.h"
 
@@ -33,6 +32,7 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <shared_mutex>
 #include <vector>
 
 namespace mir
@@ -59,6 +59,8 @@ public:
    void scene_changed() override;
    void surface_exists(Surface* surface) override;
    void end_observation() override;
+   void transaction_begun() override;
+   void transaction_ended() override;
 
    using BasicObservers<Observer>::add;
    using BasicObservers<Observer>::remove;
@@ -92,6 +94,8 @@ public:
     
     auto surface_at(geometry::Point) const -> std::shared_ptr<Surface> override;
 
+    void apply_transaction(std::function<void()> const& changes) override;
+
     void add_observer(std::shared_ptr<Observer> const& observer) override;
     void remove_observer(std::weak_ptr<Observer> const& observer) override;
     
@@ -104,18 +108,39 @@ public:
 private:
     SurfaceStack(const SurfaceStack&) = delete;
     SurfaceStack& operator=(const SurfaceStack&) = delete;
-    void create_rendering_tracker_for(std::shared_ptr<Surface> const&);
-    void update_rendering_tracker_compositors();
 
-    RecursiveReadWriteMutex mutable guard;
+    /// An immutable view of the stack. Readers (compositor and input threads)
+    /// take a reference to the current one without taking guard, so they don't
+    /// wait for a writer to finish its changes; writers copy it, modify the copy
+    /// and publish the result. (Compositors do wait for a transaction, see
+    /// transaction_scene_lock.)
+    struct Snapshot
+    {
+        std::vector<std::shared_ptr<Surface>> surfaces;
+        std::map<Surface*,std::shared_ptr<RenderingTracker>> rendering_trackers;
+        std::vector<std::shared_ptr<graphics::Renderable>> overlays;
+    };
+
+    auto current_snapshot() const -> std::shared_ptr<Snapshot const>;
+    // Requires guard to be held
+    void publish(std::shared_ptr<Snapshot const> const& next);
+    auto create_rendering_tracker_for(std::shared_ptr<Surface> const&) const -> std::shared_ptr<RenderingTracker>;
+    void update_rendering_tracker_compositors(Snapshot const& current) const;
+
+    // Serializes writers; readers don't take it
+    std::mutex mutable guard;
+    // Serializes transactions; changes within one may re-enter the stack
+    std::recursive_mutex transaction_guard;
+    // Held exclusively by the outermost transaction and shared by compositors
+    // building a frame, so a frame never shows a transaction half done
+    std::shared_timed_mutex mutable transaction_scene_lock;
+    // Only touched with transaction_guard held
+    bool in_transaction{false};
 
     std::shared_ptr<SceneReport> const report;
 
-    std::vector<std::shared_ptr<Surface>> surfaces;
-    std::map<Surface*,std::shared_ptr<RenderingTracker>> rendering_trackers;
+    std::shared_ptr<Snapshot const> snapshot;
     std::set<compositor::CompositorID> registered_compositors;
-    
-    std::vector<std::shared_ptr<graphics::Renderable>> overlays;
 
     Observers observers;
     std::atomic<bool> scene_changed;
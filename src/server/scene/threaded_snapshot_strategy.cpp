@@ -19,7 +19,8 @@
 #include "threaded_snapshot_strategy.h"
 #include "pixel_buffer.h"
 #include "mir/compositor/buffer_stream.h"
-#include "mir/thread_name.h"
+#include "mir/thread/work_stealing_thread_pool.h"
+#include "mir/log.h"
 
 #include <deque>
 #include <mutex>
@@ -42,33 +43,16 @@ struct WorkItem
 class SnapshottingFunctor
 {
 public:
-    SnapshottingFunctor(std::shared_ptr<PixelBuffer> const& pixels)
-        : running{true}, pixels{pixels}
+    SnapshottingFunctor(std::shared_ptr<PixelBuffer> const& pixels, std::shared_ptr<Executor> const& executor)
+        : pixels{pixels}, executor{executor}, draining{false}
     {
     }
 
-    void operator()()
+    ~SnapshottingFunctor()
     {
-        mir::set_thread_name("Mir/Snapshot");
+        // Snapshots already scheduled are still delivered
         std::unique_lock<std::mutex> lock{work_mutex};
-
-        while (running)
-        {
-            while (running && work.empty())
-                work_cv.wait(lock);
-
-            if (running)
-            {
-                auto wi = work.front();
-                work.pop_front();
-
-                lock.unlock();
-
-                take_snapshot(wi);
-
-                lock.lock();
-            }
-        }
+        idle_cv.wait(lock, [this] { return !draining; });
     }
 
     void take_snapshot(WorkItem const& wi)
@@ -87,22 +71,53 @@ public:
     {
         std::lock_guard<std::mutex> lg{work_mutex};
         work.push_back(wi);
-        work_cv.notify_one();
+
+        // The pixel buffer is shared, so only one task takes snapshots at a time
+        if (!draining)
+        {
+            draining = true;
+            executor->spawn([this] { drain(); });
+        }
     }
 
-    void stop()
+private:
+    void drain()
     {
-        std::lock_guard<std::mutex> lg{work_mutex};
-        running = false;
-        work_cv.notify_one();
+        std::unique_lock<std::mutex> lock{work_mutex};
+
+        while (!work.empty())
+        {
+            auto wi = work.front();
+            work.pop_front();
+
+            lock.unlock();
+
+            try
+            {
+                take_snapshot(wi);
+            }
+            catch (...)
+            {
+                mir::log(
+                    mir::logging::Severity::error,
+                    MIR_LOG_COMPONENT,
+                    std::current_exception(),
+                    "Failed to take snapshot");
+            }
+
+            lock.lock();
+        }
+
+        draining = false;
+        idle_cv.notify_all();
     }
 
-private:
-    bool running;
     std::shared_ptr<PixelBuffer> const pixels;
+    std::shared_ptr<Executor> const executor;
     std::mutex work_mutex;
-    std::condition_variable work_cv;
+    std::condition_variable idle_cv;
     std::deque<WorkItem> work;
+    bool draining;
 };
 
 }
@@ -110,18 +125,21 @@ private:
 
 ms::ThreadedSnapshotStrategy::ThreadedSnapshotStrategy(
     std::shared_ptr<PixelBuffer> const& pixels)
-    : pixels{pixels},
-      functor{new SnapshottingFunctor{pixels}},
-      thread{std::ref(*functor)}
+    : ThreadedSnapshotStrategy{pixels, std::make_shared<thread::WorkStealingThreadPool>(1, "Mir/Snapshot")}
 {
 }
 
-ms::ThreadedSnapshotStrategy::~ThreadedSnapshotStrategy() noexcept
+ms::ThreadedSnapshotStrategy::ThreadedSnapshotStrategy(
+    std::shared_ptr<PixelBuffer> const& pixels,
+    std::shared_ptr<Executor> const& executor)
+    : pixels{pixels},
+      executor{executor},
+      functor{new SnapshottingFunctor{pixels, executor}}
 {
-    functor->stop();
-    thread.join();
 }
 
+ms::ThreadedSnapshotStrategy::~ThreadedSnapshotStrategy() noexcept = default;
+
 void ms::ThreadedSnapshotStrategy::take_snapshot_of(
     std::shared_ptr<compositor::BufferStream> const& surface_buffer_access,
     SnapshotCallback const& snapshot_taken)
@@ -22,11 +22,12 @@
 #include "snapshot_strategy.h"
 
 #include <memory>
-#include <thread>
 #include <functional>
 
 namespace mir
 {
+class Executor;
+
 namespace scene
 {
 class PixelBuffer;
@@ -35,7 +36,13 @@ class SnapshottingFunctor;
 class ThreadedSnapshotStrategy : public SnapshotStrategy
 {
 public:
+    /// Takes snapshots on a thread of its own
     ThreadedSnapshotStrategy(std::shared_ptr<PixelBuffer> const& pixels);
+
+    /// Takes snapshots, one at a time, on tasks spawned on the executor
+    ThreadedSnapshotStrategy(
+        std::shared_ptr<PixelBuffer> const& pixels,
+        std::shared_ptr<Executor> const& executor);
     ~ThreadedSnapshotStrategy() noexcept;
 
     void take_snapshot_of(
@@ -44,8 +51,8 @@ public:
 
 private:
     std::shared_ptr<PixelBuffer> const pixels;
+    std::shared_ptr<Executor> const executor;
     std::unique_ptr<SnapshottingFunctor> functor;
-    std::thread thread;
 };
 
 }
@@ -0,0 +1,306 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/thread/work_stealing_thread_pool.h"
+#include "mir/log.h"
+#include "mir/signal_blocker.h"
+#include "mir/terminate_with_current_exception.h"
+#include "mir/thread_name.h"
+
+#include <algorithm>
+
+namespace mt = mir::thread;
+
+namespace
+{
+// How many times an idle worker looks for work before going to sleep
+int const idle_spins = 64;
+
+// The pool (and worker index) the current thread belongs to, if any
+thread_local mt::WorkStealingThreadPool const* current_pool = nullptr;
+thread_local size_t current_worker = 0;
+}
+
+/*
+ * A fixed capacity Chase-Lev deque ("Correct and Efficient Work-Stealing for
+ * Weak Memory Models", Lê et al.). The owning worker pushes and pops at the
+ * bottom; other workers steal from the top.
+ */
+class mt::WorkStealingThreadPool::TaskDeque
+{
+public:
+    static int64_t const capacity = 1024;
+
+    // Owner only. Returns false (leaving work untouched) if full
+    bool push(Task&& work)
+    {
+        auto const b = bottom.load(std::memory_order_relaxed);
+        auto const t = top.load(std::memory_order_acquire);
+
+        if (b - t >= capacity)
+            return false;
+
+        Task* task;
+        if (spare_tasks.empty())
+        {
+            task = new Task{std::move(work)};
+        }
+        else
+        {
+            task = spare_tasks.back().release();
+            spare_tasks.pop_back();
+            *task = std::move(work);
+        }
+
+        slots[b % capacity].store(task, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Owner only
+    auto pop() -> Task*
+    {
+        auto const b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto t = top.load(std::memory_order_relaxed);
+
+        if (t > b)
+        {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        auto task = slots[b % capacity].load(std::memory_order_relaxed);
+
+        if (t == b)
+        {
+            // Last task: race any thieves for it
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                task = nullptr;
+
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+
+        return task;
+    }
+
+    // Any thread
+    auto steal() -> Task*
+    {
+        auto t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto const b = bottom.load(std::memory_order_acquire);
+
+        if (t >= b)
+            return nullptr;
+
+        auto const task = slots[t % capacity].load(std::memory_order_relaxed);
+
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+
+        return task;
+    }
+
+    auto size() const -> int64_t
+    {
+        return std::max<int64_t>(bottom.load(std::memory_order_relaxed) - top.load(std::memory_order_relaxed), 0);
+    }
+
+    // Owner only. Takes the work from a popped or stolen task, keeping the
+    // task to reuse in push()
+    auto reclaim(Task* task) -> Task
+    {
+        std::unique_ptr<Task> owned{task};
+        auto work = std::move(*owned);
+        *owned = nullptr;
+
+        if (spare_tasks.size() < capacity)
+            spare_tasks.push_back(std::move(owned));
+
+        return work;
+    }
+
+private:
+    std::atomic<int64_t> top{0};
+    std::atomic<int64_t> bottom{0};
+    std::atomic<Task*> slots[capacity];
+
+    std::vector<std::unique_ptr<Task>> spare_tasks;
+};
+
+int64_t const mt::WorkStealingThreadPool::TaskDeque::capacity;
+
+mt::WorkStealingThreadPool::WorkStealingThreadPool(int threads, std::string const& name)
+{
+    auto const count = std::max(threads, 1);
+
+    for (auto i = 0; i != count; ++i)
+        deques.push_back(std::make_unique<TaskDeque>());
+
+    // Workers inherit the signal mask; they should not handle signals
+    mir::SignalBlocker blocker;
+
+    for (auto i = 0; i != count; ++i)
+    {
+        workers.emplace_back([this, i, name]
+            {
+                mir::set_thread_name(name);
+                run_worker(i);
+            });
+    }
+}
+
+mt::WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{sleep_mutex};
+        stopping = true;
+    }
+    wakeup.notify_all();
+
+    for (auto& worker : workers)
+        worker.join();
+}
+
+void mt::WorkStealingThreadPool::spawn(std::function<void()>&& work)
+{
+    spawned.fetch_add(1, std::memory_order_relaxed);
+
+    // Counted before the task is published, so running it can't take pending below zero
+    pending.fetch_add(1);
+
+    if (current_pool != this || !deques[current_worker]->push(std::move(work)))
+    {
+        std::lock_guard<std::mutex> lock{shared_mutex};
+        shared_queue.push_back(std::move(work));
+        shared_queued.fetch_add(1);
+    }
+
+    // Pairs with the sleeper incrementing sleepers before checking pending
+    if (sleepers.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock{sleep_mutex};
+        wakeup.notify_one();
+    }
+}
+
+auto mt::WorkStealingThreadPool::statistics() const -> Statistics
+{
+    return Statistics{
+        spawned.load(std::memory_order_relaxed),
+        executed.load(std::memory_order_relaxed),
+        stolen.load(std::memory_order_relaxed),
+        pending.load(std::memory_order_relaxed)};
+}
+
+void mt::WorkStealingThreadPool::run_worker(size_t index) noexcept
+try
+{
+    current_pool = this;
+    current_worker = index;
+
+    Task task;
+
+    for (;;)
+    {
+        auto found = false;
+
+        for (auto spin = 0; !found && spin != idle_spins; ++spin)
+        {
+            if (!(found = find_task(index, task)) && spin)
+                std::this_thread::yield();
+        }
+
+        if (found)
+        {
+            execute(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{sleep_mutex};
+        ++sleepers;
+        wakeup.wait(lock, [this] { return stopping || pending.load() > 0; });
+        --sleepers;
+
+        if (stopping && pending.load() == 0)
+            return;
+    }
+}
+catch (...)
+{
+    mir::terminate_with_current_exception();
+}
+
+auto mt::WorkStealingThreadPool::find_task(size_t index, Task& task) -> bool
+{
+    auto& own = *deques[index];
+
+    if (auto const popped = own.pop())
+    {
+        task = own.reclaim(popped);
+        return true;
+    }
+
+    // Avoid taking the lock while spinning on an empty queue
+    if (shared_queued.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock{shared_mutex};
+        if (!shared_queue.empty())
+        {
+            task = std::move(shared_queue.front());
+            shared_queue.pop_front();
+            shared_queued.fetch_sub(1);
+            return true;
+        }
+    }
+
+    for (auto i = 1u; i < deques.size(); ++i)
+    {
+        if (auto const stolen_task = deques[(index + i) % deques.size()]->steal())
+        {
+            task = own.reclaim(stolen_task);
+            stolen.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void mt::WorkStealingThreadPool::execute(Task& task)
+{
+    pending.fetch_sub(1);
+
+    try
+    {
+        task();
+    }
+    catch (...)
+    {
+        mir::log(
+            mir::logging::Severity::error,
+            MIR_LOG_COMPONENT,
+            std::current_exception(),
+            "Background task failed");
+    }
+
+    // Release anything the task captured now, rather than when the next task replaces it
+    task = nullptr;
+    executed.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/timer_wheel.h"
+
+#include <algorithm>
+
+namespace md = mir::detail;
+
+namespace
+{
+// Rotate so that bit "by" becomes bit 0
+std::uint64_t rotate_right(std::uint64_t bits, int by)
+{
+    return by ? (bits >> by) | (bits << (64 - by)) : bits;
+}
+}
+
+md::TimerWheel::TimerWheel()
+{
+    for (int level = 0; level != levels; ++level)
+    {
+        for (int index = 0; index != slots_per_level; ++index)
+        {
+            slots[level][index].level = level;
+            slots[level][index].index = index;
+        }
+        occupied[level] = 0;
+    }
+
+    overflow.level = overflow_level;
+}
+
+auto md::TimerWheel::now() const -> Tick
+{
+    return now_;
+}
+
+void md::TimerWheel::schedule(Timer& timer, Tick deadline)
+{
+    unlink(timer);
+    timer.deadline_ = deadline;
+    place(timer);
+}
+
+void md::TimerWheel::cancel(Timer& timer)
+{
+    unlink(timer);
+}
+
+auto md::TimerWheel::next_expiry() const -> optional_value<Tick>
+{
+    if (occupied[0] & (std::uint64_t{1} << (now_ & (slots_per_level - 1))))
+        return now_;
+
+    return next_event();
+}
+
+void md::TimerWheel::advance_to(Tick tick, std::vector<Timer*>& expired)
+{
+    for (;;)
+    {
+        // Everything in the current level-0 slot is due
+        auto& due = slots[0][now_ & (slots_per_level - 1)];
+        while (auto const timer = due.head)
+        {
+            unlink(*timer);
+            expired.push_back(timer);
+        }
+
+        if (tick <= now_)
+            return;
+
+        // Jump straight to the next tick with anything to do
+        auto const next = next_event();
+        now_ = next && next.value() < tick ? next.value() : tick;
+
+        // Move timers whose period has started down to finer levels, coarsest first
+        auto const top_shift = (levels - 1) * bits_per_level;
+        if ((now_ & ((Tick{1} << top_shift) - 1)) == 0)
+            cascade(overflow);
+
+        for (int level = levels - 1; level != 0; --level)
+        {
+            auto const shift = level * bits_per_level;
+            if ((now_ & ((Tick{1} << shift) - 1)) == 0)
+                cascade(slots[level][(now_ >> shift) & (slots_per_level - 1)]);
+        }
+    }
+}
+
+void md::TimerWheel::link(Slot& slot, Timer& timer)
+{
+    timer.slot = &slot;
+    timer.next = nullptr;
+    timer.prev = slot.tail;
+
+    if (slot.tail)
+        slot.tail->next = &timer;
+    else
+        slot.head = &timer;
+
+    slot.tail = &timer;
+
+    if (slot.level != overflow_level)
+        occupied[slot.level] |= std::uint64_t{1} << slot.index;
+}
+
+void md::TimerWheel::unlink(Timer& timer)
+{
+    auto const slot = timer.slot;
+
+    if (!slot)
+        return;
+
+    if (timer.prev)
+        timer.prev->next = timer.next;
+    else
+        slot->head = timer.next;
+
+    if (timer.next)
+        timer.next->prev = timer.prev;
+    else
+        slot->tail = timer.prev;
+
+    timer.prev = nullptr;
+    timer.next = nullptr;
+    timer.slot = nullptr;
+
+    if (!slot->head && slot->level != overflow_level)
+        occupied[slot->level] &= ~(std::uint64_t{1} << slot->index);
+}
+
+void md::TimerWheel::place(Timer& timer)
+{
+    // Deadlines that have already passed go in the current slot
+    auto const deadline = std::max(timer.deadline_, now_);
+
+    for (int level = 0; level != levels; ++level)
+    {
+        auto const shift = level * bits_per_level;
+        if ((deadline >> shift) - (now_ >> shift) < slots_per_level)
+        {
+            link(slots[level][(deadline >> shift) & (slots_per_level - 1)], timer);
+            return;
+        }
+    }
+
+    link(overflow, timer);
+}
+
+void md::TimerWheel::cascade(Slot& slot)
+{
+    auto timer = slot.head;
+
+    slot.head = nullptr;
+    slot.tail = nullptr;
+
+    if (slot.level != overflow_level)
+        occupied[slot.level] &= ~(std::uint64_t{1} << slot.index);
+
+    while (timer)
+    {
+        auto const next = timer->next;
+        timer->prev = nullptr;
+        timer->next = nullptr;
+        timer->slot = nullptr;
+        place(*timer);
+        timer = next;
+    }
+}
+
+auto md::TimerWheel::next_event() const -> optional_value<Tick>
+{
+    optional_value<Tick> result;
+
+    auto const consider = [&result](Tick candidate)
+        {
+            if (!result || candidate < result.value())
+                result = candidate;
+        };
+
+    for (int level = 0; level != levels; ++level)
+    {
+        auto const shift = level * bits_per_level;
+        auto const current = static_cast<int>((now_ >> shift) & (slots_per_level - 1));
+
+        // Slots after the current one, in the order the wheel reaches them
+        if (auto const pending = rotate_right(occupied[level], current) & ~std::uint64_t{1})
+            consider(((now_ >> shift) + __builtin_ctzll(pending)) << shift);
+    }
+
+    if (overflow.head)
+    {
+        auto const top_shift = (levels - 1) * bits_per_level;
+        consider(((now_ >> top_shift) + 1) << top_shift);
+    }
+
+    return result;
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "binary_trace.h"
+
+#include <fstream>
+#include <iostream>
+
+// Decodes the file written by a server run with --window-management-trace-file
+auto main(int argc, char* argv[]) -> int
+try
+{
+    if (argc != 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <trace file>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream in{argv[1], std::ios::binary};
+
+    if (!in)
+    {
+        std::cerr << "Failed to open " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    miral::BinaryTrace::decode(in, std::cout);
+    return EXIT_SUCCESS;
+}
+catch (std::exception const& error)
+{
+    std::cerr << "Error: " << error.what() << std::endl;
+    return EXIT_FAILURE;
+}
@@ -46,6 +46,7 @@ public:
     MOCK_METHOD0(started, void());
     MOCK_METHOD0(stopped, void());
     MOCK_METHOD0(scheduled, void());
+    MOCK_METHOD3(buffer_submitted, void(graphics::Renderable::ID, graphics::BufferID, uint64_t));
 };
 
 } // namespace doubles
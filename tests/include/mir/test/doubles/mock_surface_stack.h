@@ -34,6 +34,13 @@ namespace doubles
 
 struct MockSurfaceStack : public shell::SurfaceStack
 {
+    MockSurfaceStack()
+    {
+        using namespace ::testing;
+        ON_CALL(*this, apply_transaction(_))
+            .WillByDefault(Invoke([](std::function<void()> const& changes) { changes(); }));
+    }
+
     MOCK_METHOD1(raise, void(std::weak_ptr<scene::Surface> const&));
     MOCK_METHOD1(raise, void(SurfaceSet const&));
 
@@ -41,6 +48,7 @@ struct MockSurfaceStack : public shell::SurfaceStack
 
     MOCK_METHOD1(remove_surface, void(std::weak_ptr<scene::Surface> const& surface));
     MOCK_CONST_METHOD1(surface_at, std::shared_ptr<scene::Surface>(geometry::Point));
+    MOCK_METHOD1(apply_transaction, void(std::function<void()> const& changes));
 };
 
 }
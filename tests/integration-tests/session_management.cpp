@@ -73,6 +73,11 @@ struct TestSurfaceStack : public msh::SurfaceStack
         return wrapped->surface_at(point);
     }
 
+    void apply_transaction(std::function<void()> const& changes) override
+    {
+        wrapped->apply_transaction(changes);
+    }
+
     void default_add_surface(
         std::shared_ptr<ms::Surface> const& surface,
         mir::input::InputReceptionMode input_mode)
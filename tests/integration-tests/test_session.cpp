@@ -28,6 +28,7 @@
 #include "mir/renderer/renderer.h"
 #include "mir/renderer/renderer_factory.h"
 #include "mir/frontend/connector.h"
+#include "mir/main_loop.h"
 
 #include "mir/test/doubles/stub_buffer_allocator.h"
 #include "mir/test/doubles/stub_gl_buffer.h"
@@ -105,7 +106,8 @@ TEST(ApplicationSession, stress_test_take_snapshot)
         std::make_shared<ms::NullSessionListener>(),
         mtd::StubDisplayConfig{},
         std::make_shared<mtd::NullEventSink>(),
-        conf.the_buffer_allocator()
+        conf.the_buffer_allocator(),
+        conf.the_main_loop()
     };
 
     mg::BufferProperties properties(geom::Size{1,1}, mir_pixel_format_abgr_8888, mg::BufferUsage::software);
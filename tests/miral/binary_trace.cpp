@@ -0,0 +1,270 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "binary_trace.h"
+
+#include <miral/window.h>
+
+#include <mir/test/doubles/stub_surface.h>
+#include <mir_toolkit/common.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace testing;
+using miral::BinaryTrace;
+
+namespace
+{
+struct NamedSurface : mir::test::doubles::StubSurface
+{
+    std::string name() const override { ++name_queries; return surface_name; }
+
+    std::string surface_name{"terminal"};
+    int mutable name_queries = 0;
+};
+
+struct BinaryTraceTest : Test
+{
+    BinaryTrace trace{16};
+
+    void record(char const* format, std::vector<BinaryTrace::Arg> const& args)
+    {
+        BinaryTrace::Record record{};
+        record.format = trace.intern_literal(format);
+        record.arg_count = args.size();
+        std::copy(begin(args), end(args), record.args);
+        trace.append(record);
+    }
+
+    auto text(char const* value) -> BinaryTrace::Arg
+    {
+        BinaryTrace::Arg arg{};
+        arg.kind = BinaryTrace::Kind::text;
+        arg.value[0] = trace.intern_literal(value);
+        return arg;
+    }
+
+    auto decoded_lines() -> std::vector<std::string>
+    {
+        std::stringstream binary;
+        trace.write(binary);
+        return decoded_lines(binary);
+    }
+
+    static auto decoded_lines(std::istream& binary) -> std::vector<std::string>
+    {
+        std::stringstream decoded;
+        BinaryTrace::decode(binary, decoded);
+
+        std::vector<std::string> result;
+        for (std::string line; std::getline(decoded, line);)
+        {
+            // Strip the "[timestamp] <thread> " prefix
+            result.push_back(line.substr(line.find("> ") + 2));
+        }
+        return result;
+    }
+};
+}
+
+TEST_F(BinaryTraceTest, decodes_to_the_text_format)
+{
+    BinaryTrace::Arg point{};
+    point.kind = BinaryTrace::Kind::point;
+    point.value[0] = 10;
+    point.value[1] = 20;
+
+    BinaryTrace::Arg edge{};
+    edge.kind = BinaryTrace::Kind::hex;
+    edge.value[0] = 0xa;
+
+    BinaryTrace::Arg info{};
+    info.kind = BinaryTrace::Kind::window_info;
+    info.value[0] = trace.intern("terminal");
+    info.value[1] = mir_window_type_normal;
+    info.value[2] = mir_window_state_restored;
+    info.value[3] = 1;
+    info.value[4] = 2;
+    info.value[5] = 640;
+    info.value[6] = 480;
+
+    record("%s cursor=%s", {text("window_at"), point});
+    record("%s window_info=%s, edge=0x%s", {text("handle_request_resize"), info, edge});
+    record("====", {});
+
+    EXPECT_THAT(decoded_lines(), ElementsAre(
+        "window_at cursor=(10, 20)",
+        "handle_request_resize window_info="
+            "{name=terminal, type=mir_window_type_normal, state=mir_window_state_restored, "
+            "top_left=(1, 2), size=(640, 480)}, edge=0xa",
+        "===="));
+}
+
+TEST_F(BinaryTraceTest, window_specification_shows_only_the_fields_set)
+{
+    BinaryTrace::Arg spec{};
+    spec.kind = BinaryTrace::Kind::window_specification;
+    spec.value[0] = BinaryTrace::spec_name | BinaryTrace::spec_size;
+    spec.value[1] = trace.intern("dialog");
+    spec.value[6] = 100;
+    spec.value[7] = 50;
+
+    record("%s modifications=%s", {text("modify_window"), spec});
+
+    EXPECT_THAT(decoded_lines(), ElementsAre("modify_window modifications={name=dialog, size=(100, 50)}"));
+}
+
+TEST_F(BinaryTraceTest, keeps_only_the_most_recent_records_of_a_thread)
+{
+    BinaryTrace::Arg count{};
+    count.kind = BinaryTrace::Kind::integer;
+
+    for (count.value[0] = 0; count.value[0] != 20; ++count.value[0])
+        record("%s", {count});
+
+    auto const lines = decoded_lines();
+
+    ASSERT_THAT(lines.size(), Eq(16u));
+    EXPECT_THAT(lines.front(), Eq("4"));
+    EXPECT_THAT(lines.back(), Eq("19"));
+}
+
+TEST_F(BinaryTraceTest, records_from_each_thread_are_kept)
+{
+    record("%s", {text("main")});
+    std::thread{[this] { record("%s", {text("other")}); }}.join();
+
+    EXPECT_THAT(decoded_lines(), UnorderedElementsAre("main", "other"));
+}
+
+TEST_F(BinaryTraceTest, window_names_are_looked_up_until_forgotten)
+{
+    auto const surface = std::make_shared<NamedSurface>();
+    miral::Window const window{nullptr, surface};
+
+    auto const id = trace.intern_name_of(window, *surface);
+    EXPECT_THAT(trace.intern_name_of(window, *surface), Eq(id));
+    EXPECT_THAT(surface->name_queries, Eq(1));
+
+    surface->surface_name = "renamed";
+    trace.forget_window_names();
+
+    EXPECT_THAT(trace.intern_name_of(window, *surface), Eq(trace.intern("renamed")));
+    EXPECT_THAT(surface->name_queries, Eq(2));
+}
+
+TEST_F(BinaryTraceTest, rejects_other_files)
+{
+    std::stringstream not_a_trace{"This is not a trace"};
+    std::stringstream decoded;
+
+    EXPECT_THROW(BinaryTrace::decode(not_a_trace, decoded), std::runtime_error);
+}
+
+TEST_F(BinaryTraceTest, stops_adding_strings_when_the_table_is_full)
+{
+    BinaryTrace small_table{16, 4};
+
+    auto const format = small_table.intern_literal("%s");
+    auto const kept = small_table.intern("kept");
+    small_table.intern("also kept");
+    auto const dropped = small_table.intern("dropped");
+
+    EXPECT_THAT(small_table.intern("kept"), Eq(kept));
+    EXPECT_THAT(small_table.intern("dropped"), Eq(dropped));
+    EXPECT_THAT(small_table.intern_literal("literals are still added"), Ne(dropped));
+
+    for (auto const id : {kept, dropped})
+    {
+        BinaryTrace::Record record{};
+        record.format = format;
+        record.arg_count = 1;
+        record.args[0].kind = BinaryTrace::Kind::text;
+        record.args[0].value[0] = id;
+        small_table.append(record);
+    }
+
+    std::stringstream binary;
+    small_table.write(binary);
+
+    EXPECT_THAT(decoded_lines(binary), ElementsAre("kept", "(string table full)"));
+}
+
+TEST_F(BinaryTraceTest, records_copied_while_being_overwritten_are_left_out)
+{
+    std::atomic<bool> done{false};
+
+    std::thread writer{[&]
+        {
+            BinaryTrace::Arg count{};
+            count.kind = BinaryTrace::Kind::integer;
+
+            while (!done)
+            {
+                ++count.value[0];
+                record("%s %s", {count, count});
+            }
+        }};
+
+    for (auto i = 0; i != 100; ++i)
+    {
+        for (auto const& line : decoded_lines())
+        {
+            auto const space = line.find(' ');
+            ASSERT_THAT(line.substr(0, space), Eq(line.substr(space + 1)));
+        }
+    }
+
+    done = true;
+    writer.join();
+}
+
+TEST(BinaryTraceFile, is_written_before_the_trace_is_released)
+{
+    auto const filename = testing::TempDir() + "binary_trace_file_test";
+    auto const trace = miral::make_binary_trace_file(filename, 16, std::chrono::milliseconds{10});
+
+    BinaryTrace::Record record{};
+    record.format = trace->intern_literal("recorded");
+    trace->append(record);
+
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    std::vector<std::string> lines;
+
+    while (lines.empty() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+
+        std::ifstream file{filename, std::ios::binary};
+        std::stringstream decoded;
+        BinaryTrace::decode(file, decoded);
+
+        for (std::string line; std::getline(decoded, line);)
+            lines.push_back(line.substr(line.find("> ") + 2));
+    }
+
+    EXPECT_THAT(lines, ElementsAre("recorded"));
+
+    std::remove(filename.c_str());
+}
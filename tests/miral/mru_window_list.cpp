@@ -18,21 +18,43 @@
 
 #include "mru_window_list.h"
 
+#include <mir/scene/surface_observer.h>
 #include <mir/test/doubles/stub_surface.h>
 #include <mir/test/doubles/stub_session.h>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <algorithm>
+
 using namespace testing;
 
 namespace
 {
 struct StubSurface : mir::test::doubles::StubSurface
 {
-    bool visible() const override { return visible_; }
+    bool visible() const override { ++visible_queries; return visible_; }
+
+    void add_observer(std::shared_ptr<mir::scene::SurfaceObserver> const& observer) override
+    {
+        observers.push_back(observer);
+    }
+
+    void remove_observer(std::weak_ptr<mir::scene::SurfaceObserver> const& observer) override
+    {
+        observers.erase(std::remove(observers.begin(), observers.end(), observer.lock()), observers.end());
+    }
+
+    void set_visible(bool visible)
+    {
+        visible_ = visible;
+        for (auto const& observer : observers)
+            observer->hidden_set_to(this, !visible);
+    }
 
     bool visible_ = true;
+    int mutable visible_queries = 0;
+    std::vector<std::shared_ptr<mir::scene::SurfaceObserver>> observers;
 };
 
 struct StubSession : mir::test::doubles::StubSession
@@ -72,12 +94,12 @@ struct MRUWindowList : testing::Test
 
     void hide_window(int window_id)
     {
-        stub_session->surfaces[window_id]->visible_ = false;
+        stub_session->surfaces[window_id]->set_visible(false);
     }
 
     void show_window(int window_id)
     {
-        stub_session->surfaces[window_id]->visible_ = true;
+        stub_session->surfaces[window_id]->set_visible(true);
     }
 };
 
@@ -191,3 +213,44 @@ TEST_F(MRUWindowList, hiding_then_showing_windows_retains_order)
     EXPECT_THAT(as_enumerated, ElementsAre(window_c, window_b, window_a));
 }
 
+
+TEST_F(MRUWindowList, visibility_is_only_queried_again_after_a_change_is_notified)
+{
+    mru_list.push(window_a);
+
+    auto const& surface = *stub_session->surfaces[window_a_id];
+
+    mru_list.top();
+    auto const queries = surface.visible_queries;
+
+    mru_list.top();
+    mru_list.enumerate([&](miral::Window&) { return true; });
+    EXPECT_THAT(surface.visible_queries, Eq(queries));
+
+    hide_window(window_a_id);
+    EXPECT_THAT(mru_list.top(), IsNullWindow());
+    EXPECT_THAT(surface.visible_queries, Gt(queries));
+}
+
+TEST_F(MRUWindowList, erased_window_is_no_longer_observed)
+{
+    mru_list.push(window_a);
+    mru_list.erase(window_a);
+
+    EXPECT_THAT(stub_session->surfaces[window_a_id]->observers, IsEmpty());
+}
+
+TEST_F(MRUWindowList, window_can_be_erased_after_its_surface_is_destroyed)
+{
+    mru_list.push(window_a);
+    mru_list.push(window_b);
+
+    std::weak_ptr<mir::scene::SurfaceObserver> const tracker = stub_session->surfaces[window_a_id]->observers.front();
+    stub_session->surfaces[window_a_id].reset();
+    ASSERT_FALSE(window_a);
+
+    mru_list.erase(window_a);
+
+    EXPECT_TRUE(tracker.expired());
+    EXPECT_THAT(mru_list.top(), Eq(window_b));
+}
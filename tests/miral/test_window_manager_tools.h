@@ -29,12 +29,14 @@
 #include <mir/shell/persistent_surface_store.h>
 
 #include <mir/test/doubles/stub_session.h>
+#include <mir/scene/surface_observer.h>
 #include <mir/test/doubles/stub_surface.h>
 #include <mir/test/fake_shared.h>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <algorithm>
 #include <atomic>
 
 struct StubFocusController : mir::shell::FocusController
@@ -51,6 +53,8 @@ struct StubFocusController : mir::shell::FocusController
 
     void raise(mir::shell::SurfaceSet const& /*windows*/) override {}
 
+    void apply_transaction(std::function<void()> const& changes) override { changes(); }
+
     virtual auto surface_at(mir::geometry::Point /*cursor*/) const -> std::shared_ptr<mir::scene::Surface> override
         { return {}; }
 
@@ -96,6 +100,8 @@ struct StubSurface : mir::test::doubles::StubSurface
         {
         case mir_window_attrib_state:
             state_ = MirWindowState(value);
+            for (auto const& observer : observers)
+                observer->attrib_changed(this, attrib, value);
             return state_;
         default:
             return value;
@@ -104,11 +110,22 @@ struct StubSurface : mir::test::doubles::StubSurface
 
     bool visible() const override { return  state() != mir_window_state_hidden; }
 
+    void add_observer(std::shared_ptr<mir::scene::SurfaceObserver> const& observer) override
+    {
+        observers.push_back(observer);
+    }
+
+    void remove_observer(std::weak_ptr<mir::scene::SurfaceObserver> const& observer) override
+    {
+        observers.erase(std::remove(observers.begin(), observers.end(), observer.lock()), observers.end());
+    }
+
     std::string name_;
     MirWindowType type_;
     mir::geometry::Point top_left_;
     mir::geometry::Size size_;
     MirWindowState state_ = mir_window_state_restored;
+    std::vector<std::shared_ptr<mir::scene::SurfaceObserver>> observers;
 };
 
 struct StubStubSession : mir::test::doubles::StubSession
@@ -128,6 +145,18 @@ struct StubStubSession : mir::test::doubles::StubSession
         return surfaces.at(surface);
     }
 
+    void destroy_surface(std::weak_ptr<mir::scene::Surface> const& surface) override
+    {
+        for (auto i = surfaces.begin(); i != surfaces.end(); ++i)
+        {
+            if (i->second == surface.lock())
+            {
+                surfaces.erase(i);
+                return;
+            }
+        }
+    }
+
 private:
     std::atomic<int> next_surface_id;
     std::map<mir::frontend::SurfaceId, std::shared_ptr<mir::scene::Surface>> surfaces;
@@ -0,0 +1,114 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "test_window_manager_tools.h"
+
+using namespace miral;
+using namespace testing;
+
+namespace
+{
+Rectangle const display_area{{0, 0}, {640, 480}};
+
+struct WindowInfoLookup : TestWindowManagerTools
+{
+    std::vector<Window> windows;
+
+    void SetUp() override
+    {
+        basic_window_manager.add_display_for_testing(display_area);
+        basic_window_manager.add_session(session);
+
+        ON_CALL(*window_manager_policy, advise_new_window(_))
+            .WillByDefault(Invoke([this](WindowInfo const& window_info){ windows.push_back(window_info.window()); }));
+    }
+
+    void add_windows(int count)
+    {
+        mir::scene::SurfaceCreationParameters creation_parameters;
+        creation_parameters.size = Size{100, 100};
+
+        for (int i = 0; i != count; ++i)
+            basic_window_manager.add_surface(session, creation_parameters, &create_surface);
+    }
+};
+}
+
+TEST_F(WindowInfoLookup, info_for_window_and_surface_agree)
+{
+    add_windows(3);
+
+    for (auto const& window : windows)
+    {
+        auto& info = basic_window_manager.info_for(window);
+        EXPECT_THAT(info.window(), Eq(window));
+        EXPECT_THAT(&basic_window_manager.info_for(std::weak_ptr<mir::scene::Surface>(window)), Eq(&info));
+    }
+}
+
+TEST_F(WindowInfoLookup, info_references_remain_valid_when_windows_are_added)
+{
+    add_windows(1);
+    auto const& first_info = basic_window_manager.info_for(windows.front());
+
+    add_windows(200);
+
+    EXPECT_THAT(&basic_window_manager.info_for(windows.front()), Eq(&first_info));
+    EXPECT_THAT(first_info.window(), Eq(windows.front()));
+}
+
+TEST_F(WindowInfoLookup, removed_window_has_no_info)
+{
+    add_windows(2);
+    auto const removed = windows.front();
+
+    // The surface is destroyed before its info is erased
+    basic_window_manager.remove_surface(session, removed);
+
+    EXPECT_FALSE(removed);
+    EXPECT_THROW(basic_window_manager.info_for(removed), std::out_of_range);
+    EXPECT_THAT(basic_window_manager.info_for(windows.back()).window(), Eq(windows.back()));
+}
+
+TEST_F(WindowInfoLookup, info_is_found_for_a_window_whose_surface_was_destroyed)
+{
+    add_windows(2);
+    auto const window = windows.front();
+    auto& info = basic_window_manager.info_for(window);
+
+    session->destroy_surface(window);
+    ASSERT_FALSE(window);
+
+    EXPECT_THAT(&basic_window_manager.info_for(window), Eq(&info));
+}
+
+TEST_F(WindowInfoLookup, no_info_is_found_for_a_destroyed_surface)
+{
+    add_windows(2);
+    std::weak_ptr<mir::scene::Surface> const surface = windows.front();
+
+    session->destroy_surface(surface);
+
+    EXPECT_THROW(basic_window_manager.info_for(surface), std::out_of_range);
+}
+
+TEST_F(WindowInfoLookup, application_info_is_found_for_session)
+{
+    auto& info = basic_window_manager.info_for(session);
+
+    EXPECT_THAT(info.application(), Eq(session));
+    EXPECT_THAT(basic_window_manager.find_application([](ApplicationInfo const&) { return true; }), Eq(session));
+}
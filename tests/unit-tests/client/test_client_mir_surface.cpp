@@ -36,6 +36,7 @@
 #include "mir/dispatch/dispatchable.h"
 #include "mir/dispatch/threaded_dispatcher.h"
 #include "mir/events/event_builders.h"
+#include "mir/input/event_ring.h"
 
 #include "mir/frontend/connector.h"
 
@@ -60,6 +61,8 @@
 #include <atomic>
 
 #include <fcntl.h>
+#include <linux/input.h>
+#include <unistd.h>
 
 namespace mcl = mir::client;
 namespace mclr = mir::client::rpc;
@@ -618,3 +621,111 @@ TEST_F(MirClientSurfaceTest, initial_sizes_are_from_response_from_server)
     EXPECT_THAT(params.width, Eq(size.width.as_int()));
     EXPECT_THAT(params.height, Eq(size.height.as_int()));
 }
+
+namespace
+{
+// Records key events by scan code, and anything else as -1
+struct ReceivedEvents
+{
+    static void record(MirWindow*, MirEvent const* event, void* context)
+    {
+        auto const self = static_cast<ReceivedEvents*>(context);
+        int code{-1};
+
+        if (mir_event_get_type(event) == mir_event_type_input)
+        {
+            auto const input_event = mir_event_get_input_event(event);
+            if (mir_input_event_get_type(input_event) == mir_input_event_type_key)
+                code = mir_keyboard_event_scan_code(mir_input_event_get_keyboard_event(input_event));
+        }
+
+        std::lock_guard<std::mutex> lock{self->mutex};
+        self->codes.push_back(code);
+        if (self->codes.size() == self->expected)
+            self->all_received.raise();
+    }
+
+    std::mutex mutex;
+    std::vector<int> codes;
+    std::size_t expected{0};
+    mt::Signal all_received;
+};
+
+mir::EventUPtr key_event(int scan_code)
+{
+    return mir::events::make_event(
+        MirInputDeviceId{7}, std::chrono::nanoseconds{42}, std::vector<uint8_t>{},
+        mir_keyboard_action_down, 0, scan_code, mir_input_event_modifier_none);
+}
+}
+
+TEST_F(MirClientSurfaceTest, delivers_input_from_shared_memory)
+{
+    using namespace testing;
+
+    mir::input::EventRing ring{16};
+    surface_proto.add_fd(dup(ring.shm_fd()));
+    surface_proto.add_fd(dup(ring.wakeup_fd()));
+
+    ReceivedEvents received;
+    received.expected = 1;
+
+    auto ring_spec = spec;
+    ring_spec.shared_memory_input = true;
+    ring_spec.event_handler = MirWindowSpec::EventHandler{&ReceivedEvents::record, &received};
+
+    MirWindow surface{connection.get(), *client_comm_channel, nullptr,
+        stub_buffer_stream, ring_spec, surface_proto, wh};
+
+    ring.push(*key_event(KEY_A));
+
+    ASSERT_TRUE(received.all_received.wait_for(std::chrono::seconds{5}));
+    EXPECT_THAT(received.codes, ElementsAre(KEY_A));
+}
+
+TEST_F(MirClientSurfaceTest, delivers_input_from_shared_memory_before_later_events_from_the_socket)
+{
+    using namespace testing;
+
+    mir::input::EventRing ring{16};
+    surface_proto.add_fd(dup(ring.shm_fd()));
+    surface_proto.add_fd(dup(ring.wakeup_fd()));
+
+    ReceivedEvents received;
+    received.expected = 3;
+
+    auto ring_spec = spec;
+    ring_spec.shared_memory_input = true;
+    ring_spec.event_handler = MirWindowSpec::EventHandler{&ReceivedEvents::record, &received};
+
+    MirWindow surface{connection.get(), *client_comm_channel, nullptr,
+        stub_buffer_stream, ring_spec, surface_proto, wh};
+
+    ring.push(*key_event(KEY_A));
+    ring.push(*key_event(KEY_B));
+    surface.handle_event(*mir::events::make_event(mir::frontend::SurfaceId{1}, mir_orientation_left));
+
+    ASSERT_TRUE(received.all_received.wait_for(std::chrono::seconds{5}));
+    EXPECT_THAT(received.codes, ElementsAre(KEY_A, KEY_B, -1));
+}
+
+TEST_F(MirClientSurfaceTest, tells_the_server_when_it_has_handled_input_that_bypassed_shared_memory)
+{
+    using namespace testing;
+
+    mir::input::EventRing ring{16};
+    surface_proto.add_fd(dup(ring.shm_fd()));
+    surface_proto.add_fd(dup(ring.wakeup_fd()));
+
+    auto ring_spec = spec;
+    ring_spec.shared_memory_input = true;
+
+    MirWindow surface{connection.get(), *client_comm_channel, nullptr,
+        stub_buffer_stream, ring_spec, surface_proto, wh};
+
+    surface.handle_event(*mir::events::make_event(mir::frontend::SurfaceId{1}, mir_orientation_left));
+    EXPECT_THAT(ring.bypasses_consumed(), Eq(0u));
+
+    surface.handle_event(*key_event(KEY_A));
+    EXPECT_THAT(ring.bypasses_consumed(), Eq(1u));
+}
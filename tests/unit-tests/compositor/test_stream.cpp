@@ -19,6 +19,7 @@
 #include "mir/test/doubles/stub_buffer.h"
 #include "mir/test/doubles/stub_buffer_allocator.h"
 #include "mir/test/doubles/mock_event_sink.h"
+#include "mir/test/doubles/mock_compositor_report.h"
 #include "mir/test/fake_shared.h"
 #include "src/server/compositor/stream.h"
 #include "mir/scene/null_surface_observer.h"
@@ -226,3 +227,18 @@ TEST_F(Stream, returns_buffers_to_client_when_told_to_bring_queue_up_to_date)
     EXPECT_THAT(buffers[1].use_count(), Eq(1));
     EXPECT_THAT(buffers[2].use_count(), Eq(2));
 }
+
+TEST_F(Stream, reports_submitted_buffers_in_sequence)
+{
+    auto const report = std::make_shared<NiceMock<mtd::MockCompositorReport>>();
+    mc::Stream reporting_stream{initial_size, construction_format, report};
+    mc::BufferStream* const as_renderable_source{&reporting_stream};
+
+    InSequence seq;
+    EXPECT_CALL(*report, buffer_submitted(as_renderable_source, buffers[0]->id(), 1));
+    EXPECT_CALL(*report, buffer_submitted(as_renderable_source, buffers[1]->id(), 2));
+    EXPECT_CALL(*report, buffer_submitted(as_renderable_source, buffers[2]->id(), 3));
+
+    for (auto& buffer : buffers)
+        reporting_stream.submit_buffer(buffer);
+}
@@ -19,10 +19,17 @@
 #include "mir/dispatch/action_queue.h"
 
 #include "mir/test/fd_utils.h"
+#include "mir/test/signal.h"
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 namespace mt = mir::test;
 namespace md = mir::dispatch;
 using namespace ::testing;
@@ -79,3 +86,86 @@ TEST(ActionQueue, executes_action_only_once)
 }
 
 
+
+TEST(ActionQueue, executes_all_queued_actions_in_order_on_one_dispatch)
+{
+    md::ActionQueue queue;
+
+    std::vector<int> executed;
+
+    for (int i = 0; i != 5; ++i)
+        queue.enqueue([&executed, i](){executed.push_back(i);});
+
+    queue.dispatch(md::FdEvent::readable);
+
+    EXPECT_THAT(executed, ElementsAre(0, 1, 2, 3, 4));
+    EXPECT_FALSE(mt::fd_is_readable(queue.watch_fd()));
+}
+
+TEST(ActionQueue, action_enqueued_by_an_action_is_executed_on_next_dispatch)
+{
+    md::ActionQueue queue;
+
+    auto inner_executed = false;
+
+    queue.enqueue([&](){ queue.enqueue([&](){inner_executed = true;}); });
+    queue.dispatch(md::FdEvent::readable);
+
+    EXPECT_FALSE(inner_executed);
+    ASSERT_TRUE(mt::fd_is_readable(queue.watch_fd()));
+
+    queue.dispatch(md::FdEvent::readable);
+    EXPECT_TRUE(inner_executed);
+}
+
+TEST(ActionQueue, actions_after_a_throwing_action_are_executed_on_next_dispatch)
+{
+    md::ActionQueue queue;
+
+    auto later_executed = false;
+
+    queue.enqueue([](){ throw std::runtime_error{"action failed"}; });
+    queue.enqueue([&](){later_executed = true;});
+
+    EXPECT_THROW(queue.dispatch(md::FdEvent::readable), std::runtime_error);
+    EXPECT_FALSE(later_executed);
+    ASSERT_TRUE(mt::fd_is_readable(queue.watch_fd()));
+
+    queue.dispatch(md::FdEvent::readable);
+    EXPECT_TRUE(later_executed);
+}
+
+TEST(ActionQueue, concurrent_dispatch_waits_for_the_running_actions)
+{
+    md::ActionQueue queue;
+
+    mt::Signal first_started;
+    mt::Signal release_first;
+    std::atomic<bool> first_finished{false};
+    std::atomic<bool> second_ran_after_first{false};
+
+    queue.enqueue(
+        [&]
+        {
+            first_started.raise();
+            release_first.wait_for(std::chrono::seconds{5});
+            first_finished = true;
+        });
+
+    std::thread first_dispatch{[&]{ queue.dispatch(md::FdEvent::readable); }};
+    ASSERT_TRUE(first_started.wait_for(std::chrono::seconds{5}));
+
+    queue.enqueue([&]{ second_ran_after_first = first_finished.load(); });
+    ASSERT_TRUE(mt::fd_is_readable(queue.watch_fd()));
+
+    std::thread second_dispatch{[&]{ queue.dispatch(md::FdEvent::readable); }};
+
+    // Give the second dispatch time to run its action, if it doesn't wait
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    release_first.raise();
+
+    first_dispatch.join();
+    second_dispatch.join();
+
+    EXPECT_TRUE(second_ran_after_first);
+}
@@ -29,6 +29,7 @@
 
 #include <atomic>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -490,3 +491,68 @@ TEST(MultiplexingDispatchableTest, automatic_removals_are_threadsafe)
     
     dispatchee->trigger();
 }
+
+TEST(MultiplexingDispatchableTest, dispatches_all_ready_dispatchees_in_one_call)
+{
+    int const dispatchee_count{3};
+    int dispatched{0};
+
+    md::MultiplexingDispatchable dispatcher;
+    std::vector<std::shared_ptr<mt::TestDispatchable>> dispatchees;
+    for (int i = 0; i != dispatchee_count; ++i)
+    {
+        dispatchees.push_back(std::make_shared<mt::TestDispatchable>([&dispatched]() { ++dispatched; }));
+        dispatcher.add_watch(dispatchees.back());
+        dispatchees.back()->trigger();
+    }
+
+    ASSERT_TRUE(mt::fd_is_readable(dispatcher.watch_fd()));
+    dispatcher.dispatch(md::FdEvent::readable);
+
+    EXPECT_THAT(dispatched, testing::Eq(dispatchee_count));
+    EXPECT_FALSE(mt::fd_is_readable(dispatcher.watch_fd()));
+}
+
+TEST(MultiplexingDispatchableTest, dispatches_a_limited_number_of_dispatchees_per_call)
+{
+    int const dispatchee_count{md::MultiplexingDispatchable::max_events_per_dispatch + 4};
+    int dispatched{0};
+
+    md::MultiplexingDispatchable dispatcher;
+    std::vector<std::shared_ptr<mt::TestDispatchable>> dispatchees;
+    for (int i = 0; i != dispatchee_count; ++i)
+    {
+        dispatchees.push_back(std::make_shared<mt::TestDispatchable>([&dispatched]() { ++dispatched; }));
+        dispatcher.add_watch(dispatchees.back());
+        dispatchees.back()->trigger();
+    }
+
+    dispatcher.dispatch(md::FdEvent::readable);
+
+    EXPECT_THAT(dispatched, testing::Eq(md::MultiplexingDispatchable::max_events_per_dispatch));
+    EXPECT_TRUE(mt::fd_is_readable(dispatcher.watch_fd()));
+
+    dispatcher.dispatch(md::FdEvent::readable);
+
+    EXPECT_THAT(dispatched, testing::Eq(dispatchee_count));
+}
+
+TEST(MultiplexingDispatchableTest, does_not_dispatch_dispatchee_removed_by_earlier_dispatch_in_same_call)
+{
+    md::MultiplexingDispatchable dispatcher;
+    std::shared_ptr<mt::TestDispatchable> first, second;
+    int dispatched{0};
+
+    first = std::make_shared<mt::TestDispatchable>([&]() { ++dispatched; dispatcher.remove_watch(second); });
+    second = std::make_shared<mt::TestDispatchable>([&]() { ++dispatched; dispatcher.remove_watch(first); });
+
+    dispatcher.add_watch(first);
+    dispatcher.add_watch(second);
+    first->trigger();
+    second->trigger();
+
+    ASSERT_TRUE(mt::fd_is_readable(dispatcher.watch_fd()));
+    dispatcher.dispatch(md::FdEvent::readable);
+
+    EXPECT_THAT(dispatched, testing::Eq(1));
+}
@@ -24,6 +24,9 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <mutex>
+#include <vector>
+
 namespace mt = mir::test;
 
 namespace
@@ -33,10 +36,14 @@ struct StubConnectorReport : mir::report::null::ConnectorReport
 {
     void thread_start()
     {
+        std::lock_guard<std::mutex> lock{mutex};
         thread_name = mt::current_thread_name();
+        thread_names.push_back(thread_name);
     }
 
+    std::mutex mutex;
     std::string thread_name;
+    std::vector<std::string> thread_names;
 };
 
 }
@@ -47,10 +54,33 @@ TEST(BasicConnector, names_ipc_threads)
 
     StubConnectorReport report;
 
-    mir::frontend::BasicConnector connector{{}, mt::fake_shared(report)};
+    mir::frontend::BasicConnector connector{{}, 1, mt::fake_shared(report)};
 
     connector.start();
     connector.stop();
 
     EXPECT_THAT(report.thread_name, Eq("Mir/IPC"));
 }
+
+TEST(BasicConnector, starts_requested_number_of_ipc_threads)
+{
+    using namespace testing;
+
+    StubConnectorReport report;
+
+    mir::frontend::BasicConnector connector{{}, 4, mt::fake_shared(report)};
+
+    connector.start();
+    connector.stop();
+
+    EXPECT_THAT(report.thread_names, ElementsAre("Mir/IPC", "Mir/IPC", "Mir/IPC", "Mir/IPC"));
+}
+
+TEST(BasicConnector, rejects_empty_thread_pool)
+{
+    StubConnectorReport report;
+
+    EXPECT_THROW(
+        (mir::frontend::BasicConnector{{}, 0, mt::fake_shared(report)}),
+        std::invalid_argument);
+}
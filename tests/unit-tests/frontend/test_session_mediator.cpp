@@ -72,6 +72,9 @@
 #include "mir/cookie/authority.h"
 #include "mir/input/mir_input_config.h"
 #include "mir/input/mir_input_config_serialization.h"
+#include "mir/input/event_ring.h"
+#include "mir/events/event_builders.h"
+#include "mir/test/event_matchers.h"
 #include "mir_protobuf.pb.h"
 #include "mir_protobuf_wire.pb.h"
 
@@ -84,6 +87,9 @@
 #include <stdexcept>
 #include <algorithm>
 
+#include <linux/input.h>
+#include <unistd.h>
+
 namespace mf = mir::frontend;
 namespace mg = mir::graphics;
 namespace mi = mir::input;
@@ -816,6 +822,37 @@ MATCHER(InputRegionSet, "input region set")
 {
     return arg.input_shape.is_set();
 }
+TEST_F(SessionMediator, sends_input_through_shared_memory_when_requested)
+{
+    using namespace testing;
+
+    std::shared_ptr<mf::EventSink> surface_sink;
+    ON_CALL(*shell, create_surface(_, _, _))
+        .WillByDefault(
+            Invoke([&surface_sink, session = stubbed_session.get()](auto, auto params, auto sink)
+                   {
+                       surface_sink = sink;
+                       return session->create_surface(params, sink);
+                   }));
+
+    surface_parameters.set_shared_memory_input(true);
+
+    mediator.connect(&connect_parameters, &connection, null_callback.get());
+    mediator.create_surface(&surface_parameters, &surface_response, null_callback.get());
+
+    // The ring's shared memory and wakeup fds come last
+    auto const fds = surface_response.fd_size();
+    ASSERT_THAT(fds, Ge(2));
+    mi::EventRing ring{mir::Fd{dup(surface_response.fd(fds - 2))}, mir::Fd{dup(surface_response.fd(fds - 1))}};
+
+    ASSERT_THAT(surface_sink, NotNull());
+    surface_sink->handle_event(mir::events::make_event(
+        MirInputDeviceId{7}, std::chrono::nanoseconds{42}, std::vector<uint8_t>{},
+        mir_keyboard_action_down, 0, KEY_A, mir_input_event_modifier_none));
+
+    EXPECT_THAT(ring.pop(), Pointee(mt::KeyOfScanCode(KEY_A)));
+}
+
 TEST_F(SessionMediator, does_not_reset_input_region_if_region_not_set)
 {
     using namespace testing;
@@ -0,0 +1,110 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "src/server/frontend/shared_memory_input_sink.h"
+#include "mir/input/event_ring.h"
+#include "mir/events/event_builders.h"
+
+#include "mir/test/doubles/mock_event_sink.h"
+#include "mir/test/event_matchers.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <linux/input.h>
+
+namespace mev = mir::events;
+namespace mf = mir::frontend;
+namespace mi = mir::input;
+namespace mt = mir::test;
+namespace mtd = mir::test::doubles;
+using namespace testing;
+
+namespace
+{
+struct SharedMemoryInputSink : Test
+{
+    mir::EventUPtr key_event(int scan_code)
+    {
+        return mev::make_event(
+            MirInputDeviceId{7}, std::chrono::nanoseconds{42}, std::vector<uint8_t>{},
+            mir_keyboard_action_down, 0, scan_code, mir_input_event_modifier_none);
+    }
+
+    std::shared_ptr<mi::EventRing> const producer{std::make_shared<mi::EventRing>(2)};
+    mi::EventRing consumer{producer->shm_fd(), producer->wakeup_fd()};
+    std::shared_ptr<NiceMock<mtd::MockEventSink>> const socket{std::make_shared<NiceMock<mtd::MockEventSink>>()};
+    mf::SharedMemoryInputSink sink{producer, socket};
+};
+}
+
+TEST_F(SharedMemoryInputSink, sends_input_through_the_ring)
+{
+    EXPECT_CALL(*socket, handle_event(_)).Times(0);
+
+    sink.handle_event(key_event(KEY_A));
+
+    EXPECT_THAT(consumer.pop(), Pointee(mt::KeyOfScanCode(KEY_A)));
+}
+
+TEST_F(SharedMemoryInputSink, sends_other_events_through_the_socket)
+{
+    EXPECT_CALL(*socket, handle_event(mt::OrientationEvent(mir_orientation_left)));
+
+    sink.handle_event(mev::make_event(mf::SurfaceId{1}, mir_orientation_left));
+
+    EXPECT_THAT(consumer.pop(), IsNull());
+}
+
+TEST_F(SharedMemoryInputSink, when_the_ring_is_full_sends_input_through_the_socket)
+{
+    InSequence seq;
+    EXPECT_CALL(*socket, handle_event(mt::KeyOfScanCode(KEY_C)));
+    EXPECT_CALL(*socket, handle_event(mt::KeyOfScanCode(KEY_D)));
+
+    sink.handle_event(key_event(KEY_A));
+    sink.handle_event(key_event(KEY_B));
+    sink.handle_event(key_event(KEY_C));
+
+    // Even though there's room again, KEY_D must not overtake KEY_C
+    EXPECT_THAT(consumer.pop(), Pointee(mt::KeyOfScanCode(KEY_A)));
+    EXPECT_THAT(consumer.pop(), Pointee(mt::KeyOfScanCode(KEY_B)));
+
+    sink.handle_event(key_event(KEY_D));
+
+    EXPECT_THAT(consumer.pop(), IsNull());
+}
+
+TEST_F(SharedMemoryInputSink, uses_the_ring_again_once_the_client_has_handled_the_socket_input)
+{
+    EXPECT_CALL(*socket, handle_event(mt::KeyOfScanCode(KEY_C)));
+    EXPECT_CALL(*socket, handle_event(mt::KeyOfScanCode(KEY_D)));
+
+    sink.handle_event(key_event(KEY_A));
+    sink.handle_event(key_event(KEY_B));
+    sink.handle_event(key_event(KEY_C));
+    consumer.pop();
+    consumer.pop();
+    sink.handle_event(key_event(KEY_D));
+
+    // The client handles KEY_C and KEY_D from the socket
+    consumer.bypass_consumed();
+    consumer.bypass_consumed();
+
+    sink.handle_event(key_event(KEY_E));
+    EXPECT_THAT(consumer.pop(), Pointee(mt::KeyOfScanCode(KEY_E)));
+}
@@ -22,6 +22,8 @@
 #include "mir/graphics/platform.h"
 #include "mir/graphics/platform_probe.h"
 #include "mir/options/program_option.h"
+#include "mir/probe_cache.h"
+#include "mir/shared_library_prober_report.h"
 
 #include "mir/raii.h"
 
@@ -38,6 +40,11 @@
 #include "mir_test_framework/udev_environment.h"
 #include "mir_test_framework/executable_path.h"
 
+#include <boost/filesystem.hpp>
+#include <gmock/gmock.h>
+
+#include <fstream>
+
 namespace mtd = mir::test::doubles;
 namespace mtf = mir_test_framework;
 
@@ -134,6 +141,48 @@ public:
     }
 };
 
+class MockSharedLibraryProberReport : public mir::SharedLibraryProberReport
+{
+public:
+    MOCK_METHOD1(probing_path, void(boost::filesystem::path const&));
+    MOCK_METHOD2(probing_failed, void(boost::filesystem::path const&, std::exception const&));
+    MOCK_METHOD1(loading_library, void(boost::filesystem::path const&));
+    MOCK_METHOD2(loading_failed, void(boost::filesystem::path const&, std::exception const&));
+};
+
+// A module path holding just the dummy platform, and a cache of probe results
+struct ServerPlatformProbeCache : public ::testing::Test
+{
+    ServerPlatformProbeCache()
+        : directory{boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("mir_probe_cache_%%%%%%")}
+    {
+        boost::filesystem::create_directories(modules);
+        boost::filesystem::create_symlink(
+            mtf::server_platform("graphics-dummy.so"),
+            modules / "graphics-dummy.so");
+    }
+
+    ~ServerPlatformProbeCache()
+    {
+        boost::system::error_code ignored;
+        boost::filesystem::remove_all(directory, ignored);
+    }
+
+    auto module_for_device() -> std::shared_ptr<mir::SharedLibrary>
+    {
+        return mir::graphics::module_for_device(
+            modules.string(), cache, options, std::make_shared<mtd::NullConsoleServices>(), report);
+    }
+
+    std::shared_ptr<void> const block_mesa = ensure_mesa_probing_fails();
+    boost::filesystem::path const directory;
+    boost::filesystem::path const modules{directory / "modules"};
+    std::string const cache_file{(directory / "graphics-platform").string()};
+    mir::ProbeCache const cache{cache_file};
+    mir::options::ProgramOption options;
+    testing::NiceMock<MockSharedLibraryProberReport> report;
+};
+
 class ServerPlatformProbeMockDRM : public ::testing::Test
 {
 #if defined(MIR_BUILD_PLATFORM_MESA_KMS) || defined(MIR_BUILD_PLATFORM_MESA_X11)
@@ -259,3 +308,41 @@ TEST_F(ServerPlatformProbeMockDRM, IgnoresNonPlatformModules)
         std::make_shared<StubConsoleServices>());
     EXPECT_NE(nullptr, module);
 }
+
+TEST_F(ServerPlatformProbeCache, loads_only_the_cached_module_when_nothing_has_changed)
+{
+    using namespace testing;
+
+    module_for_device();
+
+    EXPECT_CALL(report, probing_path(_)).Times(0);
+    EXPECT_CALL(report, loading_library(_)).Times(1);
+
+    auto const module = module_for_device();
+    ASSERT_NE(nullptr, module);
+
+    auto descriptor = module->load_function<mir::graphics::DescribeModule>(describe_module);
+    EXPECT_THAT(descriptor()->name, HasSubstr("mir:stub-graphics"));
+}
+
+TEST_F(ServerPlatformProbeCache, probes_the_path_when_the_cache_names_a_library_outside_it)
+{
+    using namespace testing;
+
+    module_for_device();
+
+    // Someone rewrites the cache to point at a library of their own
+    std::string contents;
+    {
+        std::ifstream in{cache_file};
+        std::getline(in, contents);
+    }
+    contents.replace(contents.find(' ') + 1, std::string::npos, "../graphics-dummy.so");
+    std::ofstream{cache_file} << contents << '\n';
+
+    // Just the module in the path
+    EXPECT_CALL(report, probing_path(_)).Times(1);
+    EXPECT_CALL(report, loading_library(_)).Times(1);
+
+    EXPECT_NE(nullptr, module_for_device());
+}
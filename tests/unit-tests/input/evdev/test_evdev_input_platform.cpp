@@ -17,6 +17,8 @@
  */
 
 #include "src/platforms/evdev/platform.h"
+#include "src/platforms/evdev/libinput_device.h"
+#include "src/server/input/default_event_builder.h"
 #include "src/server/report/null_report_factory.h"
 #include "mir/console_services.h"
 
@@ -29,12 +31,17 @@
 #include "mir/test/doubles/mock_libinput.h"
 #include "mir/test/doubles/mock_udev.h"
 #include "mir/test/doubles/stub_console_services.h"
+#include "mir/test/doubles/mock_input_seat.h"
+#include "mir/test/doubles/mock_input_sink.h"
+#include "mir/test/event_matchers.h"
+#include "mir/cookie/authority.h"
 #include "mir/test/fd_utils.h"
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
 #include <umockdev.h>
+#include <linux/input.h>
 #include <memory>
 #include <vector>
 #include <initializer_list>
@@ -52,6 +59,12 @@ using namespace ::testing;
 namespace
 {
 
+MATCHER(ButtonDown, "")
+{
+    auto const pev = mt::maybe_pointer_event(mt::to_address(arg));
+    return pev && mir_pointer_event_action(pev) == mir_pointer_action_button_down;
+}
+
 struct MockInputDeviceRegistry : public mi::InputDeviceRegistry
 {
     MOCK_METHOD1(add_device, void(std::shared_ptr<mi::InputDevice> const&));
@@ -283,6 +296,49 @@ TEST_F(EvdevInputPlatform, ignore_devices_from_same_group)
     run_dispatchable(*platform);
 }
 
+TEST_F(EvdevInputPlatform, keeps_the_order_of_events_from_different_devices)
+{
+    std::vector<std::shared_ptr<mie::LibInputDevice>> added;
+    ON_CALL(mock_registry, add_device(_))
+        .WillByDefault(Invoke(
+            [&](std::shared_ptr<mi::InputDevice> const& device)
+            {
+                added.push_back(std::dynamic_pointer_cast<mie::LibInputDevice>(device));
+            }));
+
+    auto platform = create_input_platform();
+    platform->start();
+
+    udev.add_standard_device("usb-keyboard");
+    udev.add_standard_device("usb-mouse");
+    run_dispatchable(*platform);
+    ASSERT_THAT(added.size(), Eq(2u));
+
+    auto const is_keyboard = contains(added[0]->get_device_info().capabilities, mi::DeviceCapability::keyboard);
+    auto const keyboard = is_keyboard ? added[0] : added[1];
+    auto const mouse = is_keyboard ? added[1] : added[0];
+
+    NiceMock<mtd::MockInputSeat> seat;
+    mi::DefaultEventBuilder builder{MirInputDeviceId{1}, mir::cookie::Authority::create(), mt::fake_shared(seat)};
+    NiceMock<mtd::MockInputSink> keyboard_sink;
+    NiceMock<mtd::MockInputSink> mouse_sink;
+    keyboard->start(&keyboard_sink, &builder);
+    mouse->start(&mouse_sink, &builder);
+
+    {
+        InSequence seq;
+        EXPECT_CALL(keyboard_sink, handle_input(mt::KeyDownEvent()));
+        EXPECT_CALL(mouse_sink, handle_input(ButtonDown()));
+        EXPECT_CALL(keyboard_sink, handle_input(mt::KeyUpEvent()));
+    }
+
+    // All handled after a single libinput_dispatch()
+    li_mock.setup_key_event(keyboard->device(), 1000, KEY_LEFTSHIFT, LIBINPUT_KEY_STATE_PRESSED);
+    li_mock.setup_button_event(mouse->device(), 2000, BTN_LEFT, LIBINPUT_BUTTON_STATE_PRESSED);
+    li_mock.setup_key_event(keyboard->device(), 3000, KEY_LEFTSHIFT, LIBINPUT_KEY_STATE_RELEASED);
+    run_dispatchable(*platform);
+}
+
 TEST_F(EvdevInputPlatform, creates_new_context_on_resume)
 {
     using namespace ::testing;
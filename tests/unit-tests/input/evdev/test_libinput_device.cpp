@@ -397,6 +397,46 @@ TEST_F(LibInputDeviceOnMouse, process_event_converts_pointer_event)
     process_events(mouse);
 }
 
+TEST_F(LibInputDeviceOnMouse, queued_events_of_one_frame_are_handed_to_sink_together)
+{
+    float x_movement_1 = 15;
+    float y_movement_1 = 17;
+    float x_movement_2 = 20;
+    float y_movement_2 = 40;
+
+    EXPECT_CALL(mock_sink, handle_input(_)).Times(0);
+    EXPECT_CALL(mock_sink, handle_input_frame(ElementsAre(mt::PointerEventWithDiff(x_movement_1, y_movement_1),
+                                                          mt::PointerEventWithDiff(x_movement_2, y_movement_2))));
+
+    mouse.start(&mock_sink, &mock_builder);
+    env.mock_libinput.setup_pointer_event(fake_device, event_time_1, x_movement_1, y_movement_1);
+    env.mock_libinput.setup_pointer_event(fake_device, event_time_1, x_movement_2, y_movement_2);
+
+    for (auto event : env.mock_libinput.events)
+        mouse.queue_event(event);
+    mouse.flush_events();
+}
+
+TEST_F(LibInputDeviceOnMouse, queued_event_from_a_later_frame_flushes_the_earlier_frame)
+{
+    float x_movement_1 = 15;
+    float y_movement_1 = 17;
+    float x_movement_2 = 20;
+    float y_movement_2 = 40;
+
+    InSequence seq;
+    EXPECT_CALL(mock_sink, handle_input(mt::PointerEventWithDiff(x_movement_1, y_movement_1)));
+    EXPECT_CALL(mock_sink, handle_input(mt::PointerEventWithDiff(x_movement_2, y_movement_2)));
+
+    mouse.start(&mock_sink, &mock_builder);
+    env.mock_libinput.setup_pointer_event(fake_device, event_time_1, x_movement_1, y_movement_1);
+    env.mock_libinput.setup_pointer_event(fake_device, event_time_2, x_movement_2, y_movement_2);
+
+    for (auto event : env.mock_libinput.events)
+        mouse.queue_event(event);
+    mouse.flush_events();
+}
+
 TEST_F(LibInputDeviceOnMouse, process_event_handles_absolute_pointer_events)
 {
     float x1 = 15;
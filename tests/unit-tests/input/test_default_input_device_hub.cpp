@@ -48,6 +48,7 @@
 #include <gtest/gtest.h>
 
 #include <cstring>
+#include <linux/input.h>
 
 namespace mi = mir::input;
 namespace mt = mir::test;
@@ -204,6 +205,24 @@ TEST_F(InputDeviceHubTest, throws_on_invalid_handles)
     EXPECT_THROW(hub.remove_device(std::shared_ptr<mi::InputDevice>()), std::logic_error);
 }
 
+TEST_F(InputDeviceHubTest, input_frame_is_dispatched_to_seat_as_a_whole)
+{
+    mi::InputSink* sink;
+    mi::EventBuilder* builder;
+    capture_input_sink(device, sink, builder);
+
+    hub.add_device(mt::fake_shared(device));
+
+    std::vector<std::shared_ptr<MirEvent>> const frame{
+        builder->key_event(arbitrary_timestamp, mir_keyboard_action_down, 0, KEY_A),
+        builder->key_event(arbitrary_timestamp, mir_keyboard_action_up, 0, KEY_A)};
+
+    EXPECT_CALL(mock_seat, dispatch_event(_)).Times(0);
+    EXPECT_CALL(mock_seat, dispatch_events(ElementsAreArray(frame)));
+
+    sink->handle_input_frame(frame);
+}
+
 TEST_F(InputDeviceHubTest, observers_receive_device_changes)
 {
     InSequence seq;
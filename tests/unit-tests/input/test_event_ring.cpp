@@ -0,0 +1,153 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/input/event_ring.h"
+#include "mir/events/event_builders.h"
+#include "mir/anonymous_shm_file.h"
+
+#include "mir/test/event_matchers.h"
+#include "mir/test/fd_utils.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <linux/input.h>
+#include <unistd.h>
+
+namespace mev = mir::events;
+namespace mi = mir::input;
+namespace mt = mir::test;
+using namespace testing;
+
+namespace
+{
+struct EventRing : Test
+{
+    mir::EventUPtr key_event(int scan_code, std::size_t cookie_size = 0)
+    {
+        return mev::make_event(
+            MirInputDeviceId{7}, std::chrono::nanoseconds{42}, std::vector<uint8_t>(cookie_size),
+            mir_keyboard_action_down, 0, scan_code, mir_input_event_modifier_none);
+    }
+
+    // Events this big need two of the ring's slots
+    std::size_t const two_slot_cookie{1500};
+
+    mi::EventRing producer{4};
+    mi::EventRing consumer{producer.shm_fd(), producer.wakeup_fd()};
+};
+}
+
+TEST_F(EventRing, is_initially_empty)
+{
+    EXPECT_THAT(consumer.pop(), IsNull());
+    EXPECT_FALSE(mt::fd_is_readable(consumer.wakeup_fd()));
+}
+
+TEST_F(EventRing, delivers_events_in_order)
+{
+    ASSERT_TRUE(producer.push(*key_event(KEY_A)));
+    ASSERT_TRUE(producer.push(*key_event(KEY_B)));
+
+    EXPECT_THAT(consumer.pop(), Pointee(mt::KeyOfScanCode(KEY_A)));
+    EXPECT_THAT(consumer.pop(), Pointee(mt::KeyOfScanCode(KEY_B)));
+    EXPECT_THAT(consumer.pop(), IsNull());
+}
+
+TEST_F(EventRing, wakes_consumer_until_wakeup_is_cleared)
+{
+    producer.push(*key_event(KEY_A));
+
+    EXPECT_TRUE(mt::fd_is_readable(consumer.wakeup_fd()));
+
+    consumer.clear_wakeup();
+
+    EXPECT_FALSE(mt::fd_is_readable(consumer.wakeup_fd()));
+}
+
+TEST_F(EventRing, refuses_events_when_full)
+{
+    for (int i = 0; i != 4; ++i)
+        EXPECT_TRUE(producer.push(*key_event(KEY_A)));
+
+    EXPECT_FALSE(producer.push(*key_event(KEY_B)));
+
+    consumer.pop();
+
+    EXPECT_TRUE(producer.push(*key_event(KEY_B)));
+}
+
+TEST_F(EventRing, keeps_working_as_it_wraps_around)
+{
+    for (int i = 0; i != 100; ++i)
+    {
+        ASSERT_TRUE(producer.push(*key_event(i)));
+        EXPECT_THAT(consumer.pop(), Pointee(mt::KeyOfScanCode(i)));
+    }
+}
+
+TEST_F(EventRing, delivers_events_larger_than_a_slot)
+{
+    ASSERT_TRUE(producer.push(*key_event(KEY_A, two_slot_cookie)));
+    ASSERT_TRUE(producer.push(*key_event(KEY_B)));
+
+    EXPECT_THAT(consumer.pop(), Pointee(mt::KeyOfScanCode(KEY_A)));
+    EXPECT_THAT(consumer.pop(), Pointee(mt::KeyOfScanCode(KEY_B)));
+    EXPECT_THAT(consumer.pop(), IsNull());
+}
+
+TEST_F(EventRing, moves_large_events_that_would_wrap_around_to_the_start)
+{
+    for (int i = 0; i != 3; ++i)
+    {
+        ASSERT_TRUE(producer.push(*key_event(KEY_A)));
+        consumer.pop();
+    }
+
+    // Only one slot before the end of the ring
+    ASSERT_TRUE(producer.push(*key_event(KEY_B, two_slot_cookie)));
+    ASSERT_TRUE(producer.push(*key_event(KEY_C)));
+    EXPECT_FALSE(producer.push(*key_event(KEY_D)));
+
+    EXPECT_THAT(consumer.pop(), Pointee(mt::KeyOfScanCode(KEY_B)));
+    EXPECT_THAT(consumer.pop(), Pointee(mt::KeyOfScanCode(KEY_C)));
+    EXPECT_THAT(consumer.pop(), IsNull());
+}
+
+TEST_F(EventRing, refuses_events_larger_than_the_ring)
+{
+    EXPECT_FALSE(producer.push(*key_event(KEY_A, 4 * 1024)));
+    EXPECT_THAT(consumer.pop(), IsNull());
+}
+
+TEST_F(EventRing, tells_the_producer_how_many_bypassing_events_were_consumed)
+{
+    EXPECT_THAT(producer.bypasses_consumed(), Eq(0u));
+
+    consumer.bypass_consumed();
+    consumer.bypass_consumed();
+
+    EXPECT_THAT(producer.bypasses_consumed(), Eq(2u));
+}
+
+TEST_F(EventRing, rejects_memory_that_is_not_a_ring)
+{
+    mir::AnonymousShmFile not_a_ring{4096};
+
+    EXPECT_THROW(
+        mi::EventRing(mir::Fd{dup(not_a_ring.fd())}, producer.wakeup_fd()),
+        std::runtime_error);
+}
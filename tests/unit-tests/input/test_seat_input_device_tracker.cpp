@@ -190,6 +190,40 @@ TEST_F(SeatInputDeviceTracker, pointer_movement_from_different_devices_change_cu
         another_device_builder.pointer_event(arbitrary_timestamp, mir_pointer_action_motion, 0, 0, 0, 2, 10));
 }
 
+TEST_F(SeatInputDeviceTracker, pointer_frame_notifies_cursor_listener_once_and_dispatches_every_event)
+{
+    EXPECT_CALL(mock_cursor_listener, cursor_moved_to(_, _)).Times(0);
+    EXPECT_CALL(mock_cursor_listener, cursor_moved_to(25, 30)).Times(1);
+    EXPECT_CALL(mock_dispatcher, dispatch(mt::PointerEventWithPosition(23, 20)));
+    EXPECT_CALL(mock_dispatcher, dispatch(mt::PointerEventWithPosition(25, 30)));
+
+    tracker.add_device(some_device);
+
+    std::vector<std::shared_ptr<MirEvent>> const frame{
+        some_device_builder.pointer_event(arbitrary_timestamp, mir_pointer_action_motion, 0, 0, 0, 23, 20),
+        some_device_builder.pointer_event(arbitrary_timestamp, mir_pointer_action_motion, 0, 0, 0, 2, 10)};
+
+    tracker.dispatch(frame);
+}
+
+TEST_F(SeatInputDeviceTracker, touch_frame_updates_visualizer_once)
+{
+    using Spot = mi::TouchVisualizer::Spot;
+    EXPECT_CALL(mock_visualizer, visualize_touches(ElementsAreArray({Spot{{10, 10}, 30}}))).Times(1);
+
+    tracker.add_device(some_device);
+
+    std::vector<std::shared_ptr<MirEvent>> const frame{
+        some_device_builder.touch_event(
+            arbitrary_timestamp,
+            {{0, mir_touch_action_down, mir_touch_tooltype_finger, 4.0f, 2.0f, 10.0f, 15.0f, 5.0f, 4.0f}}),
+        some_device_builder.touch_event(
+            arbitrary_timestamp,
+            {{0, mir_touch_action_change, mir_touch_tooltype_finger, 10.0f, 10.0f, 30.0f, 15.0f, 5.0f, 4.0f}})};
+
+    tracker.dispatch(frame);
+}
+
 TEST_F(SeatInputDeviceTracker, tracks_a_single_button_state_for_multiple_pointing_devices)
 {
     int const x = 0, y = 0;
@@ -0,0 +1,163 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/server/input/touch_resampler.h"
+
+#include "mir/events/event_private.h"
+#include "mir/events/event_builders.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+namespace mi = mir::input;
+namespace mev = mir::events;
+
+using namespace ::testing;
+using namespace std::chrono_literals;
+
+namespace
+{
+MirInputDeviceId const device_id{7};
+MirTouchId const contact{3};
+
+struct TouchResampler : Test
+{
+    std::shared_ptr<MirEvent const> touch(MirTouchAction action, std::chrono::nanoseconds time, float x, float y)
+    {
+        std::shared_ptr<MirEvent> event{mev::make_event(device_id, time, std::vector<uint8_t>{}, mir_input_event_modifier_none)};
+        mev::add_touch(*event, contact, action, mir_touch_tooltype_finger, x, y, 1.0f, 1.0f, 1.0f, 1.0f);
+        return event;
+    }
+
+    static float x_of(std::shared_ptr<MirEvent> const& event)
+    {
+        auto const tev = mir_input_event_get_touch_event(mir_event_get_input_event(event.get()));
+        return mir_touch_event_axis_value(tev, 0, mir_touch_axis_x);
+    }
+
+    static std::chrono::nanoseconds time_of(std::shared_ptr<MirEvent> const& event)
+    {
+        return std::chrono::nanoseconds{mir_input_event_get_event_time(mir_event_get_input_event(event.get()))};
+    }
+
+    mi::TouchResampler resampler{8ms};
+};
+}
+
+TEST_F(TouchResampler, contacts_going_down_or_up_are_not_held)
+{
+    EXPECT_FALSE(resampler.hold(touch(mir_touch_action_down, 0ms, 0, 0)));
+    EXPECT_FALSE(resampler.hold(touch(mir_touch_action_up, 10ms, 0, 0)));
+    EXPECT_THAT(resampler.resample(device_id, 20ms), IsNull());
+}
+
+TEST_F(TouchResampler, motion_is_held_until_resampled)
+{
+    resampler.hold(touch(mir_touch_action_down, 0ms, 0, 0));
+
+    EXPECT_TRUE(resampler.hold(touch(mir_touch_action_change, 10ms, 10, 0)));
+    EXPECT_THAT(resampler.resample(device_id, 10ms), NotNull());
+    EXPECT_THAT(resampler.resample(device_id, 20ms), IsNull());
+}
+
+TEST_F(TouchResampler, motion_is_held_until_resampled_at_its_newest_sample)
+{
+    resampler.hold(touch(mir_touch_action_down, 0ms, 0, 0));
+    resampler.hold(touch(mir_touch_action_change, 10ms, 100, 0));
+    resampler.hold(touch(mir_touch_action_change, 20ms, 200, 0));
+
+    EXPECT_THAT(x_of(resampler.resample(device_id, 14ms)), FloatEq(140));
+    EXPECT_TRUE(resampler.holds_motion(device_id));
+
+    EXPECT_THAT(x_of(resampler.resample(device_id, 20ms)), FloatEq(200));
+    EXPECT_FALSE(resampler.holds_motion(device_id));
+    EXPECT_THAT(resampler.resample(device_id, 30ms), IsNull());
+}
+
+TEST_F(TouchResampler, interpolates_between_samples)
+{
+    resampler.hold(touch(mir_touch_action_down, 0ms, 0, 0));
+    resampler.hold(touch(mir_touch_action_change, 10ms, 100, 0));
+    resampler.hold(touch(mir_touch_action_change, 20ms, 200, 0));
+
+    auto const resampled = resampler.resample(device_id, 14ms);
+
+    EXPECT_THAT(x_of(resampled), FloatEq(140));
+    EXPECT_THAT(time_of(resampled), Eq(14ms));
+}
+
+TEST_F(TouchResampler, extrapolates_at_most_half_a_sample_interval)
+{
+    resampler.hold(touch(mir_touch_action_down, 0ms, 0, 0));
+    resampler.hold(touch(mir_touch_action_change, 10ms, 100, 0));
+    resampler.hold(touch(mir_touch_action_change, 20ms, 200, 0));
+    auto const near_prediction = resampler.resample(device_id, 23ms);
+
+    resampler.hold(touch(mir_touch_action_change, 30ms, 300, 0));
+    auto const far_prediction = resampler.resample(device_id, 50ms);
+
+    EXPECT_THAT(x_of(near_prediction), FloatEq(230));
+    EXPECT_THAT(x_of(far_prediction), FloatEq(350));
+    EXPECT_THAT(time_of(far_prediction), Eq(35ms));
+}
+
+TEST_F(TouchResampler, does_not_extrapolate_without_prediction)
+{
+    mi::TouchResampler resampler{0ms};
+
+    resampler.hold(touch(mir_touch_action_down, 0ms, 0, 0));
+    resampler.hold(touch(mir_touch_action_change, 10ms, 100, 0));
+
+    EXPECT_THAT(x_of(resampler.resample(device_id, 15ms)), FloatEq(100));
+}
+
+TEST_F(TouchResampler, does_not_extrapolate_from_distant_samples)
+{
+    resampler.hold(touch(mir_touch_action_down, 0ms, 0, 0));
+    resampler.hold(touch(mir_touch_action_change, 100ms, 100, 0));
+
+    EXPECT_THAT(x_of(resampler.resample(device_id, 105ms)), FloatEq(100));
+}
+
+TEST_F(TouchResampler, resampled_time_never_goes_backwards)
+{
+    resampler.hold(touch(mir_touch_action_down, 0ms, 0, 0));
+    resampler.hold(touch(mir_touch_action_change, 10ms, 100, 0));
+    resampler.hold(touch(mir_touch_action_change, 20ms, 200, 0));
+    resampler.resample(device_id, 18ms);
+
+    resampler.hold(touch(mir_touch_action_change, 30ms, 300, 0));
+
+    EXPECT_THAT(time_of(resampler.resample(device_id, 12ms)), Ge(18ms));
+}
+
+TEST_F(TouchResampler, held_motion_is_superseded_by_contact_going_up)
+{
+    resampler.hold(touch(mir_touch_action_down, 0ms, 0, 0));
+    resampler.hold(touch(mir_touch_action_change, 10ms, 100, 0));
+    resampler.hold(touch(mir_touch_action_up, 12ms, 120, 0));
+
+    EXPECT_THAT(resampler.resample(device_id, 15ms), IsNull());
+}
+
+TEST_F(TouchResampler, forgotten_device_has_nothing_to_resample)
+{
+    resampler.hold(touch(mir_touch_action_down, 0ms, 0, 0));
+    resampler.hold(touch(mir_touch_action_change, 10ms, 100, 0));
+    resampler.forget_device(device_id);
+
+    EXPECT_THAT(resampler.resample(device_id, 10ms), IsNull());
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/logging/async_logger.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ml = mir::logging;
+using namespace testing;
+
+namespace
+{
+struct AsyncLogger : Test
+{
+    std::ostringstream out;
+    std::ostringstream err;
+
+    auto make_logger(ml::Severity max_severity = ml::Severity::debug, std::size_t records_per_thread = 1024)
+    -> std::unique_ptr<ml::AsyncLogger>
+    {
+        return std::make_unique<ml::AsyncLogger>(max_severity, records_per_thread, out, err);
+    }
+
+    static auto lines_of(std::ostringstream const& stream) -> std::vector<std::string>
+    {
+        std::vector<std::string> lines;
+        std::istringstream in{stream.str()};
+        for (std::string line; std::getline(in, line);)
+            lines.push_back(line);
+        return lines;
+    }
+};
+
+// A stream buffer the test can read while the writer thread writes to it
+class LockedStringBuf : public std::stringbuf
+{
+public:
+    auto contents() -> std::string
+    {
+        std::lock_guard<std::recursive_mutex> lock{mutex};
+        return str();
+    }
+
+protected:
+    auto xsputn(char const* s, std::streamsize count) -> std::streamsize override
+    {
+        std::lock_guard<std::recursive_mutex> lock{mutex};
+        return std::stringbuf::xsputn(s, count);
+    }
+
+    auto overflow(int_type c) -> int_type override
+    {
+        std::lock_guard<std::recursive_mutex> lock{mutex};
+        return std::stringbuf::overflow(c);
+    }
+
+private:
+    std::recursive_mutex mutex;    // xsputn() may call overflow()
+};
+
+auto eventually_contains(LockedStringBuf& buffer, std::string const& text) -> bool
+{
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+
+    while (buffer.contents().find(text) == std::string::npos)
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    return true;
+}
+
+auto const timestamp = R"(\[[0-9]{4}-[0-9]{2}-[0-9]{2} [0-9]{2}:[0-9]{2}:[0-9]{2}\.[0-9]{6}\] )";
+}
+
+TEST_F(AsyncLogger, writes_messages_in_console_format)
+{
+    auto logger = make_logger();
+
+    logger->log(ml::Severity::informational, "hello", "test");
+    logger->log("test", ml::Severity::debug, "%d %s", 42, "things");
+    logger->log(ml::Severity::warning, "careful", "test");
+    logger.reset();
+
+    EXPECT_THAT(lines_of(out), ElementsAre(
+        MatchesRegex(std::string{timestamp} + "test: hello"),
+        MatchesRegex(std::string{timestamp} + "<DEBUG> test: 42 things")));
+    EXPECT_THAT(lines_of(err), ElementsAre(
+        MatchesRegex(std::string{timestamp} + "<WARNING> test: careful")));
+}
+
+TEST_F(AsyncLogger, discards_messages_less_severe_than_the_maximum)
+{
+    auto logger = make_logger(ml::Severity::warning);
+
+    logger->log(ml::Severity::informational, "hidden", "test");
+    logger->log("test", ml::Severity::debug, "%s", "hidden");
+    logger->log(ml::Severity::error, "shown", "test");
+    logger.reset();
+
+    EXPECT_THAT(out.str(), IsEmpty());
+    EXPECT_THAT(lines_of(err), ElementsAre(EndsWith("<ERROR> test: shown")));
+}
+
+TEST_F(AsyncLogger, writes_critical_messages_before_returning)
+{
+    auto logger = make_logger();
+
+    logger->log(ml::Severity::critical, "oops", "test");
+
+    EXPECT_THAT(lines_of(err), ElementsAre(EndsWith("<CRITICAL> test: oops")));
+}
+
+TEST_F(AsyncLogger, flush_writes_everything_logged_so_far)
+{
+    auto logger = make_logger();
+
+    logger->log(ml::Severity::informational, "one", "test");
+    logger->log(ml::Severity::informational, "two", "test");
+    logger->flush();
+
+    EXPECT_THAT(lines_of(out), ElementsAre(EndsWith("test: one"), EndsWith("test: two")));
+}
+
+TEST_F(AsyncLogger, writes_messages_without_being_flushed)
+{
+    LockedStringBuf out_buffer;
+    std::ostream locked_out{&out_buffer};
+    ml::AsyncLogger logger{ml::Severity::debug, 1024, locked_out, err};
+
+    logger.log(ml::Severity::informational, "first", "test");
+    EXPECT_TRUE(eventually_contains(out_buffer, "test: first"));
+
+    // Once the writer has caught up, the next message has to wake it again
+    logger.log(ml::Severity::informational, "second", "test");
+    EXPECT_TRUE(eventually_contains(out_buffer, "test: second"));
+}
+
+TEST_F(AsyncLogger, counts_dropped_messages_when_a_thread_buffer_is_full)
+{
+    int const messages{10000};
+    auto logger = make_logger(ml::Severity::debug, 2);
+
+    for (int i = 0; i != messages; ++i)
+        logger->log(ml::Severity::informational, "message", "test");
+    logger.reset();
+
+    int dropped{0};
+    for (auto const& line : lines_of(err))
+    {
+        std::smatch match;
+        ASSERT_TRUE(std::regex_search(line, match, std::regex{"<WARNING> logger: ([0-9]+) messages dropped$"}));
+        dropped += std::stoi(match[1]);
+    }
+
+    EXPECT_THAT(dropped, Gt(0));
+    EXPECT_THAT(static_cast<int>(lines_of(out).size()) + dropped, Eq(messages));
+}
+
+TEST_F(AsyncLogger, merges_messages_from_several_threads)
+{
+    int const threads{4};
+    int const messages_per_thread{100};
+    auto logger = make_logger();
+
+    std::vector<std::thread> loggers;
+    for (int t = 0; t != threads; ++t)
+    {
+        loggers.emplace_back([&, t]
+            {
+                for (int i = 0; i != messages_per_thread; ++i)
+                    logger->log(ml::Severity::informational, std::to_string(i), "thread" + std::to_string(t));
+            });
+    }
+
+    for (auto& thread : loggers)
+        thread.join();
+    logger.reset();
+
+    std::vector<std::vector<int>> received(threads);
+    for (auto const& line : lines_of(out))
+    {
+        std::smatch match;
+        ASSERT_TRUE(std::regex_search(line, match, std::regex{"thread([0-9]+): ([0-9]+)$"}));
+        received[std::stoi(match[1])].push_back(std::stoi(match[2]));
+    }
+
+    for (auto const& messages : received)
+    {
+        EXPECT_THAT(messages.size(), Eq(std::size_t(messages_per_thread)));
+        EXPECT_TRUE(std::is_sorted(begin(messages), end(messages)));
+    }
+}
@@ -442,6 +442,29 @@ TEST_F(MesaCursorTest, show_cursor_pads_missing_data)
     cursor.show(SinglePixelCursorImage());
 }
 
+TEST_F(MesaCursorTest, writes_the_same_data_when_an_image_is_shown_again)
+{
+    using namespace testing;
+    size_t const height = 64;
+    size_t const width = 64;
+    size_t const stride = width * 4;
+    size_t const buffer_size_bytes{height * stride};
+    ON_CALL(mock_gbm, gbm_bo_get_stride(_))
+        .WillByDefault(Return(stride));
+
+    InSequence seq;
+    EXPECT_CALL(mock_gbm, gbm_bo_write(mock_gbm.fake_gbm.bo, ContainsASingleWhitePixel(width*height), buffer_size_bytes))
+        .Times(AtLeast(1));
+    EXPECT_CALL(mock_gbm, gbm_bo_write(mock_gbm.fake_gbm.bo, Not(ContainsASingleWhitePixel(width*height)), buffer_size_bytes))
+        .Times(AtLeast(1));
+    EXPECT_CALL(mock_gbm, gbm_bo_write(mock_gbm.fake_gbm.bo, ContainsASingleWhitePixel(width*height), buffer_size_bytes))
+        .Times(AtLeast(1));
+
+    cursor.show(SinglePixelCursorImage());
+    cursor.show(stub_image);
+    cursor.show(SinglePixelCursorImage());
+}
+
 TEST_F(MesaCursorTest, pads_missing_data_when_buffer_size_differs)
 {
     using namespace ::testing;
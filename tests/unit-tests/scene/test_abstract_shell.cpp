@@ -42,6 +42,7 @@
 #include "mir/test/doubles/null_application_not_responding_detector.h"
 #include "mir/test/doubles/stub_display.h"
 #include "mir/test/doubles/mock_input_seat.h"
+#include "mir/test/doubles/fake_alarm_factory.h"
 
 #include "mir/test/fake_shared.h"
 #include "mir/test/event_matchers.h"
@@ -125,7 +126,8 @@ struct AbstractShell : Test
         std::make_shared<ms::NullSessionListener>(),
         mt::fake_shared(display),
         std::make_shared<mtd::NullANRDetector>(),
-        std::make_shared<mtd::StubBufferAllocator>()};
+        std::make_shared<mtd::StubBufferAllocator>(),
+        std::make_shared<mtd::FakeAlarmFactory>()};
 
     mtd::StubInputTargeter input_targeter;
     std::shared_ptr<NiceMockWindowManager> wm;
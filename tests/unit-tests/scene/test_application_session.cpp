@@ -37,6 +37,7 @@
 #include "mir/test/doubles/null_prompt_session.h"
 #include "mir/test/doubles/stub_display_configuration.h"
 #include "mir/test/doubles/stub_buffer_allocator.h"
+#include "mir/test/doubles/fake_alarm_factory.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -128,6 +129,10 @@ struct StubSurfaceStack : public msh::SurfaceStack
     {
         return std::shared_ptr<ms::Surface>{};
     }
+    void apply_transaction(std::function<void()> const& changes) override
+    {
+        changes();
+    }
 };
 
 struct ApplicationSession : public testing::Test
@@ -150,7 +155,7 @@ struct ApplicationSession : public testing::Test
            null_snapshot_strategy,
            stub_session_listener,
            mtd::StubDisplayConfig{},
-           event_sink, allocator);
+           event_sink, allocator, alarm_factory);
     }
     
     std::shared_ptr<ms::ApplicationSession> make_application_session(
@@ -163,7 +168,7 @@ struct ApplicationSession : public testing::Test
            null_snapshot_strategy,
            stub_session_listener,
            mtd::StubDisplayConfig{},
-           event_sink, allocator);
+           event_sink, allocator, alarm_factory);
     }
 
     std::shared_ptr<ms::ApplicationSession> make_application_session(
@@ -176,7 +181,7 @@ struct ApplicationSession : public testing::Test
            null_snapshot_strategy,
            stub_session_listener,
            mtd::StubDisplayConfig{},
-           event_sink, allocator);
+           event_sink, allocator, alarm_factory);
     }
     std::shared_ptr<ms::ApplicationSession> make_application_session_with_coordinator(
         std::shared_ptr<msh::SurfaceStack> const& surface_stack)
@@ -187,7 +192,7 @@ struct ApplicationSession : public testing::Test
            null_snapshot_strategy,
            stub_session_listener,
            mtd::StubDisplayConfig{},
-           event_sink, allocator);
+           event_sink, allocator, alarm_factory);
     }
     
     std::shared_ptr<ms::ApplicationSession> make_application_session_with_listener(
@@ -199,7 +204,7 @@ struct ApplicationSession : public testing::Test
            null_snapshot_strategy,
            session_listener,
            mtd::StubDisplayConfig{},
-           event_sink, allocator);
+           event_sink, allocator, alarm_factory);
     }
 
 
@@ -212,7 +217,7 @@ struct ApplicationSession : public testing::Test
            null_snapshot_strategy,
            stub_session_listener,
            mtd::StubDisplayConfig{},
-           event_sink, allocator);
+           event_sink, allocator, alarm_factory);
     }
 
     std::shared_ptr<mtd::NullEventSink> const event_sink;
@@ -225,6 +230,7 @@ struct ApplicationSession : public testing::Test
     std::shared_ptr<mtd::StubBufferStream> const stub_buffer_stream{std::make_shared<mtd::StubBufferStream>()};
     std::shared_ptr<mtd::StubBufferAllocator> const allocator{
         std::make_shared<mtd::StubBufferAllocator>()};
+    std::shared_ptr<mtd::FakeAlarmFactory> const alarm_factory{std::make_shared<mtd::FakeAlarmFactory>()};
     pid_t pid;
     std::string name;
     mg::BufferProperties properties { geom::Size{1,1}, mir_pixel_format_abgr_8888, mg::BufferUsage::hardware };
@@ -497,7 +503,7 @@ TEST_F(ApplicationSession, takes_snapshot_of_default_surface)
         snapshot_strategy,
         std::make_shared<ms::NullSessionListener>(),
         mtd::StubDisplayConfig{},
-        event_sink, allocator);
+        event_sink, allocator, alarm_factory);
 
     ms::SurfaceCreationParameters params = ms::a_surface()
         .with_buffer_stream(app_session.create_buffer_stream(properties));
@@ -520,7 +526,7 @@ TEST_F(ApplicationSession, returns_null_snapshot_if_no_default_surface)
         snapshot_strategy,
         std::make_shared<ms::NullSessionListener>(),
         mtd::StubDisplayConfig{},
-        event_sink, allocator);
+        event_sink, allocator, alarm_factory);
 
     EXPECT_CALL(*snapshot_strategy, take_snapshot_of(_,_)).Times(0);
     EXPECT_CALL(mock_snapshot_callback, operator_call(IsNullSnapshot()));
@@ -541,7 +547,7 @@ TEST_F(ApplicationSession, process_id)
         null_snapshot_strategy,
         std::make_shared<ms::NullSessionListener>(),
         mtd::StubDisplayConfig{},
-        event_sink, allocator);
+        event_sink, allocator, alarm_factory);
 
     EXPECT_THAT(app_session.process_id(), Eq(session_pid));
 }
@@ -25,6 +25,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <thread>
+
 namespace ms = mir::scene;
 namespace mt = mir::test;
 namespace mtd = mt::doubles;
@@ -143,3 +145,102 @@ TEST_F(LegacySceneChangeNotificationTest, ending_observation_unregisters_observe
     // Verify that its not simply the destruction removing the observer...
     ::testing::Mock::VerifyAndClearExpectations(&observer);
 }
+
+TEST_F(LegacySceneChangeNotificationTest, coalesces_changes_within_a_transaction)
+{
+    using namespace ::testing;
+    std::shared_ptr<ms::SurfaceObserver> surface_observer;
+    EXPECT_CALL(surface, add_observer(_)).Times(1)
+        .WillOnce(SaveArg<0>(&surface_observer));
+
+    ms::LegacySceneChangeNotification observer(scene_change_callback, buffer_change_callback);
+    observer.surface_added(&surface);
+
+    EXPECT_CALL(scene_callback, invoke()).Times(0);
+
+    observer.transaction_begun();
+    for (int i = 0; i != 20; ++i)
+        surface_observer->moved_to(&surface, mir::geometry::Point{i, i});
+    observer.surfaces_reordered();
+
+    Mock::VerifyAndClearExpectations(&scene_callback);
+    EXPECT_CALL(scene_callback, invoke()).Times(1);
+
+    observer.transaction_ended();
+}
+
+TEST_F(LegacySceneChangeNotificationTest, defers_scene_changes_until_outermost_transaction_ends)
+{
+    using namespace ::testing;
+
+    ms::LegacySceneChangeNotification observer(scene_change_callback, buffer_change_callback);
+
+    EXPECT_CALL(scene_callback, invoke()).Times(0);
+
+    observer.transaction_begun();
+    observer.transaction_begun();
+    observer.surfaces_reordered();
+    observer.transaction_ended();
+
+    Mock::VerifyAndClearExpectations(&scene_callback);
+    EXPECT_CALL(scene_callback, invoke()).Times(1);
+
+    observer.transaction_ended();
+}
+
+TEST_F(LegacySceneChangeNotificationTest, does_not_defer_scene_changes_from_other_threads)
+{
+    using namespace ::testing;
+
+    ms::LegacySceneChangeNotification observer(scene_change_callback, buffer_change_callback);
+
+    EXPECT_CALL(scene_callback, invoke()).Times(1);
+
+    observer.transaction_begun();
+    std::thread{[&] { observer.surfaces_reordered(); }}.join();
+
+    Mock::VerifyAndClearExpectations(&scene_callback);
+    EXPECT_CALL(scene_callback, invoke()).Times(0);
+
+    observer.transaction_ended();
+}
+
+TEST_F(LegacySceneChangeNotificationTest, passes_buffer_changes_on_during_a_transaction)
+{
+    using namespace ::testing;
+    std::shared_ptr<ms::SurfaceObserver> surface_observer;
+    EXPECT_CALL(surface, add_observer(_)).Times(1)
+        .WillOnce(SaveArg<0>(&surface_observer));
+
+    ms::LegacySceneChangeNotification observer(scene_change_callback, buffer_change_callback);
+    observer.surface_added(&surface);
+
+    EXPECT_CALL(buffer_callback, invoke(3)).Times(1);
+
+    observer.transaction_begun();
+    surface_observer->frame_posted(&surface, 3, mir::geometry::Size{0, 0});
+    Mock::VerifyAndClearExpectations(&buffer_callback);
+
+    observer.transaction_ended();
+}
+
+TEST_F(LegacySceneChangeNotificationTest, passes_damage_on_during_a_transaction)
+{
+    using namespace ::testing;
+    using namespace mir::geometry;
+
+    std::shared_ptr<ms::SurfaceObserver> surface_observer;
+    EXPECT_CALL(surface, add_observer(_)).Times(1)
+        .WillOnce(SaveArg<0>(&surface_observer));
+
+    std::vector<std::pair<int, Rectangle>> damage;
+    ms::LegacySceneChangeNotification observer(
+        scene_change_callback,
+        [&](int frames, Rectangle const& region) { damage.emplace_back(frames, region); });
+    observer.surface_added(&surface);
+
+    observer.transaction_begun();
+    surface_observer->frame_posted(&surface, 2, Size{10, 10});
+    EXPECT_THAT(damage, ElementsAre(std::make_pair(2, Rectangle{{0, 0}, {10, 10}})));
+    observer.transaction_ended();
+}
@@ -38,6 +38,7 @@
 #include "mir/test/doubles/null_application_not_responding_detector.h"
 #include "mir/test/doubles/stub_display.h"
 #include "mir/test/doubles/stub_buffer_allocator.h"
+#include "mir/test/doubles/fake_alarm_factory.h"
 
 #include "mir/test/fake_shared.h"
 
@@ -105,7 +106,8 @@ struct SessionManagerSetup : public testing::Test
         mt::fake_shared(session_listener),
         mt::fake_shared(display),
         std::make_shared<mtd::NullANRDetector>(),
-        mt::fake_shared(allocator)};
+        mt::fake_shared(allocator),
+        std::make_shared<mtd::FakeAlarmFactory>()};
 };
 
 }
@@ -169,7 +171,8 @@ struct SessionManagerSessionListenerSetup : public testing::Test
         mt::fake_shared(session_listener),
         mt::fake_shared(display),
         std::make_shared<mtd::NullANRDetector>(),
-        mt::fake_shared(allocator)};
+        mt::fake_shared(allocator),
+        std::make_shared<mtd::FakeAlarmFactory>()};
 };
 }
 
@@ -255,7 +258,8 @@ struct SessionManagerSessionEventsSetup : public testing::Test
         mt::fake_shared(session_listener),
         mt::fake_shared(display),
         std::make_shared<mtd::NullANRDetector>(),
-        mt::fake_shared(allocator)};
+        mt::fake_shared(allocator),
+        std::make_shared<mtd::FakeAlarmFactory>()};
 };
 }
 
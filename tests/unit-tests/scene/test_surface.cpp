@@ -31,6 +31,7 @@
 #include "mir/test/doubles/mock_input_surface.h"
 #include "mir/test/doubles/stub_buffer.h"
 #include "mir/test/doubles/null_event_sink.h"
+#include "mir/test/doubles/fake_alarm_factory.h"
 #include "mir/test/fake_shared.h"
 #include "mir/test/event_matchers.h"
 
@@ -208,6 +209,7 @@ struct SurfaceCreation : public ::testing::Test
     geom::Stride stride = geom::Stride{4 * size.width.as_uint32_t()};
     geom::Rectangle rect = geom::Rectangle{geom::Point{geom::X{0}, geom::Y{0}}, size};
     std::shared_ptr<ms::SceneReport> const report = mr::null_scene_report();
+    mtd::FakeAlarmFactory alarm_factory;
     ms::BasicSurface surface;
 };
 
@@ -247,7 +249,7 @@ TEST_F(SurfaceCreation, resize_updates_stream_and_state)
 
     auto const mock_event_sink = std::make_shared<mt::doubles::MockEventSink>();
     ms::OutputPropertiesCache cache;
-    auto const observer = std::make_shared<ms::SurfaceEventSource>(mf::SurfaceId(), surface, cache, mock_event_sink);
+    auto const observer = std::make_shared<ms::SurfaceEventSource>(mf::SurfaceId(), surface, cache, mock_event_sink, alarm_factory);
 
     surface.add_observer(observer);
 
@@ -264,7 +266,7 @@ TEST_F(SurfaceCreation, duplicate_resize_ignored)
     geom::Size const new_size{123, 456};
     auto const mock_event_sink = std::make_shared<mt::doubles::MockEventSink>();
     ms::OutputPropertiesCache cache;
-    auto const observer = std::make_shared<ms::SurfaceEventSource>(mf::SurfaceId(), surface, cache, mock_event_sink);
+    auto const observer = std::make_shared<ms::SurfaceEventSource>(mf::SurfaceId(), surface, cache, mock_event_sink, alarm_factory);
 
     surface.add_observer(observer);
 
@@ -347,7 +349,7 @@ TEST_F(SurfaceCreation, consume_calls_send_event)
 
     auto const mock_event_sink = std::make_shared<mt::doubles::MockEventSink>();
     ms::OutputPropertiesCache cache;
-    auto const observer = std::make_shared<ms::SurfaceEventSource>(mf::SurfaceId(), surface, cache, mock_event_sink);
+    auto const observer = std::make_shared<ms::SurfaceEventSource>(mf::SurfaceId(), surface, cache, mock_event_sink, alarm_factory);
 
     surface.add_observer(observer);
 
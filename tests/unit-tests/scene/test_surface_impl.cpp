@@ -30,10 +30,12 @@
 #include "mir/test/doubles/mock_buffer_stream.h"
 #include "mir/test/doubles/null_event_sink.h"
 #include "mir/test/doubles/mock_event_sink.h"
+#include "mir/test/doubles/fake_alarm_factory.h"
 #include "mir/test/fake_shared.h"
 #include "mir/test/event_matchers.h"
 
 #include <cstring>
+#include <future>
 #include <stdexcept>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -90,6 +92,7 @@ struct Surface : testing::Test
 
     mf::SurfaceId stub_id;
     std::shared_ptr<ms::SceneReport> const report = mr::null_scene_report();
+    mtd::FakeAlarmFactory alarm_factory;
     std::shared_ptr<ms::BasicSurface> surface;
 };
 }
@@ -181,7 +184,7 @@ TEST_F(Surface, emits_resize_events)
     geom::Size const new_size{123, 456};
     auto sink = std::make_shared<mtd::MockEventSink>();
     ms::OutputPropertiesCache cache;
-    auto const observer = std::make_shared<ms::SurfaceEventSource>(stub_id, *surface, cache, sink);
+    auto const observer = std::make_shared<ms::SurfaceEventSource>(stub_id, *surface, cache, sink, alarm_factory);
 
     surface->add_observer(observer);
 
@@ -201,7 +204,7 @@ TEST_F(Surface, emits_resize_events_only_on_change)
     geom::Size const new_size2{789, 1011};
     auto sink = std::make_shared<mtd::MockEventSink>();
     ms::OutputPropertiesCache cache;
-    auto const observer = std::make_shared<ms::SurfaceEventSource>(stub_id, *surface, cache, sink);
+    auto const observer = std::make_shared<ms::SurfaceEventSource>(stub_id, *surface, cache, sink, alarm_factory);
 
     surface->add_observer(observer);
 
@@ -218,12 +221,111 @@ TEST_F(Surface, emits_resize_events_only_on_change)
     surface->resize(new_size);
     EXPECT_EQ(new_size, surface->size());
 
+    // The client catches up with the first resize
+    observer->frame_posted(surface.get(), 1, new_size);
+
     surface->resize(new_size2);
     EXPECT_EQ(new_size2, surface->size());
     surface->resize(new_size2);
     EXPECT_EQ(new_size2, surface->size());
 }
 
+TEST_F(Surface, coalesces_resize_events_until_the_client_posts_a_frame)
+{
+    using namespace testing;
+
+    geom::Size const first_size{100, 100};
+    geom::Size const skipped_size{110, 110};
+    geom::Size const latest_size{120, 120};
+    auto sink = std::make_shared<mtd::MockEventSink>();
+    ms::OutputPropertiesCache cache;
+    auto const observer = std::make_shared<ms::SurfaceEventSource>(stub_id, *surface, cache, sink, alarm_factory);
+
+    surface->add_observer(observer);
+
+    auto first = mev::make_event(stub_id, first_size);
+    auto skipped = mev::make_event(stub_id, skipped_size);
+    auto latest = mev::make_event(stub_id, latest_size);
+
+    EXPECT_CALL(*sink, handle_event(MirResizeEventEq(skipped.get()))).Times(0);
+
+    {
+        InSequence seq;
+        EXPECT_CALL(*sink, handle_event(MirResizeEventEq(first.get())));
+        EXPECT_CALL(*sink, handle_event(MirResizeEventEq(latest.get())));
+    }
+
+    surface->resize(first_size);
+    surface->resize(skipped_size);
+    surface->resize(latest_size);
+
+    observer->frame_posted(surface.get(), 1, first_size);
+}
+
+TEST_F(Surface, sends_held_resize_event_if_the_client_does_not_post_a_frame_in_time)
+{
+    using namespace testing;
+
+    geom::Size const first_size{100, 100};
+    geom::Size const held_size{120, 120};
+    auto sink = std::make_shared<mtd::MockEventSink>();
+    ms::OutputPropertiesCache cache;
+    auto const observer = std::make_shared<ms::SurfaceEventSource>(stub_id, *surface, cache, sink, alarm_factory);
+
+    surface->add_observer(observer);
+
+    auto first = mev::make_event(stub_id, first_size);
+    auto held = mev::make_event(stub_id, held_size);
+
+    EXPECT_CALL(*sink, handle_event(MirResizeEventEq(first.get())));
+    surface->resize(first_size);
+    surface->resize(held_size);
+    Mock::VerifyAndClearExpectations(sink.get());
+
+    EXPECT_CALL(*sink, handle_event(MirResizeEventEq(held.get())));
+    alarm_factory.advance_by(std::chrono::milliseconds{100});
+}
+
+TEST_F(Surface, a_resize_event_is_not_overtaken_by_a_newer_one)
+{
+    using namespace testing;
+
+    geom::Size const first_size{100, 100};
+    geom::Size const held_size{110, 110};
+    geom::Size const latest_size{120, 120};
+    auto sink = std::make_shared<NiceMock<mtd::MockEventSink>>();
+    ms::OutputPropertiesCache cache;
+    auto const observer = std::make_shared<ms::SurfaceEventSource>(stub_id, *surface, cache, sink, alarm_factory);
+
+    surface->add_observer(observer);
+    surface->resize(first_size);
+    surface->resize(held_size);
+
+    std::vector<geom::Size> sent;
+    std::future<void> newer;
+
+    EXPECT_CALL(*sink, handle_event(_)).WillRepeatedly(Invoke([&](MirEvent const& event)
+        {
+            sent.emplace_back(event.to_resize()->width(), event.to_resize()->height());
+
+            if (sent.size() == 1)
+            {
+                // The client catches up and the window is resized again while the held resize is being sent
+                newer = std::async(std::launch::async, [&]
+                    {
+                        observer->frame_posted(surface.get(), 1, held_size);
+                        surface->resize(latest_size);
+                    });
+                EXPECT_THAT(newer.wait_for(std::chrono::milliseconds{50}), Eq(std::future_status::timeout));
+            }
+        }));
+
+    observer->frame_posted(surface.get(), 1, first_size);
+    newer.wait();
+
+    EXPECT_THAT(sent, ElementsAre(held_size, latest_size));
+}
+
 TEST_F(Surface, sends_focus_notifications_when_focus_gained_and_lost)
 {
     using namespace testing;
@@ -239,7 +341,7 @@ TEST_F(Surface, sends_focus_notifications_when_focus_gained_and_lost)
     }
 
     ms::OutputPropertiesCache cache;
-    auto const observer = std::make_shared<ms::SurfaceEventSource>(stub_id, *surface, cache, mt::fake_shared(sink));
+    auto const observer = std::make_shared<ms::SurfaceEventSource>(stub_id, *surface, cache, mt::fake_shared(sink), alarm_factory);
 
     surface->add_observer(observer);
 
@@ -257,7 +359,7 @@ TEST_F(Surface, emits_client_close_events)
 
     auto sink = std::make_shared<mtd::MockEventSink>();
     ms::OutputPropertiesCache cache;
-    auto const observer = std::make_shared<ms::SurfaceEventSource>(stub_id, *surface, cache, sink);
+    auto const observer = std::make_shared<ms::SurfaceEventSource>(stub_id, *surface, cache, sink, alarm_factory);
 
     surface->add_observer(observer);
 
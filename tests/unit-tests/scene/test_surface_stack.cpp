@@ -82,6 +82,9 @@ struct MockSceneObserver : public ms::Observer
 
     MOCK_METHOD1(surface_exists, void(ms::Surface*));
     MOCK_METHOD0(end_observation, void());
+
+    MOCK_METHOD0(transaction_begun, void());
+    MOCK_METHOD0(transaction_ended, void());
 };
 
 struct SurfaceStack : public ::testing::Test
@@ -586,6 +589,71 @@ TEST_F(SurfaceStack, surfaces_reordered)
     stack.raise(stub_surface1);
 }
 
+TEST_F(SurfaceStack, transaction_brackets_changes_for_observers)
+{
+    using namespace ::testing;
+
+    NiceMock<MockSceneObserver> observer;
+
+    stack.add_surface(stub_surface1, default_params.input_mode);
+    stack.add_surface(stub_surface2, default_params.input_mode);
+    stack.add_observer(mt::fake_shared(observer));
+
+    {
+        InSequence seq;
+        EXPECT_CALL(observer, transaction_begun());
+        EXPECT_CALL(observer, surfaces_reordered()).Times(2);
+        EXPECT_CALL(observer, transaction_ended());
+    }
+
+    stack.apply_transaction([&]
+        {
+            stack.raise(stub_surface1);
+            stack.raise(stub_surface2);
+        });
+}
+
+TEST_F(SurfaceStack, transaction_ends_for_observers_when_changes_throw)
+{
+    using namespace ::testing;
+
+    NiceMock<MockSceneObserver> observer;
+    stack.add_observer(mt::fake_shared(observer));
+
+    EXPECT_CALL(observer, transaction_begun());
+    EXPECT_CALL(observer, transaction_ended());
+
+    EXPECT_THROW(
+        stack.apply_transaction([] { throw std::runtime_error{"failed change"}; }),
+        std::runtime_error);
+}
+
+TEST_F(SurfaceStack, compositor_does_not_see_a_transaction_half_done)
+{
+    using namespace ::testing;
+
+    stack.add_surface(stub_surface1, default_params.input_mode);
+
+    std::future<mc::SceneElementSequence> elements;
+
+    stack.apply_transaction([&]
+        {
+            stack.add_surface(stub_surface2, default_params.input_mode);
+
+            elements = std::async(std::launch::async, [&] { return stack.scene_elements_for(compositor_id); });
+            EXPECT_THAT(elements.wait_for(std::chrono::milliseconds{50}), Eq(std::future_status::timeout));
+
+            stack.add_surface(stub_surface3, default_params.input_mode);
+        });
+
+    EXPECT_THAT(
+        elements.get(),
+        ElementsAre(
+            SceneElementForStream(stub_buffer_stream1),
+            SceneElementForStream(stub_buffer_stream2),
+            SceneElementForStream(stub_buffer_stream3)));
+}
+
 TEST_F(SurfaceStack, scene_elements_hold_snapshot_of_positioning_info)
 {
     size_t num_surfaces{3};
@@ -1027,3 +1095,25 @@ TEST_F(SurfaceStack, raise_surfaces_to_top)
             SceneElementForStream(stub_buffer_stream2),
             SceneElementForStream(stub_buffer_stream3)));
 }
+
+TEST_F(SurfaceStack, enumeration_does_not_block_concurrent_changes)
+{
+    stack.add_surface(stub_surface1, default_params.input_mode);
+
+    int num_surfaces = 0;
+    stack.for_each([&](std::shared_ptr<mi::Surface> const&)
+        {
+            ++num_surfaces;
+            // A writer on another thread must complete while we're still reading
+            auto const added = std::async(std::launch::async,
+                [&]{ stack.add_surface(stub_surface2, default_params.input_mode); });
+            EXPECT_THAT(added.wait_for(std::chrono::seconds{5}), Eq(std::future_status::ready));
+        });
+
+    EXPECT_THAT(num_surfaces, Eq(1));
+    EXPECT_THAT(
+        stack.scene_elements_for(compositor_id),
+        ElementsAre(
+            SceneElementForStream(stub_buffer_stream1),
+            SceneElementForStream(stub_buffer_stream2)));
+}
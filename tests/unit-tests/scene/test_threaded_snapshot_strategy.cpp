@@ -18,6 +18,7 @@
 
 #include "src/server/scene/threaded_snapshot_strategy.h"
 #include "src/server/scene/pixel_buffer.h"
+#include "mir/thread/work_stealing_thread_pool.h"
 #include "mir/graphics/buffer.h"
 
 #include "mir/test/doubles/stub_buffer.h"
@@ -121,3 +122,29 @@ TEST_F(ThreadedSnapshotStrategyTest, names_snapshot_thread)
 
     EXPECT_THAT(buffer_access.thread_name, Eq("Mir/Snapshot"));
 }
+
+TEST_F(ThreadedSnapshotStrategyTest, delivers_scheduled_snapshots_on_the_given_executor)
+{
+    using namespace testing;
+
+    mtd::NullPixelBuffer pixel_buffer;
+    auto const pool = std::make_shared<mir::thread::WorkStealingThreadPool>(2, "Mir/Worker");
+    std::atomic<int> snapshots_taken{0};
+
+    {
+        ms::ThreadedSnapshotStrategy strategy{mt::fake_shared(pixel_buffer), pool};
+
+        for (int i = 0; i != 10; ++i)
+        {
+            strategy.take_snapshot_of(
+                mt::fake_shared(buffer_access),
+                [&](ms::Snapshot const&)
+                {
+                    ++snapshots_taken;
+                });
+        }
+    }
+
+    EXPECT_THAT(snapshots_taken, Eq(10));
+    EXPECT_THAT(buffer_access.thread_name, Eq("Mir/Worker"));
+}
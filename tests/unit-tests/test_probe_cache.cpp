@@ -0,0 +1,166 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "mir/probe_cache.h"
+#include "mir/shared_library_prober.h"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+namespace
+{
+struct ProbeCache : Test
+{
+    ProbeCache()
+        : directory{boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("mir_probe_cache_%%%%%%")}
+    {
+        boost::filesystem::create_directories(modules);
+    }
+
+    ~ProbeCache()
+    {
+        boost::system::error_code ignored;
+        boost::filesystem::remove_all(directory, ignored);
+    }
+
+    // Nothing is loaded, so the "library" needn't be one
+    auto add_library(boost::filesystem::path const& path) -> std::string
+    {
+        std::ofstream{path.string()} << "not really a library";
+        return path.string();
+    }
+
+    auto add_module(std::string const& name) -> std::string
+    {
+        return add_library(modules / name);
+    }
+
+    boost::filesystem::path const directory;
+    boost::filesystem::path const modules{directory / "modules"};
+    std::string const path{modules.string()};
+    std::string const file{(directory / "cache" / "test-platform").string()};
+};
+}
+
+TEST_F(ProbeCache, misses_until_a_result_is_stored)
+{
+    auto const module = add_module("libmodule.so");
+    mir::ProbeCache const cache{file};
+
+    EXPECT_THAT(cache.lookup("key", path), IsEmpty());
+
+    cache.store("key", module);
+
+    EXPECT_THAT(cache.lookup("key", path), Eq(module));
+}
+
+TEST_F(ProbeCache, results_persist_in_the_file)
+{
+    auto const module = add_module("libmodule.so");
+
+    mir::ProbeCache{file}.store("key", module);
+
+    EXPECT_THAT(mir::ProbeCache{file}.lookup("key", path), Eq(module));
+}
+
+TEST_F(ProbeCache, misses_for_a_different_key)
+{
+    mir::ProbeCache const cache{file};
+
+    cache.store("key", add_module("libmodule.so"));
+
+    EXPECT_THAT(cache.lookup("another key", path), IsEmpty());
+}
+
+TEST_F(ProbeCache, keeps_results_for_several_keys)
+{
+    mir::ProbeCache const cache{file};
+
+    cache.store("one", add_module("libone.so"));
+    cache.store("two", add_module("libtwo.so"));
+    cache.store("one", add_module("libthree.so"));
+
+    EXPECT_THAT(cache.lookup("one", path), Eq(add_module("libthree.so")));
+    EXPECT_THAT(cache.lookup("two", path), Eq(add_module("libtwo.so")));
+}
+
+TEST_F(ProbeCache, with_no_file_keeps_nothing)
+{
+    mir::ProbeCache const cache{""};
+
+    cache.store("key", add_module("libmodule.so"));
+
+    EXPECT_THAT(cache.lookup("key", path), IsEmpty());
+}
+
+TEST_F(ProbeCache, misses_when_the_module_is_no_longer_in_the_path)
+{
+    auto const module = add_module("libmodule.so");
+    mir::ProbeCache const cache{file};
+
+    cache.store("key", module);
+    boost::filesystem::remove(module);
+
+    EXPECT_THAT(cache.lookup("key", path), IsEmpty());
+}
+
+TEST_F(ProbeCache, finds_the_module_in_the_path_it_is_looked_up_in)
+{
+    auto const other_path = directory / "other-modules";
+    boost::filesystem::create_directories(other_path);
+    mir::ProbeCache const cache{file};
+
+    cache.store("key", add_module("libmodule.so"));
+
+    EXPECT_THAT(cache.lookup("key", other_path.string()), IsEmpty());
+
+    auto const moved = add_library(other_path / "libmodule.so");
+    EXPECT_THAT(cache.lookup("key", other_path.string()), Eq(moved));
+}
+
+TEST_F(ProbeCache, ignores_a_file_naming_a_library_outside_the_path)
+{
+    mir::ProbeCache const cache{file};
+    cache.store("key", add_module("libmodule.so"));
+
+    // Someone rewrites the cache to point at their own library
+    add_library(directory / "libevil.so");
+    std::string contents;
+    {
+        std::ifstream in{file};
+        std::getline(in, contents);
+    }
+    contents.replace(contents.find("libmodule.so"), std::string{"libmodule.so"}.size(), "../libevil.so");
+    std::ofstream{file} << contents << '\n';
+
+    EXPECT_THAT(cache.lookup("key", path), IsEmpty());
+}
+
+TEST_F(ProbeCache, library_fingerprint_changes_when_a_library_is_added)
+{
+    auto const before = mir::library_fingerprint(path);
+
+    add_module("libnew.so");
+
+    EXPECT_THAT(mir::library_fingerprint(path), Ne(before));
+}
@@ -23,6 +23,10 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace mt = mir::test;
 
 using namespace testing;
@@ -174,3 +178,29 @@ TEST_F(RecursiveReadWriteMutex, read_lock_waits_for_write_locks_on_other_threads
 
     threads.push_back(std::thread{writer_function});
 }
+
+TEST_F(RecursiveReadWriteMutex, read_lock_taken_under_write_lock_excludes_writers_after_write_unlock)
+{
+    mutex.write_lock();
+    mutex.read_lock();
+    mutex.write_unlock();
+
+    mt::Barrier write_attempted{2};
+    std::atomic<bool> write_locked{false};
+
+    threads.push_back(std::thread{
+        [&]{
+            write_attempted.ready();
+            mutex.write_lock();
+            write_locked = true;
+            mutex.write_unlock();
+        }});
+
+    write_attempted.ready();
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_FALSE(write_locked);
+
+    mutex.read_unlock();
+    threads.back().join();
+    EXPECT_TRUE(write_locked);
+}
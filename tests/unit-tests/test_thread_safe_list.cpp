@@ -157,3 +157,60 @@ TEST_F(ThreadSafeListTest, clears_all_elements)
 
     EXPECT_THAT(elements_seen, Eq(0));
 }
+
+TEST_F(ThreadSafeListTest, remove_waits_for_element_in_use_in_different_thread)
+{
+    using namespace testing;
+
+    list.add(element1);
+
+    mir::test::Signal element_in_use;
+    std::atomic<bool> callback_done{false};
+
+    std::thread t{
+        [&]
+        {
+            list.for_each(
+                [&] (Element const&)
+                {
+                    element_in_use.raise();
+                    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+                    callback_done = true;
+                });
+        }};
+
+    element_in_use.wait_for(std::chrono::seconds{3});
+    list.remove(element1);
+
+    EXPECT_TRUE(callback_done);
+
+    t.join();
+}
+
+TEST_F(ThreadSafeListTest, element_added_while_iterating_is_seen_by_next_iteration)
+{
+    using namespace testing;
+
+    list.add(element1);
+
+    int elements_seen = 0;
+
+    list.for_each(
+        [&] (Element const&)
+        {
+            list.add(element2);
+            ++elements_seen;
+        });
+
+    EXPECT_THAT(elements_seen, Eq(1));
+
+    std::vector<Element> elements;
+
+    list.for_each(
+        [&] (Element const& element)
+        {
+            elements.push_back(element);
+        });
+
+    EXPECT_THAT(elements, ElementsAre(element1, element2));
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright © 2018 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/timer_wheel.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <random>
+
+using namespace testing;
+using Tick = mir::detail::TimerWheel::Tick;
+using Timer = mir::detail::TimerWheel::Timer;
+
+namespace
+{
+struct TimerWheel : Test
+{
+    std::vector<Timer*> advance_to(Tick tick)
+    {
+        std::vector<Timer*> expired;
+        wheel.advance_to(tick, expired);
+        return expired;
+    }
+
+    mir::detail::TimerWheel wheel;
+    Timer timer;
+    Timer other_timer;
+};
+}
+
+TEST_F(TimerWheel, timer_expires_at_its_deadline_and_not_before)
+{
+    wheel.schedule(timer, 100);
+
+    EXPECT_THAT(advance_to(99), IsEmpty());
+    EXPECT_TRUE(timer.scheduled());
+    EXPECT_THAT(advance_to(100), ElementsAre(&timer));
+    EXPECT_FALSE(timer.scheduled());
+}
+
+TEST_F(TimerWheel, timer_in_the_past_expires_on_next_advance)
+{
+    advance_to(1000);
+    wheel.schedule(timer, 10);
+
+    EXPECT_THAT(advance_to(1000), ElementsAre(&timer));
+}
+
+TEST_F(TimerWheel, cancelled_timer_does_not_expire)
+{
+    wheel.schedule(timer, 100);
+    wheel.cancel(timer);
+
+    EXPECT_FALSE(timer.scheduled());
+    EXPECT_THAT(advance_to(200), IsEmpty());
+}
+
+TEST_F(TimerWheel, rescheduled_timer_expires_only_at_new_deadline)
+{
+    wheel.schedule(timer, 100);
+    wheel.schedule(timer, 5000);
+
+    EXPECT_THAT(advance_to(4999), IsEmpty());
+    EXPECT_THAT(advance_to(5000), ElementsAre(&timer));
+}
+
+TEST_F(TimerWheel, timers_expire_in_a_single_advance)
+{
+    wheel.schedule(timer, 3);
+    wheel.schedule(other_timer, 300000);
+
+    EXPECT_THAT(advance_to(1000000), UnorderedElementsAre(&timer, &other_timer));
+}
+
+TEST_F(TimerWheel, distant_timer_expires_at_its_deadline)
+{
+    Tick const distant = Tick{1} << 40;
+    wheel.schedule(timer, distant);
+
+    EXPECT_THAT(advance_to(distant - 1), IsEmpty());
+    EXPECT_THAT(advance_to(distant), ElementsAre(&timer));
+}
+
+TEST_F(TimerWheel, next_expiry_is_unset_without_timers)
+{
+    EXPECT_FALSE(wheel.next_expiry().is_set());
+}
+
+TEST_F(TimerWheel, next_expiry_is_exact_for_near_timers)
+{
+    advance_to(10);
+    wheel.schedule(timer, 42);
+
+    EXPECT_THAT(wheel.next_expiry().value(), Eq(42u));
+}
+
+TEST_F(TimerWheel, next_expiry_never_exceeds_earliest_deadline)
+{
+    wheel.schedule(timer, 123456);
+
+    while (timer.scheduled())
+    {
+        auto const next = wheel.next_expiry().value();
+        EXPECT_THAT(next, Le(123456u));
+        advance_to(next);
+    }
+
+    EXPECT_THAT(wheel.now(), Eq(123456u));
+}
+
+TEST_F(TimerWheel, random_timers_expire_exactly_once_on_time)
+{
+    std::mt19937_64 generator{42};
+    std::array<Timer, 500> timers;
+    std::array<Tick, 500> deadlines;
+
+    for (auto i = 0u; i != timers.size(); ++i)
+    {
+        deadlines[i] = generator() % (Tick{1} << (generator() % 24));
+        wheel.schedule(timers[i], deadlines[i]);
+    }
+
+    auto remaining = timers.size();
+    while (remaining)
+    {
+        auto const target = wheel.now() + generator() % 100000;
+
+        for (auto const expired : advance_to(target))
+        {
+            auto const i = expired - timers.data();
+            EXPECT_THAT(deadlines[i], Le(target));
+            --remaining;
+        }
+
+        for (auto i = 0u; i != timers.size(); ++i)
+        {
+            EXPECT_THAT(timers[i].scheduled(), Eq(deadlines[i] > target));
+        }
+    }
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/work_queue.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+
+namespace
+{
+auto const run = [](std::function<void()>& work) { work(); };
+}
+
+TEST(WorkQueue, push_reports_only_when_queue_becomes_non_empty)
+{
+    mir::WorkQueue queue;
+
+    EXPECT_TRUE(queue.push([]{}));
+    EXPECT_FALSE(queue.push([]{}));
+
+    queue.run_all(run);
+
+    EXPECT_TRUE(queue.push([]{}));
+}
+
+TEST(WorkQueue, runs_work_in_the_order_it_was_pushed)
+{
+    mir::WorkQueue queue;
+    std::vector<int> ran;
+
+    for (int i = 0; i != 5; ++i)
+        queue.push([&ran, i] { ran.push_back(i); });
+
+    queue.run_all(run);
+
+    EXPECT_THAT(ran, ElementsAre(0, 1, 2, 3, 4));
+}
+
+TEST(WorkQueue, work_pushed_by_work_is_left_for_the_next_run)
+{
+    mir::WorkQueue queue;
+    bool pushed_was_first{false};
+    bool inner_ran{false};
+
+    queue.push([&] { pushed_was_first = queue.push([&] { inner_ran = true; }); });
+
+    queue.run_all(run);
+
+    EXPECT_TRUE(pushed_was_first);
+    EXPECT_FALSE(inner_ran);
+
+    queue.run_all(run);
+
+    EXPECT_TRUE(inner_ran);
+}
+
+TEST(WorkQueue, work_after_a_throw_is_kept_in_order)
+{
+    mir::WorkQueue queue;
+    std::vector<int> ran;
+
+    queue.push([&] { ran.push_back(0); });
+    queue.push([] { throw std::runtime_error{"work failed"}; });
+    queue.push([&] { ran.push_back(1); });
+
+    EXPECT_THROW(queue.run_all(run), std::runtime_error);
+
+    queue.push([&] { ran.push_back(2); });
+    queue.run_all(run);
+
+    EXPECT_THAT(ran, ElementsAre(0, 1, 2));
+}
+
+TEST(WorkQueue, releases_work_that_is_never_run)
+{
+    auto const captured = std::make_shared<int>();
+
+    {
+        mir::WorkQueue queue;
+        queue.push([captured] {});
+    }
+
+    EXPECT_THAT(captured.use_count(), Eq(1));
+}
+
+TEST(WorkQueue, runs_work_from_concurrent_producers)
+{
+    int const producers{4};
+    int const items_per_producer{10000};
+
+    mir::WorkQueue queue;
+    std::vector<std::vector<int>> ran(producers);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p != producers; ++p)
+    {
+        threads.emplace_back([&, p]
+            {
+                for (int i = 0; i != items_per_producer; ++i)
+                    queue.push([&ran, p, i] { ran[p].push_back(i); });
+            });
+    }
+
+    int total{0};
+    while (total != producers * items_per_producer)
+    {
+        queue.run_all(run);
+
+        total = 0;
+        for (auto const& r : ran)
+            total += r.size();
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    // Each producer's work runs in the order it was pushed
+    for (auto const& r : ran)
+    {
+        ASSERT_THAT(r.size(), Eq(size_t(items_per_producer)));
+        for (int i = 0; i != items_per_producer; ++i)
+            ASSERT_THAT(r[i], Eq(i));
+    }
+}
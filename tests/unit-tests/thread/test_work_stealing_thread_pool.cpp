@@ -0,0 +1,156 @@
+/*
+ * Copyright © 2026 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/thread/work_stealing_thread_pool.h"
+
+#include "mir/test/current_thread_name.h"
+#include "mir/test/signal.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace mt = mir::test;
+namespace mth = mir::thread;
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+namespace
+{
+struct WorkStealingThreadPool : Test
+{
+    int const workers{4};
+    std::string const name{"test_pool"};
+    std::unique_ptr<mth::WorkStealingThreadPool> pool{
+        std::make_unique<mth::WorkStealingThreadPool>(workers, name)};
+};
+}
+
+TEST_F(WorkStealingThreadPool, runs_spawned_tasks_on_its_workers)
+{
+    mt::Signal done;
+    std::string thread_name;
+
+    pool->spawn([&]
+        {
+            thread_name = mt::current_thread_name();
+            done.raise();
+        });
+
+    ASSERT_TRUE(done.wait_for(10s));
+    EXPECT_THAT(thread_name, Eq(name));
+}
+
+TEST_F(WorkStealingThreadPool, runs_all_tasks_spawned_by_tasks)
+{
+    int const count = 1000;
+    std::atomic<int> executed{0};
+    mt::Signal done;
+
+    pool->spawn([&]
+        {
+            for (auto i = 0; i != count; ++i)
+            {
+                pool->spawn([&]
+                    {
+                        if (++executed == count)
+                            done.raise();
+                    });
+            }
+        });
+
+    ASSERT_TRUE(done.wait_for(10s));
+    EXPECT_THAT(executed, Eq(count));
+}
+
+TEST_F(WorkStealingThreadPool, idle_workers_steal_from_a_busy_one)
+{
+    int const count = 10;
+    std::atomic<int> executed{0};
+    mt::Signal all_executed;
+    mt::Signal parent_done;
+
+    pool->spawn([&]
+        {
+            // These go onto this worker's own deque, and it then stays busy
+            // until they have run, so only other workers can run them
+            for (auto i = 0; i != count; ++i)
+            {
+                pool->spawn([&]
+                    {
+                        if (++executed == count)
+                            all_executed.raise();
+                    });
+            }
+
+            all_executed.wait_for(10s);
+            parent_done.raise();
+        });
+
+    ASSERT_TRUE(parent_done.wait_for(10s));
+    EXPECT_THAT(executed, Eq(count));
+    EXPECT_THAT(pool->statistics().stolen, Ge(uint64_t(count)));
+}
+
+TEST_F(WorkStealingThreadPool, runs_queued_tasks_before_destruction)
+{
+    int const count = 100;
+    std::atomic<int> executed{0};
+
+    for (auto i = 0; i != count; ++i)
+        pool->spawn([&] { std::this_thread::sleep_for(100us); ++executed; });
+
+    pool.reset();
+
+    EXPECT_THAT(executed, Eq(count));
+}
+
+TEST_F(WorkStealingThreadPool, keeps_running_after_a_task_throws)
+{
+    mt::Signal done;
+
+    pool->spawn([] { throw std::runtime_error{"task failed"}; });
+    pool->spawn([&] { done.raise(); });
+
+    EXPECT_TRUE(done.wait_for(10s));
+}
+
+TEST_F(WorkStealingThreadPool, reports_statistics)
+{
+    int const count = 20;
+    mth::WorkStealingThreadPool single_worker{1, name};
+
+    mt::Signal started;
+    mt::Signal release;
+    single_worker.spawn([&] { started.raise(); release.wait_for(10s); });
+    ASSERT_TRUE(started.wait_for(10s));
+
+    for (auto i = 0; i != count; ++i)
+        single_worker.spawn([]{});
+
+    auto const stats = single_worker.statistics();
+    EXPECT_THAT(stats.spawned, Eq(uint64_t(count + 1)));
+    EXPECT_THAT(stats.executed, Eq(0u));
+    EXPECT_THAT(stats.queued, Eq(uint64_t(count)));
+
+    release.raise();
+}